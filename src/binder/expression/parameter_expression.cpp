@@ -16,7 +16,16 @@ void ParameterExpression::cast(const LogicalType& type) {
         // LCOV_EXCL_STOP
     }
     dataType = type.copy();
-    value.setDataType(type);
+}
+
+Value ParameterExpression::getValue() const {
+    auto result = *value;
+    // The bound value keeps the type it was given, which may still be a null or an empty list
+    // whose type is free to change to the type the expression has been cast to.
+    if (result.getDataType() != dataType && result.allowTypeChange()) {
+        result.setDataType(dataType);
+    }
+    return result;
 }
 
 } // namespace binder
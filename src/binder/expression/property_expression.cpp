@@ -49,5 +49,14 @@ bool PropertyExpression::hasProperty(common::table_id_t tableID) const {
     return infos.at(tableID).exists;
 }
 
+std::vector<table_id_t> PropertyExpression::getTableIDs() const {
+    std::vector<table_id_t> tableIDs;
+    tableIDs.reserve(infos.size());
+    for (auto& [tableID, _] : infos) {
+        tableIDs.push_back(tableID);
+    }
+    return tableIDs;
+}
+
 } // namespace binder
 } // namespace kuzu
@@ -360,6 +360,11 @@ void Catalog::addBuiltInFunction(CatalogEntryType entryType, std::string name,
     addFunction(&DUMMY_TRANSACTION, entryType, std::move(name), std::move(functionSet));
 }
 
+uint64_t Catalog::getVersion() const {
+    return tables->getVersion() + sequences->getVersion() + functions->getVersion() +
+           types->getVersion();
+}
+
 CatalogSet* Catalog::getFunctions(Transaction*) const {
     return functions.get();
 }
@@ -95,6 +95,8 @@ void TableCatalogEntry::serialize(Serializer& serializer) const {
     serializer.write(comment);
     serializer.writeDebuggingInfo("properties");
     propertyCollection.serialize(serializer);
+    serializer.writeDebuggingInfo("stats");
+    stats.serialize(serializer);
 }
 
 std::unique_ptr<TableCatalogEntry> TableCatalogEntry::deserialize(
@@ -105,6 +107,8 @@ std::unique_ptr<TableCatalogEntry> TableCatalogEntry::deserialize(
     deserializer.deserializeValue(comment);
     deserializer.validateDebuggingInfo(debuggingInfo, "properties");
     auto propertyCollection = PropertyDefinitionCollection::deserialize(deserializer);
+    deserializer.validateDebuggingInfo(debuggingInfo, "stats");
+    auto stats = storage::TableStats::deserialize(deserializer);
     std::unique_ptr<TableCatalogEntry> result;
     switch (type) {
     case CatalogEntryType::NODE_TABLE_ENTRY:
@@ -124,6 +128,7 @@ std::unique_ptr<TableCatalogEntry> TableCatalogEntry::deserialize(
     }
     result->comment = std::move(comment);
     result->propertyCollection = std::move(propertyCollection);
+    result->stats = std::move(stats);
     return result;
 }
 
@@ -133,6 +138,7 @@ void TableCatalogEntry::copyFrom(const CatalogEntry& other) {
     set = otherTable.set;
     comment = otherTable.comment;
     propertyCollection = otherTable.propertyCollection.copy();
+    stats = otherTable.stats;
 }
 
 BoundCreateTableInfo TableCatalogEntry::getBoundCreateTableInfo(
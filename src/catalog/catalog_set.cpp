@@ -106,10 +106,12 @@ void CatalogSet::emplaceNoLock(std::unique_ptr<CatalogEntry> entry) {
         entries.erase(entry->getName());
     }
     entries.emplace(entry->getName(), std::move(entry));
+    incrementVersion();
 }
 
 void CatalogSet::eraseNoLock(const std::string& name) {
     entries.erase(name);
+    incrementVersion();
 }
 
 std::unique_ptr<CatalogEntry> CatalogSet::createDummyEntryNoLock(std::string name, oid_t oid) {
@@ -1,12 +1,15 @@
 #include "common/arrow/arrow_row_batch.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "common/exception/runtime.h"
+#include "common/null_buffer.h"
 #include "common/types/uuid.h"
 #include "common/types/value/node.h"
 #include "common/types/value/rel.h"
 #include "common/types/value/value.h"
+#include "processor/result/factorized_table.h"
 #include "storage/storage_utils.h"
 
 namespace kuzu {
@@ -951,7 +954,128 @@ ArrowArray ArrowRowBatch::toArray() {
     return result;
 }
 
+bool ArrowRowBatch::canAppendColumnar(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL:
+    case LogicalTypeID::INT128:
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::TIMESTAMP_MS:
+    case LogicalTypeID::TIMESTAMP_NS:
+    case LogicalTypeID::TIMESTAMP_SEC:
+    case LogicalTypeID::TIMESTAMP_TZ:
+    case LogicalTypeID::TIMESTAMP:
+    case LogicalTypeID::BLOB:
+    case LogicalTypeID::STRING:
+        return true;
+    default:
+        // Decimals and intervals are converted, and nested values need their children appended.
+        return false;
+    }
+}
+
+std::int64_t ArrowRowBatch::appendColumnar(main::QueryResult& queryResult,
+    std::int64_t chunkSize) {
+    std::int64_t numTuplesInBatch = 0;
+    while (numTuplesInBatch < chunkSize && queryResult.hasNext()) {
+        auto run = queryResult.getNextFlatTupleRun(chunkSize - numTuplesInBatch);
+        for (auto i = 0u; i < types.size(); i++) {
+            appendFlatTupleRun(vectors[i].get(), types[i], run, i);
+        }
+        numTuplesInBatch += run.numFlatTuples;
+    }
+    return numTuplesInBatch;
+}
+
+void ArrowRowBatch::appendFlatTupleRun(ArrowVector* vector, const LogicalType& type,
+    const processor::FlatTupleRun& run, uint32_t colIdx) {
+    auto tableSchema = run.table->getTableSchema();
+    auto column = tableSchema->getColumn(colIdx);
+    auto valueSize = LogicalTypeUtils::getRowLayoutSize(type);
+    const uint8_t* values = run.tuple + tableSchema->getColOffset(colIdx);
+    // The value of a flat column is repeated for all flat tuples of the run.
+    uint64_t valueStride = 0;
+    auto isFlatValueNull = false;
+    const uint8_t* nullBuffer = nullptr;
+    if (column->isFlat()) {
+        isFlatValueNull =
+            run.table->isNonOverflowColNull(run.tuple + tableSchema->getNullMapOffset(), colIdx);
+    } else {
+        auto overflowValue = reinterpret_cast<const overflow_value_t*>(values);
+        values = overflowValue->value + run.startIdx * valueSize;
+        valueStride = valueSize;
+        if (!column->hasNoNullGuarantee()) {
+            nullBuffer = overflowValue->value + overflowValue->numElements * valueSize;
+        }
+    }
+    auto isNull = [&](uint64_t i) {
+        return isFlatValueNull ||
+               (nullBuffer != nullptr && NullBuffer::isNull(nullBuffer, run.startIdx + i));
+    };
+    auto pos = vector->numValues;
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL: {
+        for (auto i = 0u; i < run.numFlatTuples; i++) {
+            if (!isNull(i) && *reinterpret_cast<const bool*>(values + i * valueStride)) {
+                setBitToOne(vector->data.data(), pos + i);
+            } else {
+                setBitToZero(vector->data.data(), pos + i);
+            }
+        }
+    } break;
+    case LogicalTypeID::BLOB:
+    case LogicalTypeID::STRING: {
+        auto offsets = (std::uint32_t*)vector->data.data();
+        if (pos == 0) {
+            offsets[pos] = 0;
+        }
+        for (auto i = 0u; i < run.numFlatTuples; i++) {
+            auto str = reinterpret_cast<const ku_string_t*>(values + i * valueStride);
+            auto strLength = isNull(i) ? 0 : str->len;
+            offsets[pos + i + 1] = offsets[pos + i] + strLength;
+            vector->overflow.resize(offsets[pos + i + 1] + 1);
+            std::memcpy(vector->overflow.data() + offsets[pos + i], str->getData(), strLength);
+        }
+    } break;
+    default: {
+        // Fixed size values have the same layout in the factorized table and in Arrow.
+        auto dst = vector->data.data() + pos * valueSize;
+        if (valueStride == 0) {
+            for (auto i = 0u; i < run.numFlatTuples; i++) {
+                std::memcpy(dst + i * valueSize, values, valueSize);
+            }
+        } else {
+            std::memcpy(dst, values, run.numFlatTuples * valueSize);
+        }
+    }
+    }
+    if (isFlatValueNull || nullBuffer != nullptr) {
+        for (auto i = 0u; i < run.numFlatTuples; i++) {
+            if (isNull(i)) {
+                setBitToZero(vector->validity.data(), pos + i);
+                vector->numNulls++;
+            }
+        }
+    }
+    vector->numValues += run.numFlatTuples;
+}
+
 ArrowArray ArrowRowBatch::append(main::QueryResult& queryResult, std::int64_t chunkSize) {
+    if (queryResult.canReadFlatTupleRuns() &&
+        std::all_of(types.begin(), types.end(), canAppendColumnar)) {
+        numTuples += appendColumnar(queryResult, chunkSize);
+        return toArray();
+    }
     std::int64_t numTuplesInBatch = 0;
     auto numColumns = queryResult.getColumnNames().size();
     while (numTuplesInBatch < chunkSize) {
@@ -39,5 +39,9 @@ void FileInfo::truncate(uint64_t size) {
     fileSystem->truncate(*this, size);
 }
 
+void FileInfo::prefetch(uint64_t position, uint64_t numBytes) {
+    fileSystem->prefetch(*this, position, numBytes);
+}
+
 } // namespace common
 } // namespace kuzu
@@ -20,6 +20,7 @@
 
 #include <fcntl.h>
 
+#include <algorithm>
 #include <cstring>
 
 namespace kuzu {
@@ -395,5 +396,23 @@ uint64_t LocalFileSystem::getFileSize(const FileInfo& fileInfo) const {
 #endif
 }
 
+void LocalFileSystem::prefetch(FileInfo& fileInfo, uint64_t position, uint64_t numBytes) const {
+    // The hint only schedules asynchronous reads into the OS page cache, so failures are ignored.
+#if defined(__linux__)
+    auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
+    posix_fadvise(localFileInfo->fd, position, numBytes, POSIX_FADV_WILLNEED);
+#elif defined(__APPLE__)
+    auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
+    struct radvisory advisory {};
+    advisory.ra_offset = static_cast<off_t>(position);
+    advisory.ra_count = static_cast<int>(std::min(numBytes, static_cast<uint64_t>(INT32_MAX)));
+    fcntl(localFileInfo->fd, F_RDADVISE, &advisory);
+#else
+    (void)fileInfo;
+    (void)position;
+    (void)numBytes;
+#endif
+}
+
 } // namespace common
 } // namespace kuzu
@@ -41,6 +41,26 @@ void InMemOverflowBuffer::resetBuffer() {
     }
 }
 
+void InMemOverflowBuffer::pin() {
+    for (auto& block : blocks) {
+        block->block->pin();
+    }
+}
+
+void InMemOverflowBuffer::unpin() {
+    for (auto& block : blocks) {
+        block->block->unpin();
+    }
+}
+
+uint64_t InMemOverflowBuffer::getMemoryUsage() const {
+    uint64_t memoryUsage = 0;
+    for (auto& block : blocks) {
+        memoryUsage += block->size();
+    }
+    return memoryUsage;
+}
+
 void InMemOverflowBuffer::allocateNewBlock(uint64_t size) {
     auto newBlock = make_unique<BufferBlock>(
         memoryManager->allocateBuffer(false /* do not initialize to zero */, size));
@@ -48,8 +48,10 @@ void ProgressBar::finishPipeline(uint64_t queryID) {
     if (!trackProgress) {
         return;
     }
+    // Independent pipelines of a query can finish concurrently.
+    std::lock_guard<std::mutex> lock(progressBarLock);
     numPipelinesFinished++;
-    updateProgress(queryID, 0.0);
+    updateDisplay(queryID, 0.0);
 }
 
 void ProgressBar::updateProgress(uint64_t queryID, double curPipelineProgress) {
@@ -18,10 +18,18 @@ void Task::deRegisterThreadAndFinalizeTask() {
     lock_t lck{mtx};
     ++numThreadsFinished;
     if (!hasExceptionNoLock() && isCompletedNoLock()) {
+        finalizing = true;
+        lck.unlock();
+        std::exception_ptr finalizeException = nullptr;
         try {
             finalizeIfNecessary();
         } catch (std::exception& e) {
-            setExceptionNoLock(std::current_exception());
+            finalizeException = std::current_exception();
+        }
+        lck.lock();
+        finalizing = false;
+        if (finalizeException != nullptr) {
+            setExceptionNoLock(std::move(finalizeException));
         }
     }
     if (isCompletedNoLock()) {
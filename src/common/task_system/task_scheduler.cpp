@@ -1,5 +1,7 @@
 #include "common/task_system/task_scheduler.h"
 
+#include <algorithm>
+
 using namespace kuzu::common;
 
 namespace kuzu {
@@ -24,9 +26,7 @@ TaskScheduler::~TaskScheduler() {
 
 void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
     processor::ExecutionContext* context, bool launchNewWorkerThread) {
-    for (auto& dependency : task->children) {
-        scheduleTaskAndWaitOrError(dependency, context);
-    }
+    scheduleChildrenAndWaitOrError(*task, context);
     std::thread newWorkerThread;
     if (launchNewWorkerThread) {
         // Note that newWorkerThread is not executing yet. However, we still call
@@ -38,7 +38,7 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         newWorkerThread = std::thread(runTask, task.get());
     }
     auto scheduledTask = pushTaskIntoQueue(task);
-    cv.notify_all();
+    notifyWorkers(*task);
     std::unique_lock<std::mutex> taskLck{task->mtx, std::defer_lock};
     while (true) {
         taskLck.lock();
@@ -78,34 +78,194 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
     }
 }
 
+void TaskScheduler::scheduleTaskOnCallingThreadAndWaitOrError(const std::shared_ptr<Task>& task,
+    processor::ExecutionContext* context) {
+    scheduleChildrenAndWaitOrError(*task, context);
+    task->setSingleThreadedTask();
+    task->registerThread();
+    runTask(task.get());
+    if (task->hasException()) {
+        std::rethrow_exception(task->getExceptionPtr());
+    }
+}
+
+// Appends the tasks of the subtree rooted at the given task such that each task comes after its
+// children.
+static void collectTasksInPostOrder(const std::shared_ptr<Task>& task,
+    std::vector<std::shared_ptr<Task>>& tasks) {
+    for (auto& child : task->children) {
+        collectTasksInPostOrder(child, tasks);
+    }
+    tasks.push_back(task);
+}
+
+static bool areChildrenCompletedSuccessfully(const Task& task) {
+    for (auto& child : task.children) {
+        if (!child->isCompletedSuccessfully()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TaskScheduler::scheduleChildrenAndWaitOrError(const Task& task,
+    processor::ExecutionContext* context) {
+    const auto numChildren = task.children.size();
+    const auto maxNumConcurrentChildren =
+        std::min<uint64_t>(task.getMaxNumConcurrentChildren(), numChildren);
+    if (maxNumConcurrentChildren <= 1) {
+        for (auto& dependency : task.children) {
+            scheduleTaskAndWaitOrError(dependency, context);
+        }
+        return;
+    }
+    // The calling thread alone drives the subtrees of the children: it keeps up to
+    // maxNumConcurrentChildren of their tasks whose own children have completed in the queue, and
+    // waits for any of them to complete before scheduling more. The work itself is done by the
+    // worker threads, which are shared across the scheduled tasks.
+    std::vector<std::shared_ptr<Task>> tasks;
+    for (auto& child : task.children) {
+        collectTasksInPostOrder(child, tasks);
+    }
+    std::vector<bool> isScheduled(tasks.size(), false);
+    std::vector<std::shared_ptr<ScheduledTask>> runningTasks;
+    std::exception_ptr exceptionPtr = nullptr;
+    lock_t lck{mtx};
+    while (true) {
+        auto hasErroringTask = false;
+        for (auto it = runningTasks.begin(); it != runningTasks.end();) {
+            auto& runningTask = *(*it)->task;
+            lock_t taskLck{runningTask.mtx};
+            hasErroringTask |= runningTask.hasExceptionNoLock();
+            if (!runningTask.isCompletedNoLock()) {
+                ++it;
+                continue;
+            }
+            if (runningTask.hasExceptionNoLock()) {
+                if (exceptionPtr == nullptr) {
+                    exceptionPtr = runningTask.exceptionsPtr;
+                }
+                taskLck.unlock();
+                removeErroringTaskNoLock((*it)->ID);
+            }
+            it = runningTasks.erase(it);
+        }
+        // Once a task errors, the remaining tasks are skipped and the running ones interrupted.
+        if (exceptionPtr == nullptr) {
+            for (auto i = 0u; i < tasks.size() && runningTasks.size() < maxNumConcurrentChildren;
+                 i++) {
+                if (isScheduled[i] || !areChildrenCompletedSuccessfully(*tasks[i])) {
+                    continue;
+                }
+                isScheduled[i] = true;
+                runningTasks.push_back(pushTaskIntoQueueNoLock(tasks[i]));
+                notifyWorkers(*tasks[i]);
+            }
+        }
+        if (runningTasks.empty()) {
+            break;
+        }
+        auto timeout = 0u;
+        if (context->clientContext->hasTimeout()) {
+            timeout = context->clientContext->getTimeoutRemainingInMS();
+            if (timeout == 0) {
+                context->clientContext->interrupt();
+            }
+        } else if (hasErroringTask || exceptionPtr != nullptr) {
+            context->clientContext->interrupt();
+        }
+        if (timeout > 0) {
+            taskCompletedCV.wait_for(lck, std::chrono::milliseconds(timeout));
+        } else {
+            taskCompletedCV.wait(lck);
+        }
+    }
+    if (exceptionPtr != nullptr) {
+        std::rethrow_exception(exceptionPtr);
+    }
+}
+
+void TaskScheduler::runTaskAndWaitOrError(const std::shared_ptr<Task>& task) {
+    task->registerThread();
+    std::shared_ptr<ScheduledTask> scheduledTask = nullptr;
+    if (task->getMaxNumThreads() > 1) {
+        lock_t lck{mtx};
+        scheduledTask = pushTaskIntoQueueNoLock(task);
+        notifyWorkers(*task);
+    }
+    runTask(task.get());
+    lock_t taskLck{task->mtx};
+    task->cv.wait(taskLck, [&] { return task->isCompletedNoLock(); });
+    taskLck.unlock();
+    if (task->hasException()) {
+        if (scheduledTask != nullptr) {
+            removeErroringTask(scheduledTask->ID);
+        }
+        std::rethrow_exception(task->getExceptionPtr());
+    }
+}
+
 std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
     lock_t lck{mtx};
+    return pushTaskIntoQueueNoLock(task);
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueueNoLock(
+    const std::shared_ptr<Task>& task) {
     auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++);
     taskQueue.push_back(scheduledTask);
     return scheduledTask;
 }
 
+void TaskScheduler::notifyWorkers(const Task& task) {
+    const auto numWorkersToNotify =
+        std::min<uint64_t>(task.getMaxNumThreads(), workerThreads.size());
+    if (numWorkersToNotify == workerThreads.size()) {
+        cv.notify_all();
+        return;
+    }
+    for (auto i = 0u; i < numWorkersToNotify; i++) {
+        cv.notify_one();
+    }
+}
+
 std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
-    if (taskQueue.empty()) {
-        return nullptr;
-    }
-    auto it = taskQueue.begin();
-    while (it != taskQueue.end()) {
-        auto task = (*it)->task;
-        if (!task->registerThread()) {
-            // If we cannot register for a thread it is because of three possibilities:
-            // (i) maximum number of threads have registered for task and the task is completed
-            // without an exception; or (ii) same as (i) but the task has not yet successfully
-            // completed; or (iii) task has an exception; Only in (i) we remove the task from the
-            // queue. For (ii) and (iii) we keep the task in queue. Recall erroring tasks need to be
-            // manually removed.
-            if (task->isCompletedSuccessfully()) { // option (i)
-                it = taskQueue.erase(it);
-            } else { // option (ii) or (iii): keep the task in the queue.
-                ++it;
+    while (!taskQueue.empty()) {
+        std::shared_ptr<ScheduledTask> taskToRegister = nullptr;
+        auto minNumThreadsRegistered = UINT64_MAX;
+        auto it = taskQueue.begin();
+        while (it != taskQueue.end()) {
+            auto& task = *(*it)->task;
+            lock_t taskLck{task.mtx};
+            if (task.hasExceptionNoLock() || !task.canRegisterNoLock()) {
+                // If we cannot register for a thread it is because of three possibilities:
+                // (i) maximum number of threads have registered for task and the task is
+                // completed without an exception; or (ii) same as (i) but the task has not yet
+                // successfully completed; or (iii) task has an exception; Only in (i) we remove
+                // the task from the queue. For (ii) and (iii) we keep the task in queue. Recall
+                // erroring tasks need to be manually removed.
+                if (task.isCompletedNoLock() && !task.hasExceptionNoLock()) { // option (i)
+                    taskLck.unlock();
+                    it = taskQueue.erase(it);
+                } else { // option (ii) or (iii): keep the task in the queue.
+                    ++it;
+                }
+                continue;
             }
-        } else {
-            return *it;
+            // Strictly less, so that ties go to the task scheduled first.
+            if (task.numThreadsRegistered < minNumThreadsRegistered) {
+                minNumThreadsRegistered = task.numThreadsRegistered;
+                taskToRegister = *it;
+            }
+            ++it;
+        }
+        if (taskToRegister == nullptr) {
+            return nullptr;
+        }
+        // Registration can still fail if the task errored or a thread registered itself outside
+        // the scheduler (see `launchNewWorkerThread`) in the meantime. In that case, pick again.
+        if (taskToRegister->task->registerThread()) {
+            return taskToRegister;
         }
     }
     return nullptr;
@@ -113,6 +273,10 @@ std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
 
 void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
     lock_t lck{mtx};
+    removeErroringTaskNoLock(scheduledTaskID);
+}
+
+void TaskScheduler::removeErroringTaskNoLock(uint64_t scheduledTaskID) {
     for (auto it = taskQueue.begin(); it != taskQueue.end(); ++it) {
         if (scheduledTaskID == (*it)->ID) {
             taskQueue.erase(it);
@@ -122,19 +286,20 @@ void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
 }
 
 void TaskScheduler::runWorkerThread() {
-    std::unique_lock<std::mutex> lck{mtx, std::defer_lock};
+    std::unique_lock<std::mutex> lck{mtx};
     while (true) {
         std::shared_ptr<ScheduledTask> scheduledTask = nullptr;
-        lck.lock();
         cv.wait(lck, [&] {
             scheduledTask = getTaskAndRegister();
             return scheduledTask != nullptr || stopWorkerThreads;
         });
-        lck.unlock();
         if (stopWorkerThreads) {
             return;
         }
+        lck.unlock();
         TaskScheduler::runTask(scheduledTask->task.get());
+        lck.lock();
+        taskCompletedCV.notify_all();
     }
 }
 
@@ -6,25 +6,69 @@ namespace kuzu {
 namespace function {
 
 void GDSTask::run() {
-    RangeFrontierMorsel frontierMorsel;
-    auto numApproxActiveNodesForNextIter = 0u;
     std::unique_ptr<graph::Graph> graph = sharedState->graph->copy();
     auto state = graph->prepareScan(sharedState->relTableIDToScan);
+    uint64_t numApproxActiveNodesForNextIter = 0u;
+    if (sharedState->frontiers.getDirection() == FrontierDirection::PUSH) {
+        numApproxActiveNodesForNextIter = push(*graph, *state);
+    } else {
+        numApproxActiveNodesForNextIter = pull(*graph, *state);
+    }
+    sharedState->frontiers.incrementApproxActiveNodesForNextIter(numApproxActiveNodesForNextIter);
+}
+
+uint64_t GDSTask::push(graph::Graph& graph, graph::GraphScanState& state) {
+    RangeFrontierMorsel frontierMorsel;
+    auto numApproxActiveNodesForNextIter = 0u;
     while (sharedState->frontiers.getNextFrontierMorsel(frontierMorsel)) {
         while (frontierMorsel.hasNextVertex()) {
             nodeID_t nodeID = frontierMorsel.getNextVertex();
             if (sharedState->frontiers.curFrontier->isActive(nodeID)) {
-                auto nbrIDs = graph->scanFwd(nodeID, *state);
-                for (auto nbrID : nbrIDs) {
-                    if (sharedState->fc.edgeCompute(nodeID, nbrID)) {
-                        sharedState->frontiers.nextFrontier->setActive(nbrID);
+                graph.scanFwd(nodeID, state, [&](const graph::NbrChunk& chunk) {
+                    chunk.forEach([&](nodeID_t nbrID, sel_t) {
+                        if (sharedState->fc.edgeCompute(nodeID, nbrID)) {
+                            sharedState->frontiers.nextFrontier->setActive(nbrID);
+                            numApproxActiveNodesForNextIter++;
+                        }
+                    });
+                });
+            }
+        }
+    }
+    return numApproxActiveNodesForNextIter;
+}
+
+uint64_t GDSTask::pull(graph::Graph& graph, graph::GraphScanState& state) {
+    RangeFrontierMorsel frontierMorsel;
+    auto numApproxActiveNodesForNextIter = 0u;
+    while (sharedState->frontiers.getNextFrontierMorsel(frontierMorsel)) {
+        while (frontierMorsel.hasNextVertex()) {
+            nodeID_t nodeID = frontierMorsel.getNextVertex();
+            if (!sharedState->fc.isPullCandidate(nodeID)) {
+                continue;
+            }
+            graph.initScanBwd(nodeID, state);
+            auto pulled = false;
+            while (!pulled) {
+                const auto chunk = graph.scanNext(state);
+                if (!chunk.has_value()) {
+                    break;
+                }
+                for (auto i = 0u; i < chunk->size(); i++) {
+                    const auto nbrID = chunk->getNbrNodeID(i);
+                    if (sharedState->frontiers.curFrontier->isActive(nbrID) &&
+                        sharedState->fc.edgeCompute(nbrID, nodeID)) {
+                        sharedState->frontiers.nextFrontier->setActive(nodeID);
                         numApproxActiveNodesForNextIter++;
+                        pulled = true;
+                        break;
                     }
                 }
             }
         }
     }
-    sharedState->frontiers.incrementApproxActiveNodesForNextIter(numApproxActiveNodesForNextIter);
+    return numApproxActiveNodesForNextIter;
 }
+
 } // namespace function
 } // namespace kuzu
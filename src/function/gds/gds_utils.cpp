@@ -31,7 +31,17 @@ void GDSUtils::parallelizeFrontierCompute(processor::ExecutionContext* execution
 
 void GDSUtils::runFrontiersUntilConvergence(processor::ExecutionContext* executionContext,
     Frontiers& frontiers, graph::Graph* graph, FrontierCompute& fc, uint64_t maxIters) {
+    const auto numNodes = graph->getNumNodes();
     while (frontiers.hasActiveNodesForNextIter() && frontiers.getNextIter() < maxIters) {
+        // Switch between pushing and pulling as in Ligra: pull once the frontier is large
+        // compared to the graph and push again once it shrinks. The number of active nodes may
+        // be over-counted, which only makes pulling more likely.
+        const auto numActiveNodes = frontiers.getNumApproxActiveNodesForNextIter();
+        const auto pull = fc.canPull() && numActiveNodes * PULL_THRESHOLD_DIVISOR > numNodes;
+        if (pull) {
+            graph->prepareBwdScans();
+        }
+        frontiers.setDirection(pull ? FrontierDirection::PULL : FrontierDirection::PUSH);
         frontiers.beginNewIteration();
         for (auto& relTableIDInfo : graph->getRelTableIDInfos()) {
             frontiers.beginFrontierComputeBetweenTables(relTableIDInfo.fromNodeTableID,
@@ -1,8 +1,8 @@
 #include "binder/binder.h"
 #include "binder/expression/expression_util.h"
-#include "common/types/internal_id_util.h"
 #include "function/gds/gds.h"
 #include "function/gds/gds_function_collection.h"
+#include "function/gds/gds_node_values.h"
 #include "function/gds_function.h"
 #include "graph/graph.h"
 #include "main/client_context.h"
@@ -46,13 +46,13 @@ public:
         vectors.push_back(rankVector.get());
     }
 
-    void materialize(graph::Graph* graph, const common::node_id_map_t<double>& ranks,
+    void materialize(graph::Graph* graph, const GDSNodeValues<double>& ranks,
         FactorizedTable& table) const {
         for (auto tableID : graph->getNodeTableIDs()) {
             for (auto offset = 0u; offset < graph->getNumNodes(tableID); ++offset) {
                 auto nodeID = nodeID_t{offset, tableID};
                 nodeIDVector->setValue<nodeID_t>(0, nodeID);
-                rankVector->setValue<double>(0, ranks.at(nodeID));
+                rankVector->setValue<double>(0, ranks.getValue(nodeID));
                 table.append(vectors);
             }
         }
@@ -105,41 +105,53 @@ public:
         localState = std::make_unique<PageRankLocalState>(context);
     }
 
+    // Neighbors are counted once, then each iteration scans the graph.
+    uint64_t getNumGraphScansEstimate() const override {
+        return bindData->ptrCast<PageRankBindData>()->maxIteration + 1;
+    }
+
     void exec(processor::ExecutionContext*) override {
         auto extraData = bindData->ptrCast<PageRankBindData>();
         auto pageRankLocalState = localState->ptrCast<PageRankLocalState>();
         auto graph = sharedState->graph.get();
         // Initialize state.
-        common::node_id_map_t<double> ranks;
         auto numNodes = graph->getNumNodes();
-        for (auto tableID : graph->getNodeTableIDs()) {
+        auto ranks = GDSNodeValues<double>(*graph, 1.0 / numNodes);
+        auto dampingValue = (1 - extraData->dampingFactor) / numNodes;
+        auto nodeTableIDs = graph->getNodeTableIDs();
+        auto scanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
+        // The number of neighbors of a node does not change across iterations, so count them once
+        // instead of scanning the neighbors of each neighbor in every iteration.
+        auto numNbrs = GDSNodeValues<uint64_t>(*graph, 0);
+        for (auto tableID : nodeTableIDs) {
             for (auto offset = 0u; offset < graph->getNumNodes(tableID); ++offset) {
                 auto nodeID = nodeID_t{offset, tableID};
-                ranks.insert({nodeID, 1.0 / numNodes});
+                auto numNbrsOfNode = graph->getNumFwdNbrs(nodeID, *scanState);
+                numNbrs.setValue(nodeID, numNbrsOfNode == 0 ? numNodes : numNbrsOfNode);
             }
         }
-        auto dampingValue = (1 - extraData->dampingFactor) / numNodes;
         // Compute page rank.
-        auto nodeTableIDs = graph->getNodeTableIDs();
-        auto scanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
         for (auto i = 0u; i < extraData->maxIteration; ++i) {
             auto change = 0.0;
             for (auto tableID : nodeTableIDs) {
                 for (auto offset = 0u; offset < graph->getNumNodes(tableID); ++offset) {
                     auto nodeID = nodeID_t{offset, tableID};
                     auto rank = 0.0;
-                    auto nbrs = graph->scanFwd(nodeID, *scanState);
-                    for (auto& nbr : nbrs) {
-                        auto numNbrOfNbr = graph->scanFwd(nbr, *scanState).size();
-                        if (numNbrOfNbr == 0) {
-                            numNbrOfNbr = graph->getNumNodes();
-                        }
-                        rank += extraData->dampingFactor * (ranks[nbr] / numNbrOfNbr);
-                    }
+                    graph->scanFwd(nodeID, *scanState, [&](const NbrChunk& chunk) {
+                        // All nbrs in a chunk are in the same node table.
+                        const auto nbrTableID = chunk.getNbrNodeID(0).tableID;
+                        const auto nbrRanks = ranks.getTableValues(nbrTableID);
+                        const auto nbrNumNbrs = numNbrs.getTableValues(nbrTableID);
+                        chunk.forEach([&](nodeID_t nbr, sel_t) {
+                            rank += extraData->dampingFactor *
+                                    (nbrRanks[nbr.offset].load(std::memory_order_relaxed) /
+                                        nbrNumNbrs[nbr.offset].load(std::memory_order_relaxed));
+                        });
+                    });
                     rank += dampingValue;
-                    double diff = ranks[nodeID] - rank;
+                    double diff = ranks.getValue(nodeID) - rank;
                     change += diff < 0 ? -diff : diff;
-                    ranks[nodeID] = rank;
+                    ranks.setValue(nodeID, rank);
                 }
             }
             if (change < extraData->delta) {
@@ -121,6 +121,7 @@ public:
 
     void fixNextFrontierNodeTable(common::table_id_t tableID) {
         KU_ASSERT(masks.contains(tableID));
+        nextFrontierFixedTableID = tableID;
         nextFrontierFixedMask = masks.at(tableID).get();
     }
 
@@ -129,11 +130,17 @@ public:
         return curFrontierFixedMask->getSize();
     }
 
+    uint64_t getNumNodesInNextFrontierFixedNodeTable() {
+        KU_ASSERT(nextFrontierFixedMask != nullptr);
+        return nextFrontierFixedMask->getSize();
+    }
+
 private:
     uint8_t curIter = 255;
     common::table_id_map_t<std::unique_ptr<MaskData>> masks;
     common::table_id_t curFrontierFixedTableID;
     MaskData* curFrontierFixedMask;
+    common::table_id_t nextFrontierFixedTableID;
     MaskData* nextFrontierFixedMask;
 };
 
@@ -149,18 +156,22 @@ public:
           pathLengths{pathLengths} {}
 
     bool getNextFrontierMorsel(RangeFrontierMorsel& frontierMorsel) override {
-        if (nextOffset.load() >= pathLengths->getNumNodesInCurFrontierFixedNodeTable()) {
+        const auto isPush = direction == FrontierDirection::PUSH;
+        auto numNodes = isPush ? pathLengths->getNumNodesInCurFrontierFixedNodeTable() :
+                                 pathLengths->getNumNodesInNextFrontierFixedNodeTable();
+        if (nextOffset.load() >= numNodes) {
             return false;
         }
-        auto numNodes = pathLengths->getNumNodesInCurFrontierFixedNodeTable();
         auto beginOffset = nextOffset.fetch_add(FRONTIER_MORSEL_SIZE);
-        if (beginOffset >= pathLengths->getNumNodesInCurFrontierFixedNodeTable()) {
+        if (beginOffset >= numNodes) {
             return false;
         }
         auto endOffset = beginOffset + FRONTIER_MORSEL_SIZE > numNodes ?
                              numNodes :
                              beginOffset + FRONTIER_MORSEL_SIZE;
-        frontierMorsel.initMorsel(pathLengths->curFrontierFixedTableID, beginOffset, endOffset);
+        frontierMorsel.initMorsel(isPush ? pathLengths->curFrontierFixedTableID :
+                                           pathLengths->nextFrontierFixedTableID,
+            beginOffset, endOffset);
         return true;
     }
 
@@ -328,6 +339,12 @@ struct SPLengthsFrontierCompute : public FrontierCompute {
         return pathLengthsFrontiers->pathLengths->getMaskValueFromNextFrontierFixedMask(
                    nbrID.offset) == PathLengths::UNVISITED;
     }
+
+    bool canPull() const override { return true; }
+    bool isPullCandidate(nodeID_t nodeID) override {
+        return pathLengthsFrontiers->pathLengths->getMaskValueFromNextFrontierFixedMask(
+                   nodeID.offset) == PathLengths::UNVISITED;
+    }
 };
 
 struct SPSinglePathsFrontierCompute : public FrontierCompute {
@@ -344,6 +361,12 @@ struct SPSinglePathsFrontierCompute : public FrontierCompute {
         }
         return retVal;
     }
+
+    bool canPull() const override { return true; }
+    bool isPullCandidate(nodeID_t nodeID) override {
+        return singlePathsFrontiers->pathLengths->getMaskValueFromNextFrontierFixedMask(
+                   nodeID.offset) == PathLengths::UNVISITED;
+    }
 };
 
 /**
@@ -412,6 +435,26 @@ public:
         localState = std::make_unique<ShortestPathsLocalState>(context, outputType);
     }
 
+    // Without a semi masker in the plan, the mask is never enabled and every node is a source.
+    static bool isSource(NodeOffsetLevelSemiMask* mask, offset_t offset) {
+        return !mask->isEnabled() || mask->isMasked(offset, offset);
+    }
+
+    // Each source runs its own BFS, which may reach the whole graph.
+    uint64_t getNumGraphScansEstimate() const override {
+        uint64_t numSources = 0;
+        for (auto& tableID : sharedState->graph->getNodeTableIDs()) {
+            if (!sharedState->inputNodeOffsetMasks.contains(tableID)) {
+                continue;
+            }
+            auto mask = sharedState->inputNodeOffsetMasks.at(tableID).get();
+            for (auto offset = 0u; offset < sharedState->graph->getNumNodes(tableID); ++offset) {
+                numSources += isSource(mask, offset);
+            }
+        }
+        return numSources;
+    }
+
     void exec(processor::ExecutionContext* executionContext) override {
         for (auto& tableID : sharedState->graph->getNodeTableIDs()) {
             if (!sharedState->inputNodeOffsetMasks.contains(tableID)) {
@@ -419,7 +462,7 @@ public:
             }
             auto mask = sharedState->inputNodeOffsetMasks.at(tableID).get();
             for (auto offset = 0u; offset < sharedState->graph->getNumNodes(tableID); ++offset) {
-                if (!mask->isMasked(offset, offset)) {
+                if (!isSource(mask, offset)) {
                     continue;
                 }
                 auto sourceNodeID = nodeID_t{offset, tableID};
@@ -1,7 +1,7 @@
 #include "binder/binder.h"
 #include "binder/expression/expression_util.h"
-#include "common/types/internal_id_util.h"
 #include "function/gds/gds_function_collection.h"
+#include "function/gds/gds_node_values.h"
 #include "function/gds_function.h"
 #include "graph/graph.h"
 #include "main/client_context.h"
@@ -29,13 +29,13 @@ public:
         vectors.push_back(groupVector.get());
     }
 
-    void materialize(graph::Graph* graph, const common::node_id_map_t<int64_t>& visitedMap,
+    void materialize(graph::Graph* graph, const GDSNodeValues<int64_t>& groupIDs,
         FactorizedTable& table) const {
         for (auto tableID : graph->getNodeTableIDs()) {
             for (auto offset = 0u; offset < graph->getNumNodes(tableID); ++offset) {
                 auto nodeID = nodeID_t{offset, tableID};
                 nodeIDVector->setValue<nodeID_t>(0, nodeID);
-                groupVector->setValue<int64_t>(0, visitedMap.at(nodeID));
+                groupVector->setValue<int64_t>(0, groupIDs.getValue(nodeID));
                 table.append(vectors);
             }
         }
@@ -49,6 +49,7 @@ private:
 
 class WeaklyConnectedComponent final : public GDSAlgorithm {
     static constexpr char GROUP_ID_COLUMN_NAME[] = "group_id";
+    static constexpr int64_t UNVISITED = -1;
 
 public:
     WeaklyConnectedComponent() = default;
@@ -91,20 +92,20 @@ public:
     void exec(processor::ExecutionContext*) override {
         auto wccLocalState = localState->ptrCast<WeaklyConnectedComponentLocalState>();
         auto graph = sharedState->graph.get();
-        visitedMap.clear();
+        auto groupIDs = GDSNodeValues<int64_t>(*graph, UNVISITED);
         auto groupID = 0;
         auto nodeTableIDs = graph->getNodeTableIDs();
         auto scanState = graph->prepareMultiTableScanFwd(nodeTableIDs);
         for (auto tableID : nodeTableIDs) {
             for (auto offset = 0u; offset < graph->getNumNodes(tableID); ++offset) {
                 auto nodeID = nodeID_t{offset, tableID};
-                if (visitedMap.contains(nodeID)) {
+                if (groupIDs.getValue(nodeID) != UNVISITED) {
                     continue;
                 }
-                findConnectedComponent(nodeID, groupID++, *scanState);
+                findConnectedComponent(nodeID, groupID++, *scanState, groupIDs);
             }
         }
-        wccLocalState->materialize(graph, visitedMap, *sharedState->fTable);
+        wccLocalState->materialize(graph, groupIDs, *sharedState->fTable);
     }
 
     std::unique_ptr<GDSAlgorithm> copy() const override {
@@ -112,21 +113,30 @@ public:
     }
 
 private:
+    // Visits the nodes reachable from nodeID with an explicit stack, since the neighbors of a node
+    // are scanned into the vectors of the scan state, which a recursive scan would overwrite.
     void findConnectedComponent(common::nodeID_t nodeID, int64_t groupID,
-        GraphScanState& scanState) {
-        KU_ASSERT(!visitedMap.contains(nodeID));
-        visitedMap.insert({nodeID, groupID});
-        auto nbrs = sharedState->graph->scanFwd(nodeID, scanState);
-        for (auto nbr : nbrs) {
-            if (visitedMap.contains(nbr)) {
-                continue;
-            }
-            findConnectedComponent(nbr, groupID, scanState);
+        GraphScanState& scanState, GDSNodeValues<int64_t>& groupIDs) {
+        KU_ASSERT(groupIDs.getValue(nodeID) == UNVISITED);
+        groupIDs.setValue(nodeID, groupID);
+        nodesToVisit.push_back(nodeID);
+        while (!nodesToVisit.empty()) {
+            auto curNodeID = nodesToVisit.back();
+            nodesToVisit.pop_back();
+            sharedState->graph->scanFwd(curNodeID, scanState, [&](const NbrChunk& chunk) {
+                chunk.forEach([&](nodeID_t nbr, sel_t) {
+                    if (groupIDs.getValue(nbr) != UNVISITED) {
+                        return;
+                    }
+                    groupIDs.setValue(nbr, groupID);
+                    nodesToVisit.push_back(nbr);
+                });
+            });
         }
     }
 
 private:
-    common::node_id_map_t<int64_t> visitedMap;
+    std::vector<common::nodeID_t> nodesToVisit;
 };
 
 function_set WeaklyConnectedComponentsFunction::getFunctionSet() {
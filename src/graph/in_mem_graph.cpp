@@ -0,0 +1,377 @@
+#include "graph/in_mem_graph.h"
+
+#include <cstring>
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/cast.h"
+#include "common/exception/runtime.h"
+#include "common/task_system/parallel_for.h"
+#include "graph/on_disk_graph.h"
+#include "main/client_context.h"
+
+using namespace kuzu::common;
+using namespace kuzu::main;
+
+namespace kuzu {
+namespace graph {
+
+InMemGraphScanState::InMemGraphScanState(const InMemGraphData& data,
+    std::vector<table_id_t> relTableIDs, bool scanEdgeProperty)
+    : relTableIDs{std::move(relTableIDs)} {
+    nbrNodeIDVectorState = std::make_shared<DataChunkState>();
+    nbrNodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID());
+    nbrNodeIDVector->state = nbrNodeIDVectorState;
+    if (!scanEdgeProperty) {
+        return;
+    }
+    KU_ASSERT(data.edgePropertyType != nullptr);
+    for (auto relTableID : this->relTableIDs) {
+        auto vector = std::make_unique<ValueVector>(data.edgePropertyType->copy());
+        vector->state = nbrNodeIDVectorState;
+        edgePropertyVectors.insert({relTableID, std::move(vector)});
+    }
+}
+
+namespace {
+
+// Appends fixed-size values to a buffer from the memory manager, which doubles whenever it is full.
+class BufferBuilder {
+public:
+    BufferBuilder(storage::MemoryManager& mm, uint64_t numBytesPerValue)
+        : mm{mm}, numBytesPerValue{numBytesPerValue} {}
+
+    void append(const uint8_t* value) {
+        const auto numBytes = numValues * numBytesPerValue;
+        if (buffer == nullptr || numBytes + numBytesPerValue > buffer->buffer.size()) {
+            grow(numBytes == 0 ? BufferPoolConstants::PAGE_256KB_SIZE : 2 * numBytes);
+        }
+        memcpy(buffer->buffer.data() + numBytes, value, numBytesPerValue);
+        numValues++;
+    }
+
+    // Returns nullptr if no value was appended. Buffers larger than a page are shrunk to fit.
+    std::unique_ptr<storage::MemoryBuffer> finish() {
+        const auto numBytes = numValues * numBytesPerValue;
+        if (numBytes > BufferPoolConstants::PAGE_256KB_SIZE && numBytes < buffer->buffer.size()) {
+            grow(numBytes);
+        }
+        return std::move(buffer);
+    }
+
+private:
+    void grow(uint64_t numBytes) {
+        auto newBuffer = mm.allocateBuffer(false /* initializeToZero */, numBytes);
+        if (buffer != nullptr) {
+            memcpy(newBuffer->buffer.data(), buffer->buffer.data(), numValues * numBytesPerValue);
+        }
+        buffer = std::move(newBuffer);
+    }
+
+private:
+    storage::MemoryManager& mm;
+    uint64_t numBytesPerValue;
+    uint64_t numValues = 0;
+    std::unique_ptr<storage::MemoryBuffer> buffer;
+};
+
+// A segment of a CSR to be projected.
+struct CSRSegmentToProject {
+    InMemCSRSegment* segment;
+    table_id_t relTableID;
+    table_id_t boundTableID;
+    table_id_t nbrTableID;
+    bool isFwd;
+    offset_t startOffset;
+    offset_t numBoundNodes;
+    bool hasEdgeProperty;
+};
+
+} // namespace
+
+static void projectCSRSegment(Graph& graph, GraphScanState& scanState,
+    storage::MemoryManager& mm, const CSRSegmentToProject& toProject,
+    uint64_t numBytesPerEdgePropertyValue) {
+    auto& segment = *toProject.segment;
+    segment.csrOffsets = mm.allocateBuffer(false /* initializeToZero */,
+        (toProject.numBoundNodes + 1) * sizeof(uint64_t));
+    auto csrOffsets = reinterpret_cast<uint64_t*>(segment.csrOffsets->buffer.data());
+    BufferBuilder nbrOffsets{mm, sizeof(offset_t)};
+    BufferBuilder edgePropertyValues{mm, numBytesPerEdgePropertyValue};
+    BufferBuilder edgePropertyNulls{mm, sizeof(uint8_t)};
+    uint64_t numNbrs = 0;
+    csrOffsets[0] = 0;
+    for (auto i = 0u; i < toProject.numBoundNodes; i++) {
+        const auto nodeID = nodeID_t{toProject.startOffset + i, toProject.boundTableID};
+        if (toProject.isFwd) {
+            graph.initScanFwd(nodeID, scanState);
+        } else {
+            graph.initScanBwd(nodeID, scanState);
+        }
+        while (const auto chunk = graph.scanNext(scanState)) {
+            chunk->forEach([&](nodeID_t nbrNodeID, sel_t idx) {
+                KU_ASSERT(nbrNodeID.tableID == toProject.nbrTableID);
+                nbrOffsets.append(reinterpret_cast<const uint8_t*>(&nbrNodeID.offset));
+                numNbrs++;
+                if (!toProject.hasEdgeProperty) {
+                    return;
+                }
+                const auto& vector = chunk->getEdgePropertyVector();
+                const auto pos = chunk->getPos(idx);
+                edgePropertyValues.append(vector.getData() + pos * numBytesPerEdgePropertyValue);
+                const uint8_t isNull = vector.isNull(pos);
+                edgePropertyNulls.append(&isNull);
+            });
+        }
+        csrOffsets[i + 1] = numNbrs;
+    }
+    segment.nbrOffsets = nbrOffsets.finish();
+    if (toProject.hasEdgeProperty) {
+        segment.edgePropertyValues = edgePropertyValues.finish();
+        segment.edgePropertyNulls = edgePropertyNulls.finish();
+    }
+}
+
+// Projects the CSRs of all rel tables in one direction. Their segments are projected in parallel.
+static void projectCSRs(ClientContext* context, InMemGraphData& data, bool isFwd) {
+    const auto& edgePropertyName = data.edgePropertyName;
+    const auto numBytesPerEdgePropertyValue =
+        data.edgePropertyType == nullptr ?
+            0 :
+            PhysicalTypeUtils::getFixedTypeSize(data.edgePropertyType->getPhysicalType());
+    // Set up all CSRs first, so that their segments can be projected in parallel.
+    std::vector<CSRSegmentToProject> segmentsToProject;
+    for (auto& info : data.relTableIDInfos) {
+        const auto boundTableID = isFwd ? info.fromNodeTableID : info.toNodeTableID;
+        // The dst node table may not be part of the graph.
+        if (!data.numNodes.contains(boundTableID)) {
+            continue;
+        }
+        auto& csrs = isFwd ? data.nodeTableIDToFwdCSRs.at(boundTableID) :
+                             data.nodeTableIDToBwdCSRs.at(boundTableID);
+        auto& csr = csrs[info.relTableID];
+        csr.nbrTableID = isFwd ? info.toNodeTableID : info.fromNodeTableID;
+        if (edgePropertyName.has_value()) {
+            auto entry =
+                context->getCatalog()->getTableCatalogEntry(context->getTx(), info.relTableID);
+            csr.hasEdgeProperty = entry->containsProperty(*edgePropertyName);
+        }
+        const auto numBoundNodes = data.numNodes.at(boundTableID);
+        csr.segments.resize(
+            (numBoundNodes + InMemCSR::SEGMENT_SIZE - 1) >> InMemCSR::SEGMENT_SIZE_LOG2);
+        for (auto i = 0u; i < csr.segments.size(); i++) {
+            const auto startOffset = i * InMemCSR::SEGMENT_SIZE;
+            segmentsToProject.push_back(CSRSegmentToProject{&csr.segments[i], info.relTableID,
+                boundTableID, csr.nbrTableID, isFwd, startOffset,
+                std::min(InMemCSR::SEGMENT_SIZE, numBoundNodes - startOffset),
+                csr.hasEdgeProperty});
+        }
+    }
+    // Each thread scans its own copy of the graph.
+    const auto numThreads =
+        std::min<uint64_t>(context->getClientConfig()->numThreads, segmentsToProject.size());
+    std::vector<std::unique_ptr<Graph>> graphs(numThreads);
+    std::vector<table_id_map_t<std::unique_ptr<GraphScanState>>> scanStates(numThreads);
+    auto mm = context->getMemoryManager();
+    parallelFor(*context->getTaskScheduler(), numThreads, segmentsToProject.size(),
+        [&](uint64_t threadIdx, uint64_t segmentIdx) {
+            const auto& toProject = segmentsToProject[segmentIdx];
+            if (graphs[threadIdx] == nullptr) {
+                graphs[threadIdx] = data.graph->copy();
+            }
+            auto& threadGraph = *graphs[threadIdx];
+            auto& threadScanStates = scanStates[threadIdx];
+            if (!threadScanStates.contains(toProject.relTableID)) {
+                // A single rel table without the edge property can't be scanned for it.
+                threadScanStates.insert({toProject.relTableID,
+                    threadGraph.prepareScan(toProject.relTableID,
+                        toProject.hasEdgeProperty ? edgePropertyName : std::nullopt)});
+            }
+            projectCSRSegment(threadGraph, *threadScanStates.at(toProject.relTableID), *mm,
+                toProject, numBytesPerEdgePropertyValue);
+        });
+}
+
+std::unique_ptr<InMemGraph> InMemGraph::project(ClientContext* context, Graph& graph,
+    const std::optional<std::string>& edgePropertyName, bool projectBwd) {
+    auto data = std::make_shared<InMemGraphData>();
+    data->context = context;
+    data->graph = graph.copy();
+    data->nodeTableIDs = graph.getNodeTableIDs();
+    data->relTableIDs = graph.getRelTableIDs();
+    for (auto tableID : data->nodeTableIDs) {
+        data->numNodes.insert({tableID, graph.getNumNodes(tableID)});
+        data->nodeTableIDToFwdCSRs.try_emplace(tableID);
+        data->nodeTableIDToBwdCSRs.try_emplace(tableID);
+    }
+    data->relTableIDInfos = graph.getRelTableIDInfos();
+    data->edgePropertyName = edgePropertyName;
+    if (edgePropertyName.has_value()) {
+        auto type = OnDiskGraph::getEdgePropertyType(context, data->relTableIDs, *edgePropertyName);
+        if (!LogicalTypeUtils::isNumerical(type)) {
+            throw RuntimeException("Cannot project edge property " + *edgePropertyName +
+                                   " of type " + type.toString() +
+                                   " in memory. Only numerical properties are supported.");
+        }
+        data->edgePropertyType = std::make_unique<LogicalType>(std::move(type));
+    }
+    projectCSRs(context, *data, true /* isFwd */);
+    auto inMemGraph = std::make_unique<InMemGraph>(std::move(data));
+    if (projectBwd) {
+        inMemGraph->prepareBwdScans();
+    }
+    return inMemGraph;
+}
+
+void InMemGraph::prepareBwdScans() {
+    if (data->hasBwdCSRs) {
+        return;
+    }
+    projectCSRs(data->context, *data, false /* isFwd */);
+    data->hasBwdCSRs = true;
+}
+
+offset_t InMemGraph::getNumNodes() {
+    offset_t numNodes = 0u;
+    for (auto& [_, numNodesInTable] : data->numNodes) {
+        numNodes += numNodesInTable;
+    }
+    return numNodes;
+}
+
+offset_t InMemGraph::getNumNodes(table_id_t id) {
+    KU_ASSERT(data->numNodes.contains(id));
+    return data->numNodes.at(id);
+}
+
+bool InMemGraph::checkEdgeProperty(const std::optional<std::string>& edgePropertyName) const {
+    if (!edgePropertyName.has_value()) {
+        return false;
+    }
+    if (edgePropertyName != data->edgePropertyName) {
+        throw RuntimeException(
+            "Edge property " + *edgePropertyName + " is not projected in the in-memory graph.");
+    }
+    return true;
+}
+
+std::unique_ptr<GraphScanState> InMemGraph::prepareScan(table_id_t relTableID,
+    const std::optional<std::string>& edgePropertyName) {
+    const auto scanEdgeProperty = checkEdgeProperty(edgePropertyName);
+    return std::unique_ptr<InMemGraphScanState>(
+        new InMemGraphScanState(*data, std::vector<table_id_t>{relTableID}, scanEdgeProperty));
+}
+
+std::unique_ptr<GraphScanState> InMemGraph::prepareMultiTableScanFwd(
+    std::span<table_id_t> nodeTableIDs, const std::optional<std::string>& edgePropertyName) {
+    return prepareMultiTableScan(data->nodeTableIDToFwdCSRs, nodeTableIDs, edgePropertyName);
+}
+
+std::unique_ptr<GraphScanState> InMemGraph::prepareMultiTableScanBwd(
+    std::span<table_id_t> nodeTableIDs, const std::optional<std::string>& edgePropertyName) {
+    if (!data->hasBwdCSRs) {
+        throw RuntimeException("Backward adjLists are not projected in the in-memory graph.");
+    }
+    return prepareMultiTableScan(data->nodeTableIDToBwdCSRs, nodeTableIDs, edgePropertyName);
+}
+
+std::unique_ptr<GraphScanState> InMemGraph::prepareMultiTableScan(
+    const table_id_map_t<table_id_map_t<InMemCSR>>& nodeTableIDToCSRs,
+    std::span<table_id_t> nodeTableIDs, const std::optional<std::string>& edgePropertyName) {
+    const auto scanEdgeProperty = checkEdgeProperty(edgePropertyName);
+    std::unordered_set<table_id_t> relTableIDSet;
+    std::vector<table_id_t> relTableIDs;
+    for (auto tableID : nodeTableIDs) {
+        for (auto& [relTableID, _] : nodeTableIDToCSRs.at(tableID)) {
+            if (!relTableIDSet.contains(relTableID)) {
+                relTableIDSet.insert(relTableID);
+                relTableIDs.push_back(relTableID);
+            }
+        }
+    }
+    return std::unique_ptr<InMemGraphScanState>(
+        new InMemGraphScanState(*data, std::move(relTableIDs), scanEdgeProperty));
+}
+
+void InMemGraph::initScanFwd(nodeID_t nodeID, GraphScanState& state) {
+    initScan(nodeID, data->nodeTableIDToFwdCSRs, state);
+}
+
+void InMemGraph::initScanBwd(nodeID_t nodeID, GraphScanState& state) {
+    if (!data->hasBwdCSRs) {
+        throw RuntimeException("Backward adjLists are not projected in the in-memory graph.");
+    }
+    initScan(nodeID, data->nodeTableIDToBwdCSRs, state);
+}
+
+void InMemGraph::initScan(nodeID_t nodeID,
+    const table_id_map_t<table_id_map_t<InMemCSR>>& nodeTableIDToCSRs, GraphScanState& state) {
+    auto& inMemScanState = ku_dynamic_cast<GraphScanState&, InMemGraphScanState&>(state);
+    KU_ASSERT(nodeTableIDToCSRs.contains(nodeID.tableID));
+    inMemScanState.boundNodeOffset = nodeID.offset;
+    inMemScanState.csrsToScan = &nodeTableIDToCSRs.at(nodeID.tableID);
+    inMemScanState.nextRelTableIdx = 0;
+    inMemScanState.csr = nullptr;
+    inMemScanState.edgePropertyVector = nullptr;
+    inMemScanState.nextNbrIdx = 0;
+    inMemScanState.endNbrIdx = 0;
+}
+
+std::optional<NbrChunk> InMemGraph::scanNext(GraphScanState& state) {
+    auto& inMemScanState = ku_dynamic_cast<GraphScanState&, InMemGraphScanState&>(state);
+    while (inMemScanState.nextNbrIdx == inMemScanState.endNbrIdx) {
+        // Move on to the next rel table connected to the bound node.
+        auto& relTableIDs = inMemScanState.relTableIDs;
+        auto& csrs = *inMemScanState.csrsToScan;
+        while (inMemScanState.nextRelTableIdx < relTableIDs.size() &&
+               !csrs.contains(relTableIDs[inMemScanState.nextRelTableIdx])) {
+            inMemScanState.nextRelTableIdx++;
+        }
+        if (inMemScanState.nextRelTableIdx == relTableIDs.size()) {
+            return std::nullopt;
+        }
+        const auto relTableID = relTableIDs[inMemScanState.nextRelTableIdx++];
+        const auto& csr = csrs.at(relTableID);
+        const auto boundNodeOffset = inMemScanState.boundNodeOffset;
+        const auto& segment = csr.getSegment(boundNodeOffset);
+        const auto offsetInSegment = boundNodeOffset & (InMemCSR::SEGMENT_SIZE - 1);
+        inMemScanState.csr = &csr;
+        inMemScanState.segment = &segment;
+        inMemScanState.edgePropertyVector =
+            inMemScanState.edgePropertyVectors.empty() ?
+                nullptr :
+                inMemScanState.edgePropertyVectors.at(relTableID).get();
+        inMemScanState.nextNbrIdx = segment.getCSROffsets()[offsetInSegment];
+        inMemScanState.endNbrIdx = segment.getCSROffsets()[offsetInSegment + 1];
+    }
+    const auto& csr = *inMemScanState.csr;
+    const auto& segment = *inMemScanState.segment;
+    const auto startNbrIdx = inMemScanState.nextNbrIdx;
+    const auto numNbrs =
+        std::min<uint64_t>(inMemScanState.endNbrIdx - startNbrIdx, DEFAULT_VECTOR_CAPACITY);
+    auto nbrNodeIDs = reinterpret_cast<nodeID_t*>(inMemScanState.nbrNodeIDVector->getData());
+    const auto nbrOffsets = segment.getNbrOffsets() + startNbrIdx;
+    for (auto i = 0u; i < numNbrs; i++) {
+        nbrNodeIDs[i] = nodeID_t{nbrOffsets[i], csr.nbrTableID};
+    }
+    const auto edgePropertyVector = inMemScanState.edgePropertyVector;
+    if (edgePropertyVector && csr.hasEdgeProperty) {
+        const auto numBytesPerValue = edgePropertyVector->getNumBytesPerValue();
+        memcpy(edgePropertyVector->getData(),
+            segment.edgePropertyValues->buffer.data() + startNbrIdx * numBytesPerValue,
+            numNbrs * numBytesPerValue);
+        const auto nulls = segment.edgePropertyNulls->buffer.data() + startNbrIdx;
+        for (auto i = 0u; i < numNbrs; i++) {
+            edgePropertyVector->setNull(i, nulls[i]);
+        }
+    } else if (edgePropertyVector) {
+        // The rel table does not have the edge property.
+        edgePropertyVector->setAllNull();
+    }
+    inMemScanState.nbrNodeIDVectorState->getSelVectorUnsafe().setToUnfiltered(numNbrs);
+    inMemScanState.nextNbrIdx += numNbrs;
+    return NbrChunk(inMemScanState.nbrNodeIDVector.get(), edgePropertyVector);
+}
+
+} // namespace graph
+} // namespace kuzu
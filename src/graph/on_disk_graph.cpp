@@ -2,52 +2,106 @@
 
 #include <memory>
 
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/assert.h"
+#include "common/cast.h"
+#include "common/exception/runtime.h"
 #include "common/vector/value_vector.h"
 #include "graph/graph.h"
 #include "main/client_context.h"
+#include "storage/local_storage/local_rel_table.h"
+#include "storage/local_storage/local_storage.h"
 #include "storage/storage_manager.h"
 #include "storage/store/rel_table.h"
+#include "transaction/transaction.h"
 
 using namespace kuzu::catalog;
 using namespace kuzu::storage;
 using namespace kuzu::main;
 using namespace kuzu::common;
+using namespace kuzu::transaction;
 
 namespace kuzu {
 namespace graph {
 
-static std::unique_ptr<RelTableScanState> getRelScanState(RelDataDirection direction,
-    ValueVector* srcVector, ValueVector* dstVector) {
-    // Empty columnIDs since we do not scan any rel property.
-    auto columnIDs = std::vector<column_id_t>{};
-    auto columns = std::vector<Column*>{};
-    // TODO(Guodong): FIX-ME.
-    auto scanState =
-        std::make_unique<RelTableScanState>(columnIDs, columns, nullptr, nullptr, direction);
+static std::unique_ptr<RelTableScanState> getRelScanState(Transaction* transaction,
+    RelTable& relTable, RelDataDirection direction, column_id_t edgePropertyColumnID,
+    ValueVector* srcVector, ValueVector* dstVector, ValueVector* edgePropertyVector) {
+    std::vector<column_id_t> columnIDs = {NBR_ID_COLUMN_ID};
+    std::vector<Column*> columns = {relTable.getColumn(NBR_ID_COLUMN_ID, direction)};
+    std::vector<ValueVector*> outputVectors = {dstVector};
+    if (edgePropertyVector) {
+        columnIDs.push_back(edgePropertyColumnID);
+        columns.push_back(edgePropertyColumnID == INVALID_COLUMN_ID ?
+                              nullptr :
+                              relTable.getColumn(edgePropertyColumnID, direction));
+        outputVectors.push_back(edgePropertyVector);
+    }
+    auto scanState = std::make_unique<RelTableScanState>(columnIDs, columns,
+        relTable.getCSROffsetColumn(direction), relTable.getCSRLengthColumn(direction), direction);
     scanState->boundNodeIDVector = srcVector;
-    scanState->outputVectors.push_back(dstVector);
+    scanState->IDVector = dstVector;
+    scanState->outputVectors = std::move(outputVectors);
+    scanState->rowIdxVector->state = dstVector->state;
+    if (const auto localRelTable = transaction->getLocalStorage()->getLocalTable(
+            relTable.getTableID(), LocalStorage::NotExistAction::RETURN_NULL)) {
+        auto localTableColumnIDs =
+            LocalRelTable::rewriteLocalColumnIDs(direction, scanState->columnIDs);
+        scanState->localTableScanState = std::make_unique<LocalRelTableScanState>(*scanState,
+            localTableColumnIDs, localRelTable->ptrCast<LocalRelTable>());
+        scanState->localTableScanState->rowIdxVector->state = dstVector->state;
+    }
     return scanState;
 }
 
-OnDiskGraphScanState::OnDiskGraphScanState(ValueVector* srcNodeIDVector,
-    ValueVector* dstNodeIDVector) {
-    fwdScanState = getRelScanState(RelDataDirection::FWD, srcNodeIDVector, dstNodeIDVector);
-    bwdScanState = getRelScanState(RelDataDirection::BWD, srcNodeIDVector, dstNodeIDVector);
+OnDiskGraphScanState::OnDiskGraphScanState(ClientContext* context, RelTable& relTable,
+    ValueVector* srcNodeIDVector, ValueVector* dstNodeIDVector,
+    const std::optional<std::string>& edgePropertyName, const LogicalType* edgePropertyType) {
+    auto transaction = context->getTx();
+    auto edgePropertyColumnID = INVALID_COLUMN_ID;
+    if (edgePropertyType != nullptr) {
+        KU_ASSERT(edgePropertyName.has_value());
+        auto entry = context->getCatalog()->getTableCatalogEntry(transaction, relTable.getTableID());
+        if (entry->containsProperty(*edgePropertyName)) {
+            edgePropertyColumnID = entry->getColumnID(*edgePropertyName);
+        }
+        edgePropertyVector =
+            std::make_unique<ValueVector>(edgePropertyType->copy(), context->getMemoryManager());
+        edgePropertyVector->state = dstNodeIDVector->state;
+        if (edgePropertyColumnID == INVALID_COLUMN_ID) {
+            edgePropertyVector->setAllNull();
+        }
+    }
+    fwdScanState = getRelScanState(transaction, relTable, RelDataDirection::FWD,
+        edgePropertyColumnID, srcNodeIDVector, dstNodeIDVector, edgePropertyVector.get());
+    bwdScanState = getRelScanState(transaction, relTable, RelDataDirection::BWD,
+        edgePropertyColumnID, srcNodeIDVector, dstNodeIDVector, edgePropertyVector.get());
 }
 
-OnDiskGraphScanStates::OnDiskGraphScanStates(std::span<table_id_t> tableIDs, MemoryManager* mm) {
-    scanStates.reserve(tableIDs.size());
+OnDiskGraphScanStates::OnDiskGraphScanStates(ClientContext* context,
+    std::span<RelTable*> relTables, const std::optional<std::string>& edgePropertyName) {
+    auto mm = context->getMemoryManager();
+    scanStates.reserve(relTables.size());
     srcNodeIDVectorState = DataChunkState::getSingleValueDataChunkState();
     dstNodeIDVectorState = std::make_shared<DataChunkState>();
     srcNodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
     srcNodeIDVector->state = srcNodeIDVectorState;
     dstNodeIDVector = std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
     dstNodeIDVector->state = dstNodeIDVectorState;
-
-    for (auto tableID : tableIDs) {
-        scanStates.emplace_back(std::make_pair(tableID,
-            OnDiskGraphScanState(srcNodeIDVector.get(), dstNodeIDVector.get())));
+    std::unique_ptr<LogicalType> edgePropertyType;
+    if (edgePropertyName.has_value()) {
+        std::vector<table_id_t> relTableIDs;
+        for (auto relTable : relTables) {
+            relTableIDs.push_back(relTable->getTableID());
+        }
+        edgePropertyType = std::make_unique<LogicalType>(
+            OnDiskGraph::getEdgePropertyType(context, relTableIDs, *edgePropertyName));
+    }
+    for (auto relTable : relTables) {
+        scanStates.emplace_back(relTable->getTableID(),
+            OnDiskGraphScanState(context, *relTable, srcNodeIDVector.get(), dstNodeIDVector.get(),
+                edgePropertyName, edgePropertyType.get()));
     }
 }
 
@@ -116,127 +170,120 @@ std::vector<RelTableIDInfo> OnDiskGraph::getRelTableIDInfos() {
     return result;
 }
 
-std::unique_ptr<GraphScanState> OnDiskGraph::prepareScan(table_id_t relTableID) {
+std::unique_ptr<GraphScanState> OnDiskGraph::prepareScan(table_id_t relTableID,
+    const std::optional<std::string>& edgePropertyName) {
+    auto relTable = context->getStorageManager()->getTable(relTableID)->ptrCast<RelTable>();
     return std::unique_ptr<OnDiskGraphScanStates>(
-        new OnDiskGraphScanStates(std::span(&relTableID, 1), context->getMemoryManager()));
+        new OnDiskGraphScanStates(context, std::span(&relTable, 1), edgePropertyName));
 }
 
 std::unique_ptr<GraphScanState> OnDiskGraph::prepareMultiTableScanFwd(
-    std::span<table_id_t> nodeTableIDs) {
+    std::span<table_id_t> nodeTableIDs, const std::optional<std::string>& edgePropertyName) {
+    return prepareMultiTableScan(nodeTableIDToFwdRelTables, nodeTableIDs, edgePropertyName);
+}
+
+std::unique_ptr<GraphScanState> OnDiskGraph::prepareMultiTableScanBwd(
+    std::span<table_id_t> nodeTableIDs, const std::optional<std::string>& edgePropertyName) {
+    return prepareMultiTableScan(nodeTableIDToBwdRelTables, nodeTableIDs, edgePropertyName);
+}
+
+std::unique_ptr<GraphScanState> OnDiskGraph::prepareMultiTableScan(
+    const table_id_map_t<table_id_map_t<RelTable*>>& nodeTableIDToRelTables,
+    std::span<table_id_t> nodeTableIDs, const std::optional<std::string>& edgePropertyName) {
     std::unordered_set<table_id_t> relTableIDSet;
-    std::vector<table_id_t> relTableIDs;
+    std::vector<RelTable*> relTables;
     for (auto tableID : nodeTableIDs) {
-        auto& relTables = nodeTableIDToFwdRelTables.at(tableID);
-        for (auto& [tableID, _] : relTables) {
-            if (!relTableIDSet.contains(tableID)) {
-                relTableIDSet.insert(tableID);
-                relTableIDs.push_back(tableID);
+        for (auto& [relTableID, relTable] : nodeTableIDToRelTables.at(tableID)) {
+            if (!relTableIDSet.contains(relTableID)) {
+                relTableIDSet.insert(relTableID);
+                relTables.push_back(relTable);
             }
         }
     }
     return std::unique_ptr<OnDiskGraphScanStates>(
-        new OnDiskGraphScanStates(std::span(relTableIDs), context->getMemoryManager()));
+        new OnDiskGraphScanStates(context, std::span(relTables), edgePropertyName));
 }
 
-std::unique_ptr<GraphScanState> OnDiskGraph::prepareMultiTableScanBwd(
-    std::span<table_id_t> nodeTableIDs) {
-    std::unordered_set<table_id_t> relTableIDSet;
-    std::vector<table_id_t> relTableIDs;
-    for (auto tableID : nodeTableIDs) {
-        auto& relTables = nodeTableIDToBwdRelTables.at(tableID);
-        for (auto& [tableID, _] : relTables) {
-            if (!relTableIDSet.contains(tableID)) {
-                relTableIDSet.insert(tableID);
-                relTableIDs.push_back(tableID);
-            }
+LogicalType OnDiskGraph::getEdgePropertyType(ClientContext* context,
+    std::span<const table_id_t> relTableIDs, const std::string& edgePropertyName) {
+    std::unique_ptr<LogicalType> type;
+    for (auto relTableID : relTableIDs) {
+        auto entry = context->getCatalog()->getTableCatalogEntry(context->getTx(), relTableID);
+        if (!entry->containsProperty(edgePropertyName)) {
+            continue;
+        }
+        auto& propertyType = entry->getProperty(edgePropertyName).getType();
+        if (type == nullptr) {
+            type = std::make_unique<LogicalType>(propertyType.copy());
+        } else if (*type != propertyType) {
+            throw RuntimeException("Edge property " + edgePropertyName +
+                                   " has different types in the rel tables of the graph: " +
+                                   type->toString() + " and " + propertyType.toString() + ".");
         }
     }
-    return std::unique_ptr<OnDiskGraphScanStates>(
-        new OnDiskGraphScanStates(std::span(relTableIDs), context->getMemoryManager()));
-}
-
-std::vector<nodeID_t> OnDiskGraph::scanFwd(nodeID_t, GraphScanState&) {
-    // auto& onDiskScanState = ku_dynamic_cast<GraphScanState&, OnDiskGraphScanStates&>(state);
-    // KU_ASSERT(nodeTableIDToFwdRelTables.contains(nodeID.tableID));
-    // auto& relTables = nodeTableIDToFwdRelTables.at(nodeID.tableID);
-    std::vector<nodeID_t> result;
-    // for (auto& [tableID, scanState] : onDiskScanState.scanStates) {
-    //     ku_dynamic_cast<TableDataScanState*, RelDataReadState*>(
-    //         scanState.fwdScanState->dataScanState.get())
-    //         ->randomAccess = false;
-    //     auto relTablePair = relTables.find(tableID);
-    //     if (relTablePair != relTables.end()) {
-    //         scan(nodeID, relTablePair->second, onDiskScanState, *scanState.fwdScanState, result);
-    //     }
-    // }
-    return result;
+    if (type == nullptr) {
+        throw RuntimeException(
+            "None of the rel tables of the graph has the edge property " + edgePropertyName + ".");
+    }
+    return type->copy();
 }
 
-std::vector<nodeID_t> OnDiskGraph::scanFwdRandom(nodeID_t, GraphScanState&) {
-    // auto& onDiskScanState = ku_dynamic_cast<GraphScanState&, OnDiskGraphScanStates&>(state);
-    // KU_ASSERT(nodeTableIDToFwdRelTables.contains(nodeID.tableID));
-    // auto& relTables = nodeTableIDToFwdRelTables.at(nodeID.tableID);
-    std::vector<nodeID_t> result;
-    // for (auto& [tableID, scanState] : onDiskScanState.scanStates) {
-    //     ku_dynamic_cast<TableDataScanState*, RelDataReadState*>(
-    //         scanState.fwdScanState->dataScanState.get())
-    //         ->randomAccess = true;
-    //     auto relTablePair = relTables.find(tableID);
-    //     if (relTablePair != relTables.end()) {
-    //         scan(nodeID, relTablePair->second, onDiskScanState, *scanState.fwdScanState, result);
-    //     }
-    // }
-    return result;
+void OnDiskGraph::initScanFwd(nodeID_t nodeID, GraphScanState& state) {
+    KU_ASSERT(nodeTableIDToFwdRelTables.contains(nodeID.tableID));
+    initScan(nodeID, RelDataDirection::FWD, nodeTableIDToFwdRelTables.at(nodeID.tableID), state);
 }
 
-std::vector<nodeID_t> OnDiskGraph::scanBwd(nodeID_t, GraphScanState&) {
-    // auto& onDiskScanState = ku_dynamic_cast<GraphScanState&, OnDiskGraphScanStates&>(state);
-    // KU_ASSERT(nodeTableIDToBwdRelTables.contains(nodeID.tableID));
-    // auto& relTables = nodeTableIDToBwdRelTables.at(nodeID.tableID);
-    std::vector<nodeID_t> result;
-    // for (auto& [tableID, scanState] : onDiskScanState.scanStates) {
-    //     ku_dynamic_cast<TableDataScanState*, RelDataReadState*>(
-    //         scanState.bwdScanState->dataScanState.get())
-    //         ->randomAccess = false;
-    //     auto relTablePair = relTables.find(tableID);
-    //     if (relTablePair != relTables.end()) {
-    //         scan(nodeID, relTablePair->second, onDiskScanState, *scanState.bwdScanState, result);
-    //     }
-    // }
-    return result;
+void OnDiskGraph::initScanBwd(nodeID_t nodeID, GraphScanState& state) {
+    KU_ASSERT(nodeTableIDToBwdRelTables.contains(nodeID.tableID));
+    initScan(nodeID, RelDataDirection::BWD, nodeTableIDToBwdRelTables.at(nodeID.tableID), state);
 }
 
-std::vector<nodeID_t> OnDiskGraph::scanBwdRandom(nodeID_t, GraphScanState&) {
-    // auto& onDiskScanState = ku_dynamic_cast<GraphScanState&, OnDiskGraphScanStates&>(state);
-    // KU_ASSERT(nodeTableIDToBwdRelTables.contains(nodeID.tableID));
-    // auto& relTables = nodeTableIDToBwdRelTables.at(nodeID.tableID);
-    std::vector<nodeID_t> result;
-    // for (auto& [tableID, scanState] : onDiskScanState.scanStates) {
-    //     ku_dynamic_cast<TableDataScanState*, RelDataReadState*>(
-    //         scanState.bwdScanState->dataScanState.get())
-    //         ->randomAccess = true;
-    //     auto relTablePair = relTables.find(tableID);
-    //     if (relTablePair != relTables.end()) {
-    //         scan(nodeID, relTablePair->second, onDiskScanState, *scanState.bwdScanState, result);
-    //     }
-    // }
-    return result;
+void OnDiskGraph::initScan(nodeID_t nodeID, RelDataDirection direction,
+    const table_id_map_t<RelTable*>& relTables, GraphScanState& state) {
+    auto& onDiskScanState = ku_dynamic_cast<GraphScanState&, OnDiskGraphScanStates&>(state);
+    onDiskScanState.srcNodeIDVector->setValue<nodeID_t>(0, nodeID);
+    onDiskScanState.direction = direction;
+    onDiskScanState.relTablesToScan = &relTables;
+    onDiskScanState.nextScanStateIdx = 0;
+    onDiskScanState.relTable = nullptr;
+    onDiskScanState.scanState = nullptr;
 }
 
-void OnDiskGraph::scan(nodeID_t nodeID, RelTable* relTable, OnDiskGraphScanStates& scanState,
-    RelTableScanState& relTableScanState, std::vector<nodeID_t>& nbrNodeIDs) {
-    scanState.srcNodeIDVector->setValue<nodeID_t>(0, nodeID);
-    relTableScanState.resetState();
-    relTable->initializeScanState(context->getTx(), relTableScanState);
-    while (relTableScanState.source != TableScanSource::NONE &&
-           relTable->scan(context->getTx(), relTableScanState)) {
-        if (relTableScanState.IDVector->state->getSelVector().getSelSize() > 0) {
-            for (auto i = 0u; i < relTableScanState.IDVector->state->getSelVector().getSelSize();
-                 ++i) {
-                auto nbrID = relTableScanState.IDVector->getValue<nodeID_t>(i);
-                nbrNodeIDs.push_back(nbrID);
+std::optional<NbrChunk> OnDiskGraph::scanNext(GraphScanState& state) {
+    auto& onDiskScanState = ku_dynamic_cast<GraphScanState&, OnDiskGraphScanStates&>(state);
+    auto transaction = context->getTx();
+    while (true) {
+        if (onDiskScanState.relTable != nullptr) {
+            auto& scanState = *onDiskScanState.scanState;
+            auto& relTableScanState = onDiskScanState.direction == RelDataDirection::FWD ?
+                                          *scanState.fwdScanState :
+                                          *scanState.bwdScanState;
+            while (relTableScanState.source != TableScanSource::NONE &&
+                   onDiskScanState.relTable->scan(transaction, relTableScanState)) {
+                if (onDiskScanState.dstNodeIDVectorState->getSelVector().getSelSize() > 0) {
+                    return NbrChunk(onDiskScanState.dstNodeIDVector.get(),
+                        scanState.edgePropertyVector.get());
+                }
             }
+            onDiskScanState.relTable = nullptr;
+        }
+        // Move on to the next rel table connected to the bound node.
+        auto& scanStates = onDiskScanState.scanStates;
+        auto& relTables = *onDiskScanState.relTablesToScan;
+        while (onDiskScanState.nextScanStateIdx < scanStates.size() &&
+               !relTables.contains(scanStates[onDiskScanState.nextScanStateIdx].first)) {
+            onDiskScanState.nextScanStateIdx++;
+        }
+        if (onDiskScanState.nextScanStateIdx == scanStates.size()) {
+            return std::nullopt;
         }
+        auto& [relTableID, scanState] = scanStates[onDiskScanState.nextScanStateIdx++];
+        onDiskScanState.relTable = relTables.at(relTableID);
+        onDiskScanState.scanState = &scanState;
+        auto& relTableScanState = onDiskScanState.direction == RelDataDirection::FWD ?
+                                      *scanState.fwdScanState :
+                                      *scanState.bwdScanState;
+        onDiskScanState.relTable->initializeScanState(transaction, relTableScanState);
     }
 }
 
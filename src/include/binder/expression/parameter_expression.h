@@ -10,13 +10,16 @@ class ParameterExpression : public Expression {
     static constexpr common::ExpressionType expressionType = common::ExpressionType::PARAMETER;
 
 public:
-    explicit ParameterExpression(const std::string& parameterName, common::Value value)
-        : Expression{expressionType, value.getDataType().copy(), createUniqueName(parameterName)},
+    // The value is shared with the parameter map of the prepared statement, so plans holding the
+    // expression see the values bound to the parameter by later executions.
+    explicit ParameterExpression(const std::string& parameterName,
+        std::shared_ptr<common::Value> value)
+        : Expression{expressionType, value->getDataType().copy(), createUniqueName(parameterName)},
           parameterName(parameterName), value{std::move(value)} {}
 
     void cast(const common::LogicalType& type) override;
 
-    common::Value getValue() const { return value; }
+    common::Value getValue() const;
 
 private:
     std::string toStringInternal() const final { return "$" + parameterName; }
@@ -24,7 +27,7 @@ private:
 
 private:
     std::string parameterName;
-    common::Value value;
+    std::shared_ptr<common::Value> value;
 };
 
 } // namespace binder
@@ -144,6 +144,10 @@ public:
 
     void checkpoint(const std::string& databasePath, common::VirtualFileSystem* fs) const;
 
+    // Changes whenever any entry of the catalog changes. Plans bound against the catalog are only
+    // reused as long as its version stays the same.
+    uint64_t getVersion() const;
+
     template<class TARGET>
     TARGET* ptrCast() {
         return common::ku_dynamic_cast<Catalog*, TARGET*>(this);
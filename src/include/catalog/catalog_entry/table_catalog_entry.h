@@ -8,6 +8,7 @@
 #include "catalog/property_definition_collection.h"
 #include "common/enums/table_type.h"
 #include "function/table_functions.h"
+#include "storage/stats/table_stats.h"
 
 namespace kuzu {
 namespace binder {
@@ -62,6 +63,10 @@ public:
     void dropProperty(const std::string& propertyName);
     void renameProperty(const std::string& propertyName, const std::string& newName);
 
+    // Stats persisted by the last checkpoint. Storage keeps the up-to-date stats of the table.
+    const storage::TableStats& getStats() const { return stats; }
+    void setStats(storage::TableStats newStats) { stats = std::move(newStats); }
+
     void serialize(common::Serializer& serializer) const override;
     static std::unique_ptr<TableCatalogEntry> deserialize(common::Deserializer& deserializer,
         CatalogEntryType type);
@@ -80,6 +85,7 @@ protected:
     std::string comment;
     PropertyDefinitionCollection propertyCollection;
     std::unique_ptr<binder::BoundAlterInfo> alterInfo;
+    storage::TableStats stats;
 };
 
 struct TableCatalogEntryHasher {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <mutex>
 
@@ -39,6 +40,10 @@ public:
         const std::function<void(CatalogEntry*)>& func);
     CatalogEntry* getEntryOfOID(const transaction::Transaction* transaction, common::oid_t oid);
 
+    // Changes whenever an entry is created, dropped or altered, and when such a change is committed
+    // or rolled back.
+    uint64_t getVersion() const { return version.load(); }
+
     void serialize(common::Serializer serializer) const;
     static std::unique_ptr<CatalogSet> deserialize(common::Deserializer& deserializer);
 
@@ -59,6 +64,7 @@ private:
 
     void emplaceNoLock(std::unique_ptr<CatalogEntry> entry);
     void eraseNoLock(const std::string& name);
+    void incrementVersion() { version.fetch_add(1); }
 
     static std::unique_ptr<CatalogEntry> createDummyEntryNoLock(std::string name,
         common::oid_t oid);
@@ -70,6 +76,7 @@ private:
 private:
     std::mutex mtx;
     common::oid_t nextOID = 0;
+    std::atomic<uint64_t> version = 0;
     common::case_insensitive_map_t<std::unique_ptr<CatalogEntry>> entries;
 };
 
@@ -72,6 +72,13 @@ private:
     template<LogicalTypeID DT>
     static ArrowArray* templateCreateArray(ArrowVector& vector, const LogicalType& type);
 
+    // Results whose columns all have a layout Arrow can copy from are appended column by column
+    // straight from the memory of the factorized table, without materializing values.
+    static bool canAppendColumnar(const LogicalType& type);
+    std::int64_t appendColumnar(main::QueryResult& queryResult, std::int64_t chunkSize);
+    static void appendFlatTupleRun(ArrowVector* vector, const LogicalType& type,
+        const processor::FlatTupleRun& run, uint32_t colIdx);
+
     ArrowArray toArray();
 
 private:
@@ -71,6 +71,13 @@ struct BufferPoolConstants {
     // `removeNonEvictableCandidates` to remove candidates that are not evictable. See
     // `EvictionQueue::removeNonEvictableCandidates()` for more details.
     static constexpr uint64_t EVICTION_QUEUE_PURGING_INTERVAL = 1024;
+    // Under the TWO_QUEUE eviction policy, the protected queue may hold up to this ratio of the
+    // eviction queue capacity before the BM evicts from it ahead of the probationary queue.
+    static constexpr double PROTECTED_QUEUE_RATIO = 0.8;
+    // Memory buffers spilled to disk keep their 256KB frames, so the virtual memory region of the
+    // 256KB frames is this many times as large as the buffer pool. It holds at least one frame
+    // group for each of the two 256KB file handles of the memory manager.
+    static constexpr uint64_t MAX_SPILLED_TO_BUFFER_POOL_SIZE_RATIO = 8;
 // The default max size for a VMRegion.
 #ifdef __32BIT__
     static constexpr uint64_t DEFAULT_VM_REGION_MAX_SIZE = (uint64_t)1 << 30; // (1GB)
@@ -92,6 +99,7 @@ struct StorageConstants {
     static constexpr char METADATA_FILE_NAME[] = "metadata.kz";
     static constexpr char METADATA_FILE_NAME_FOR_WAL[] = "metadata.shadow";
     static constexpr char LOCK_FILE_NAME[] = ".lock";
+    static constexpr char SPILL_FILE_NAME[] = ".spill";
 
     // The number of pages that we add at one time when we need to grow a file.
     static constexpr uint64_t PAGE_GROUP_SIZE_LOG2 = 10;
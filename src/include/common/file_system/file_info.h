@@ -31,6 +31,8 @@ struct KUZU_API FileInfo {
 
     void truncate(uint64_t size);
 
+    void prefetch(uint64_t position, uint64_t numBytes);
+
     template<class TARGET>
     TARGET* ptrCast() {
         return common::ku_dynamic_cast<FileInfo*, TARGET*>(this);
@@ -76,6 +76,11 @@ protected:
     virtual void truncate(FileInfo& fileInfo, uint64_t size) const;
 
     virtual uint64_t getFileSize(const FileInfo& fileInfo) const = 0;
+
+    // Hints that the given range of the file is going to be read soon. File systems that can't
+    // read ahead asynchronously simply ignore the hint.
+    virtual void prefetch(FileInfo& /*fileInfo*/, uint64_t /*position*/,
+        uint64_t /*numBytes*/) const {}
 };
 
 } // namespace common
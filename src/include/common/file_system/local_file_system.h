@@ -64,6 +64,8 @@ protected:
     void truncate(FileInfo& fileInfo, uint64_t size) const override;
 
     uint64_t getFileSize(const FileInfo& fileInfo) const override;
+
+    void prefetch(FileInfo& fileInfo, uint64_t position, uint64_t numBytes) const override;
 };
 
 } // namespace common
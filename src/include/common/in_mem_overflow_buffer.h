@@ -50,6 +50,12 @@ public:
     // they will error.
     void resetBuffer();
 
+    void pin();
+    void unpin();
+
+    // Number of bytes of all blocks allocated so far.
+    uint64_t getMemoryUsage() const;
+
 private:
     bool requireNewBlock(uint64_t sizeToAllocate) {
         return currentBlock == nullptr ||
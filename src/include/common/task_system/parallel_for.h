@@ -0,0 +1,57 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#include "common/task_system/task_scheduler.h"
+
+namespace kuzu {
+namespace common {
+
+// Runs func(threadIdx, itemIdx) for each item in [0, numItems) with up to numThreads threads.
+// Threads grab items one at a time, and each thread that joins gets its own threadIdx in
+// [0, numThreads).
+template<typename FUNC>
+class ParallelForTask final : public Task {
+public:
+    ParallelForTask(uint64_t numThreads, uint64_t numItems, FUNC& func)
+        : Task{numThreads}, numItems{numItems}, nextThreadIdx{0}, nextItemIdx{0}, func{func} {}
+
+    void run() override {
+        const auto threadIdx = nextThreadIdx.fetch_add(1);
+        try {
+            for (auto itemIdx = nextItemIdx.fetch_add(1); itemIdx < numItems;
+                 itemIdx = nextItemIdx.fetch_add(1)) {
+                func(threadIdx, itemIdx);
+            }
+        } catch (...) {
+            // Skip the remaining items.
+            nextItemIdx.store(numItems);
+            throw;
+        }
+    }
+
+private:
+    uint64_t numItems;
+    std::atomic<uint64_t> nextThreadIdx;
+    std::atomic<uint64_t> nextItemIdx;
+    FUNC& func;
+};
+
+// Runs func(threadIdx, itemIdx) for each item in [0, numItems) on the calling thread and on up to
+// numThreads - 1 workers of the task scheduler that are idle or become idle meanwhile. This is
+// meant for operators that have to parallelize work in their finalize step, which runs outside
+// of the task scheduler's pipelines. As the calling thread works on the items itself, this never
+// waits for busy workers. If func throws, the remaining items are skipped and the first exception
+// is rethrown.
+template<typename FUNC>
+void parallelFor(TaskScheduler& taskScheduler, uint64_t numThreads, uint64_t numItems,
+    FUNC&& func) {
+    auto task =
+        std::make_shared<ParallelForTask<FUNC>>(std::max<uint64_t>(numThreads, 1), numItems, func);
+    taskScheduler.runTaskAndWaitOrError(task);
+}
+
+} // namespace common
+} // namespace kuzu
@@ -31,10 +31,10 @@ public:
     virtual ~Task() = default;
     virtual void run() = 0;
     //     This function is called from inside deRegisterThreadAndFinalizeTaskIfNecessary() only
-    //     once by the last registered worker that is completing this task. So the task lock is
-    //     already acquired. So do not attempt to acquire the task lock inside. If needed we can
-    //     make the deregister function release the lock before calling finalize and drop this
-    //     assumption.
+    //     once by the last registered worker that is completing this task. The task lock is
+    //     released while it runs, so finalizing can schedule and wait for other tasks. No other
+    //     thread can register to the task by then, and the task only counts as completed once
+    //     this function returns.
     virtual void finalizeIfNecessary() {};
 
     void addChildTask(std::unique_ptr<Task> child) {
@@ -48,10 +48,15 @@ public:
     }
 
     inline bool isCompletedNoLock() const {
-        return (numThreadsRegistered > 0 && numThreadsFinished == numThreadsRegistered);
+        return (numThreadsRegistered > 0 && numThreadsFinished == numThreadsRegistered &&
+                !finalizing);
     }
 
     inline void setSingleThreadedTask() { maxNumThreads = 1; }
+    uint64_t getMaxNumThreads() const { return maxNumThreads; }
+
+    void setMaxNumConcurrentChildren(uint64_t num) { maxNumConcurrentChildren = num; }
+    uint64_t getMaxNumConcurrentChildren() const { return maxNumConcurrentChildren; }
 
     bool registerThread();
 
@@ -94,6 +99,12 @@ protected:
     std::mutex mtx;
     std::condition_variable cv;
     uint64_t maxNumThreads, numThreadsFinished{0}, numThreadsRegistered{0};
+    // Set while the last finished thread runs finalizeIfNecessary().
+    bool finalizing{false};
+    // Children only depend on their own children, so the scheduler may run up to this many of them
+    // at the same time. Users should only raise it if the children have no side effects on each
+    // other.
+    uint64_t maxNumConcurrentChildren{1};
     std::exception_ptr exceptionsPtr = nullptr;
     uint64_t ID;
 };
@@ -31,8 +31,13 @@ struct ScheduledTask {
  * one of the threads working on T that errored. This is simply done by the call:
  *      scheduleTaskAndWaitOrError(T);
  *
- * TaskScheduler guarantees that workers will register themselves to tasks in FIFO order. However
- * this does not guarantee that the tasks will be completed in FIFO order: a long running task
+ * Workers share threads fairly across concurrently scheduled tasks: an idle worker registers
+ * itself to the task that accepts more registration and currently has the fewest registered
+ * workers, breaking ties in FIFO order. So a long running task that keeps accepting registration
+ * (e.g., a large scan from one query) does not absorb all idle workers while short tasks from other
+ * queries wait behind it. Within a task, the registered workers already share work at the morsel
+ * level, as each of them grabs the next morsel from the task's shared state.
+ * This does not guarantee that the tasks will be completed in FIFO order: a long running task
  * that is not accepting more registration can stay in the queue for an unlimited time until
  * completion.
  */
@@ -41,22 +46,41 @@ public:
     explicit TaskScheduler(uint64_t numWorkerThreads);
     ~TaskScheduler();
 
-    // Schedules the dependencies of the given task and finally the task one after another (so
-    // not concurrently), and throws an exception if any of the tasks errors. Regardless of
+    // Schedules the dependencies of the given task and finally the task, and throws an exception
+    // if any of the tasks errors. Up to task->getMaxNumConcurrentChildren() dependencies are
+    // scheduled concurrently, otherwise they are scheduled one after another. Regardless of
     // whether or not the given task or one of its dependencies errors, when this function
     // returns, no task related to the given task will be in the task queue. Further no worker
     // thread will be working on the given task.
     void scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
         processor::ExecutionContext* context, bool launchNewWorkerThread = false);
 
+    // Like scheduleTaskAndWaitOrError(), except that the given task itself only runs on the calling
+    // thread. This is for tasks that can block for long, e.g., on the consumer of a streamed query
+    // result, which must not hold up the worker threads shared by all queries. The dependencies of
+    // the task still run on the workers.
+    void scheduleTaskOnCallingThreadAndWaitOrError(const std::shared_ptr<Task>& task,
+        processor::ExecutionContext* context);
+
+    // Schedules the given task, which must not have dependencies, and also runs it on the calling
+    // thread, so that it is completed even if no worker is idle, e.g., if the caller is a worker
+    // finalizing another task. Throws an exception if the task errors.
+    void runTaskAndWaitOrError(const std::shared_ptr<Task>& task);
+
 private:
     std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
+    std::shared_ptr<ScheduledTask> pushTaskIntoQueueNoLock(const std::shared_ptr<Task>& task);
 
     void removeErroringTask(uint64_t scheduledTaskID);
+    void removeErroringTaskNoLock(uint64_t scheduledTaskID);
+
+    void scheduleChildrenAndWaitOrError(const Task& task, processor::ExecutionContext* context);
 
     // Functions to launch worker threads and for the worker threads to use to grab task from queue.
     void runWorkerThread();
     std::shared_ptr<ScheduledTask> getTaskAndRegister();
+    // Wakes up as many idle workers as the task can accept.
+    void notifyWorkers(const Task& task);
     static void runTask(Task* task);
 
 private:
@@ -65,6 +89,8 @@ private:
     std::vector<std::thread> workerThreads;
     std::mutex mtx;
     std::condition_variable cv;
+    // Notified whenever a worker stops working on a task.
+    std::condition_variable taskCompletedCV;
     uint64_t nextScheduledTaskID;
 };
 
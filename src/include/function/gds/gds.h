@@ -82,6 +82,9 @@ public:
 
     virtual void exec(processor::ExecutionContext* executionContext) = 0;
 
+    // Estimates how many times exec() scans the whole graph. Only called after init().
+    virtual uint64_t getNumGraphScansEstimate() const { return 1; }
+
     // TODO: We should get rid of this copy interface (e.g. using stateless design) or at least make
     // sure the fields that cannot be copied, such as graph or factorized table and localState, are
     // wrapped in a different class.
@@ -10,13 +10,12 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace graph {
 class Graph;
+class GraphScanState;
 } // namespace graph
 
 namespace function {
 
 class RangeFrontierMorsel {
-    friend class PathLengthsFrontiers;
-
 public:
     RangeFrontierMorsel() {}
 
@@ -24,7 +23,7 @@ public:
 
     nodeID_t getNextVertex() { return {nextOffset++, tableID}; }
 
-protected:
+    // Called by implementations of Frontiers::getNextFrontierMorsel.
     void initMorsel(table_id_t _tableID, offset_t _beginOffset, offset_t _endOffsetExclusive) {
         tableID = _tableID;
         beginOffset = _beginOffset;
@@ -54,6 +53,29 @@ public:
     // frontier as a field, **do not** call setActive. Helper functions in GDSUtils will do that
     // work.
     virtual bool edgeCompute(nodeID_t curNodeID, nodeID_t nbrID) = 0;
+
+    // In addition to pushing from the nodes in the current frontier along their forward edges,
+    // algorithms can support pulling (see FrontierDirection). A node that pulls stops scanning
+    // its backward edges at the first edge (curNodeID, nbrID) for which edgeCompute returns true.
+    // So pulling is only correct for algorithms that put a node in the next frontier at most once,
+    // e.g., BFS.
+    virtual bool canPull() const { return false; }
+    // Returns true if nodeID can still be put in the next frontier, in which case it pulls from
+    // the current frontier. Only called if canPull() returns true.
+    virtual bool isPullCandidate(nodeID_t /*nodeID*/) { return false; }
+};
+
+/**
+ * Direction in which the edges between the current and the next frontier are traversed in an
+ * iteration. PUSH (top-down) scans the forward edges of the nodes in the current frontier. PULL
+ * (bottom-up) scans the backward edges of the nodes that can still be put in the next frontier and
+ * checks if their nbrs are in the current frontier. PULL is cheaper once the current frontier
+ * covers a large fraction of the graph, which happens after a few iterations of a BFS on
+ * low-diameter graphs.
+ */
+enum class FrontierDirection : uint8_t {
+    PUSH = 0,
+    PULL = 1,
 };
 
 /**
@@ -84,11 +106,13 @@ class Frontiers {
 public:
     explicit Frontiers(GDSFrontier* curFrontier, GDSFrontier* nextFrontier,
         uint64_t initialActiveNodes)
-        : curFrontier{curFrontier}, nextFrontier{nextFrontier} {
+        : curFrontier{curFrontier}, nextFrontier{nextFrontier}, direction{FrontierDirection::PUSH} {
         numApproxActiveNodesForNextIter.store(initialActiveNodes);
         curIter.store(INVALID_IDX);
     }
     virtual ~Frontiers() = default;
+    // Morsels are over the node table of the current frontier when pushing, and over the node table
+    // of the next frontier when pulling.
     virtual bool getNextFrontierMorsel(RangeFrontierMorsel& frontierMorsel) = 0;
     void incrementApproxActiveNodesForNextIter(uint64_t i) {
         numApproxActiveNodesForNextIter.fetch_add(i);
@@ -124,6 +148,10 @@ public:
         return curIter.load() + 1u;
     }
     bool hasActiveNodesForNextIter() { return numApproxActiveNodesForNextIter.load() > 0; }
+    uint64_t getNumApproxActiveNodesForNextIter() { return numApproxActiveNodesForNextIter.load(); }
+    // Must be called before beginFrontierComputeBetweenTables.
+    void setDirection(FrontierDirection direction_) { direction = direction_; }
+    FrontierDirection getDirection() const { return direction; }
     // Note: If the implementing class stores 2 frontiers, this function should swap them.
     virtual void beginNewIterationInternalNoLock() {}
 
@@ -139,6 +167,7 @@ protected:
     std::atomic<uint64_t> numApproxActiveNodesForNextIter;
     GDSFrontier* curFrontier;
     GDSFrontier* nextFrontier;
+    FrontierDirection direction;
 };
 
 } // namespace function
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "common/types/types.h"
+#include "graph/graph.h"
+
+namespace kuzu {
+namespace function {
+
+/**
+ * A value of type T for each node of a graph, kept in a dense array per node table and indexed by
+ * node offset, instead of a hash map over nodeIDs. Values are atomic so that GDSTasks can read and
+ * update them concurrently.
+ */
+template<typename T>
+class GDSNodeValues {
+public:
+    GDSNodeValues(graph::Graph& graph, T initialValue) {
+        for (auto tableID : graph.getNodeTableIDs()) {
+            const auto numNodes = graph.getNumNodes(tableID);
+            auto tableValues = std::make_unique<std::atomic<T>[]>(numNodes);
+            for (auto i = 0u; i < numNodes; i++) {
+                tableValues[i].store(initialValue, std::memory_order_relaxed);
+            }
+            values.insert({tableID, std::move(tableValues)});
+        }
+    }
+
+    // Looking up the values of a node table once, e.g., per chunk of nbrs (which are all in the
+    // same node table), avoids a hash map lookup per node.
+    std::atomic<T>* getTableValues(common::table_id_t tableID) const {
+        KU_ASSERT(values.contains(tableID));
+        return values.at(tableID).get();
+    }
+
+    T getValue(common::nodeID_t nodeID) const {
+        return getTableValues(nodeID.tableID)[nodeID.offset].load(std::memory_order_relaxed);
+    }
+    void setValue(common::nodeID_t nodeID, T value) {
+        getTableValues(nodeID.tableID)[nodeID.offset].store(value, std::memory_order_relaxed);
+    }
+
+private:
+    common::table_id_map_t<std::unique_ptr<std::atomic<T>[]>> values;
+};
+
+} // namespace function
+} // namespace kuzu
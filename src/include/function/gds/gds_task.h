@@ -27,6 +27,11 @@ public:
 
     void run() override;
 
+private:
+    // Each returns the number of nodes it put in the next frontier.
+    uint64_t push(graph::Graph& graph, graph::GraphScanState& state);
+    uint64_t pull(graph::Graph& graph, graph::GraphScanState& state);
+
 private:
     std::shared_ptr<FrontierTaskSharedState> sharedState;
 };
@@ -17,6 +17,10 @@ class FrontierCompute;
 class FrontierTaskSharedState;
 
 class GDSUtils {
+    // Frontiers pull instead of push once they hold more than 1/PULL_THRESHOLD_DIVISOR of the
+    // nodes of the graph.
+    static constexpr uint64_t PULL_THRESHOLD_DIVISOR = 20;
+
 public:
     explicit GDSUtils();
 
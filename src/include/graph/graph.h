@@ -1,8 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "common/types/types.h"
+#include "common/vector/value_vector.h"
 #include <span>
 
 namespace kuzu {
@@ -19,6 +21,65 @@ public:
     virtual ~GraphScanState() = default;
 };
 
+// A chunk of the neighbors of a node. It points into the vectors that the neighbors, and optionally
+// an edge property of the edges to them, were scanned into. So it does not own any memory and is
+// only valid until the scan state that produced it is used again.
+class NbrChunk {
+public:
+    NbrChunk(const common::ValueVector* nbrNodeIDVector,
+        const common::ValueVector* edgePropertyVector)
+        : nbrNodeIDVector{nbrNodeIDVector}, edgePropertyVector{edgePropertyVector} {}
+
+    common::sel_t size() const { return getSelVector().getSelSize(); }
+
+    common::nodeID_t getNbrNodeID(common::sel_t idx) const {
+        return nbrNodeIDVector->getValue<common::nodeID_t>(getSelVector()[idx]);
+    }
+    // Position of the idx-th neighbor in the scanned vectors.
+    common::sel_t getPos(common::sel_t idx) const { return getSelVector()[idx]; }
+    bool hasEdgeProperty() const { return edgePropertyVector != nullptr; }
+    const common::ValueVector& getEdgePropertyVector() const {
+        KU_ASSERT(hasEdgeProperty());
+        return *edgePropertyVector;
+    }
+    bool isEdgePropertyNull(common::sel_t idx) const {
+        KU_ASSERT(hasEdgeProperty());
+        return edgePropertyVector->isNull(getSelVector()[idx]);
+    }
+    template<typename T>
+    T getEdgeProperty(common::sel_t idx) const {
+        KU_ASSERT(hasEdgeProperty());
+        return edgePropertyVector->getValue<T>(getSelVector()[idx]);
+    }
+
+    // Calls func(nbrNodeID, idx) for each neighbor in the chunk, where idx can be used to look up
+    // the edge property.
+    template<typename FUNC>
+    void forEach(FUNC&& func) const {
+        const auto& selVector = getSelVector();
+        const auto nbrNodeIDs = reinterpret_cast<common::nodeID_t*>(nbrNodeIDVector->getData());
+        if (selVector.isUnfiltered()) {
+            for (auto i = 0u; i < selVector.getSelSize(); i++) {
+                func(nbrNodeIDs[i], i);
+            }
+        } else {
+            for (auto i = 0u; i < selVector.getSelSize(); i++) {
+                func(nbrNodeIDs[selVector[i]], i);
+            }
+        }
+    }
+
+private:
+    const common::SelectionVector& getSelVector() const {
+        return nbrNodeIDVector->state->getSelVector();
+    }
+
+private:
+    const common::ValueVector* nbrNodeIDVector;
+    // Null if no edge property is scanned.
+    const common::ValueVector* edgePropertyVector;
+};
+
 /**
  * Graph interface to be use by GDS algorithms to get neighbors of nodes.
  *
@@ -46,37 +107,58 @@ public:
     // Get all possible "forward" (fromNodeTableID, relTableID, toNodeTableID) combinations.
     virtual std::vector<RelTableIDInfo> getRelTableIDInfos() = 0;
 
-    // Prepares scan on the specified relationship table (works for backwards and forwards scans)
-    virtual std::unique_ptr<GraphScanState> prepareScan(common::table_id_t relTableID) = 0;
+    // Prepares scan on the specified relationship table (works for backwards and forwards scans).
+    // If edgePropertyName is given, the property is scanned along with the neighbors from the
+    // relationship tables that have it, and is null for the tables that do not.
+    virtual std::unique_ptr<GraphScanState> prepareScan(common::table_id_t relTableID,
+        const std::optional<std::string>& edgePropertyName = std::nullopt) = 0;
     // Prepares scan on all connected relationship tables using forward adjList.
     virtual std::unique_ptr<GraphScanState> prepareMultiTableScanFwd(
-        std::span<common::table_id_t> nodeTableIDs) = 0;
-
-    // scanFwd an scanBwd scan a single source node under the assumption that many nodes in the same
-    // group will be scanned at once.
-
-    // Get dst nodeIDs for given src nodeID using forward adjList.
-    virtual std::vector<common::nodeID_t> scanFwd(common::nodeID_t nodeID,
-        GraphScanState& state) = 0;
-
-    // Scans multiple nodeIDs in random mode, which is optimized for small lookups and does minimal
-    // caching of CSR headers.
-    virtual std::vector<common::nodeID_t> scanFwdRandom(common::nodeID_t nodeID,
-        GraphScanState& state) = 0;
-
-    // We don't use scanBwd currently. I'm adding them because they are the mirroring to scanFwd.
-    // Also, algorithm may only need adjList index in single direction so we should make double
-    // indexing optional.
-
+        std::span<common::table_id_t> nodeTableIDs,
+        const std::optional<std::string>& edgePropertyName = std::nullopt) = 0;
     // Prepares scan on all connected relationship tables using backward adjList.
     virtual std::unique_ptr<GraphScanState> prepareMultiTableScanBwd(
-        std::span<common::table_id_t> nodeTableIDs) = 0;
-
-    // Get dst nodeIDs for given src nodeID tables using backward adjList.
-    virtual std::vector<common::nodeID_t> scanBwd(common::nodeID_t nodeID,
-        GraphScanState& state) = 0;
-    virtual std::vector<common::nodeID_t> scanBwdRandom(common::nodeID_t nodeID,
-        GraphScanState& state) = 0;
+        std::span<common::table_id_t> nodeTableIDs,
+        const std::optional<std::string>& edgePropertyName = std::nullopt) = 0;
+
+    // Neighbors are scanned in chunks of at most DEFAULT_VECTOR_CAPACITY, straight out of the
+    // vectors owned by the scan state, so that no memory is allocated per scanned node.
+    // initScanFwd and initScanBwd start scanning the neighbors of a node, after which scanNext
+    // returns the next non-empty chunk, or std::nullopt once all neighbors are scanned. They assume
+    // that many nodes in the same node group are scanned one after another.
+
+    // Starts scanning the dst nodeIDs for given src nodeID using forward adjList.
+    virtual void initScanFwd(common::nodeID_t nodeID, GraphScanState& state) = 0;
+    // Starts scanning the src nodeIDs for given dst nodeID using backward adjList. Algorithms may
+    // only need the adjList in a single direction, so we should make double indexing optional.
+    virtual void initScanBwd(common::nodeID_t nodeID, GraphScanState& state) = 0;
+    // Must be called before scanning backward adjLists, and before the graph is copied for that.
+    // Graphs that do not keep backward adjLists up front build them here, so that algorithms that
+    // only scan backward in some cases do not pay for them otherwise. Not thread-safe.
+    virtual void prepareBwdScans() {}
+    virtual std::optional<NbrChunk> scanNext(GraphScanState& state) = 0;
+
+    // Calls func(const NbrChunk&) for each chunk of the forward neighbors of nodeID.
+    template<typename FUNC>
+    void scanFwd(common::nodeID_t nodeID, GraphScanState& state, FUNC&& func) {
+        initScanFwd(nodeID, state);
+        while (const auto chunk = scanNext(state)) {
+            func(*chunk);
+        }
+    }
+    // Calls func(const NbrChunk&) for each chunk of the backward neighbors of nodeID.
+    template<typename FUNC>
+    void scanBwd(common::nodeID_t nodeID, GraphScanState& state, FUNC&& func) {
+        initScanBwd(nodeID, state);
+        while (const auto chunk = scanNext(state)) {
+            func(*chunk);
+        }
+    }
+    uint64_t getNumFwdNbrs(common::nodeID_t nodeID, GraphScanState& state) {
+        uint64_t numNbrs = 0;
+        scanFwd(nodeID, state, [&](const NbrChunk& chunk) { numNbrs += chunk.size(); });
+        return numNbrs;
+    }
 };
 
 } // namespace graph
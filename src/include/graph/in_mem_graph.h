@@ -0,0 +1,155 @@
+#pragma once
+
+#include "common/vector/value_vector.h"
+#include "graph.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+namespace kuzu {
+namespace main {
+class ClientContext;
+}
+namespace graph {
+
+// The edges of the bound nodes [i * SEGMENT_SIZE, (i + 1) * SEGMENT_SIZE) of a CSR. Its arrays are
+// allocated from the memory manager, so the projected graph counts towards the buffer pool.
+struct InMemCSRSegment {
+    // The nbrs of the j-th bound node of the segment are at [csrOffsets[j], csrOffsets[j + 1]).
+    std::unique_ptr<storage::MemoryBuffer> csrOffsets;
+    // Null if the segment has no edges.
+    std::unique_ptr<storage::MemoryBuffer> nbrOffsets;
+    // Values and null flags of the projected edge property, in the same order as nbrOffsets. Null if
+    // no edge property is projected or if the segment has no edges.
+    std::unique_ptr<storage::MemoryBuffer> edgePropertyValues;
+    std::unique_ptr<storage::MemoryBuffer> edgePropertyNulls;
+
+    const uint64_t* getCSROffsets() const {
+        return reinterpret_cast<const uint64_t*>(csrOffsets->buffer.data());
+    }
+    const common::offset_t* getNbrOffsets() const {
+        return reinterpret_cast<const common::offset_t*>(nbrOffsets->buffer.data());
+    }
+};
+
+// The edges of a rel table in one direction, in CSR format over the offsets of the bound nodes.
+// All nbrs are in the same node table, so only their offsets are kept. The bound nodes are split
+// into segments, which are projected in parallel.
+struct InMemCSR {
+    static constexpr uint64_t SEGMENT_SIZE_LOG2 = common::StorageConstants::NODE_GROUP_SIZE_LOG2;
+    static constexpr uint64_t SEGMENT_SIZE = static_cast<uint64_t>(1) << SEGMENT_SIZE_LOG2;
+
+    common::table_id_t nbrTableID = common::INVALID_TABLE_ID;
+    // Whether the rel table has the projected edge property.
+    bool hasEdgeProperty = false;
+    std::vector<InMemCSRSegment> segments;
+
+    const InMemCSRSegment& getSegment(common::offset_t boundNodeOffset) const {
+        return segments[boundNodeOffset >> SEGMENT_SIZE_LOG2];
+    }
+};
+
+struct InMemGraphData {
+    main::ClientContext* context = nullptr;
+    // The projected graph. Backward CSRs are projected from it on demand.
+    std::unique_ptr<Graph> graph;
+    std::vector<common::table_id_t> nodeTableIDs;
+    std::vector<common::table_id_t> relTableIDs;
+    common::table_id_map_t<common::offset_t> numNodes;
+    std::vector<RelTableIDInfo> relTableIDInfos;
+    std::optional<std::string> edgePropertyName;
+    // Null if no edge property is projected.
+    std::unique_ptr<common::LogicalType> edgePropertyType;
+    bool hasBwdCSRs = false;
+    // nodeTableID -> relTableID -> CSR of the rels bound to the node table.
+    common::table_id_map_t<common::table_id_map_t<InMemCSR>> nodeTableIDToFwdCSRs;
+    common::table_id_map_t<common::table_id_map_t<InMemCSR>> nodeTableIDToBwdCSRs;
+};
+
+class InMemGraphScanState : public GraphScanState {
+    friend class InMemGraph;
+
+public:
+    ~InMemGraphScanState() override = default;
+
+private:
+    InMemGraphScanState(const InMemGraphData& data, std::vector<common::table_id_t> relTableIDs,
+        bool scanEdgeProperty);
+
+private:
+    std::shared_ptr<common::DataChunkState> nbrNodeIDVectorState;
+    std::unique_ptr<common::ValueVector> nbrNodeIDVector;
+    // relTableID -> vector that the edge property of the rel table is copied into. Only populated
+    // if the edge property is scanned.
+    common::table_id_map_t<std::unique_ptr<common::ValueVector>> edgePropertyVectors;
+    std::vector<common::table_id_t> relTableIDs;
+
+    // The scan in progress. Rel tables are scanned in the order of relTableIDs.
+    common::offset_t boundNodeOffset = common::INVALID_OFFSET;
+    // CSRs of the rel tables bound to the node table of the bound node in the scanned direction.
+    const common::table_id_map_t<InMemCSR>* csrsToScan = nullptr;
+    common::idx_t nextRelTableIdx = 0;
+    const InMemCSR* csr = nullptr;
+    const InMemCSRSegment* segment = nullptr;
+    common::ValueVector* edgePropertyVector = nullptr;
+    uint64_t nextNbrIdx = 0;
+    uint64_t endNbrIdx = 0;
+};
+
+/**
+ * A read-only snapshot of another graph, materialized once in memory in CSR format. Algorithms that
+ * iterate over the graph many times scan it without pinning pages, checking the visibility of
+ * rels or decompressing columns again. Copies share the snapshot.
+ */
+class InMemGraph final : public Graph {
+public:
+    explicit InMemGraph(std::shared_ptr<InMemGraphData> data) : data{std::move(data)} {}
+
+    // Materializes the forward (and optionally backward) adjLists of the graph, along with the
+    // given edge property, which must be numerical. The segments of the CSRs are projected in
+    // parallel on the threads of the client. If backward adjLists are not projected here, they are
+    // projected by prepareBwdScans() from a copy of the graph, which must stay valid until then.
+    static std::unique_ptr<InMemGraph> project(main::ClientContext* context, Graph& graph,
+        const std::optional<std::string>& edgePropertyName, bool projectBwd);
+
+    std::unique_ptr<Graph> copy() override { return std::make_unique<InMemGraph>(data); }
+    std::vector<common::table_id_t> getNodeTableIDs() override { return data->nodeTableIDs; }
+    std::vector<common::table_id_t> getRelTableIDs() override { return data->relTableIDs; }
+
+    common::offset_t getNumNodes() override;
+    common::offset_t getNumNodes(common::table_id_t id) override;
+
+    std::vector<RelTableIDInfo> getRelTableIDInfos() override { return data->relTableIDInfos; }
+
+    std::unique_ptr<GraphScanState> prepareScan(common::table_id_t relTableID,
+        const std::optional<std::string>& edgePropertyName) override;
+    std::unique_ptr<GraphScanState> prepareMultiTableScanFwd(
+        std::span<common::table_id_t> nodeTableIDs,
+        const std::optional<std::string>& edgePropertyName) override;
+    std::unique_ptr<GraphScanState> prepareMultiTableScanBwd(
+        std::span<common::table_id_t> nodeTableIDs,
+        const std::optional<std::string>& edgePropertyName) override;
+
+    void initScanFwd(common::nodeID_t nodeID, GraphScanState& state) override;
+    void initScanBwd(common::nodeID_t nodeID, GraphScanState& state) override;
+    std::optional<NbrChunk> scanNext(GraphScanState& state) override;
+
+    // Projects the backward adjLists, unless they are projected already.
+    void prepareBwdScans() override;
+    bool hasBwdCSRs() const { return data->hasBwdCSRs; }
+
+private:
+    std::unique_ptr<GraphScanState> prepareMultiTableScan(
+        const common::table_id_map_t<common::table_id_map_t<InMemCSR>>& nodeTableIDToCSRs,
+        std::span<common::table_id_t> nodeTableIDs,
+        const std::optional<std::string>& edgePropertyName);
+    bool checkEdgeProperty(const std::optional<std::string>& edgePropertyName) const;
+    void initScan(common::nodeID_t nodeID,
+        const common::table_id_map_t<common::table_id_map_t<InMemCSR>>& nodeTableIDToCSRs,
+        GraphScanState& state);
+
+private:
+    // Copies share the data, including backward CSRs projected later on.
+    std::shared_ptr<InMemGraphData> data;
+};
+
+} // namespace graph
+} // namespace kuzu
@@ -11,11 +11,17 @@ namespace kuzu {
 namespace graph {
 
 struct OnDiskGraphScanState {
+    // Null if no edge property is scanned.
+    std::unique_ptr<common::ValueVector> edgePropertyVector;
     std::unique_ptr<storage::RelTableScanState> fwdScanState;
     std::unique_ptr<storage::RelTableScanState> bwdScanState;
 
-    explicit OnDiskGraphScanState(common::ValueVector* srcNodeIDVector,
-        common::ValueVector* dstNodeIDVector);
+    // If edgePropertyType is not null, the edge property of the given name is scanned into a vector
+    // of that type, which is all null if the rel table does not have the property.
+    OnDiskGraphScanState(main::ClientContext* context, storage::RelTable& relTable,
+        common::ValueVector* srcNodeIDVector, common::ValueVector* dstNodeIDVector,
+        const std::optional<std::string>& edgePropertyName,
+        const common::LogicalType* edgePropertyType);
 };
 
 class OnDiskGraphScanStates : public GraphScanState {
@@ -30,9 +36,18 @@ private:
     std::unique_ptr<common::ValueVector> srcNodeIDVector;
     std::unique_ptr<common::ValueVector> dstNodeIDVector;
 
-    explicit OnDiskGraphScanStates(std::span<common::table_id_t> tableIDs,
-        storage::MemoryManager* mm);
+    OnDiskGraphScanStates(main::ClientContext* context,
+        std::span<storage::RelTable*> relTables,
+        const std::optional<std::string>& edgePropertyName);
     std::vector<std::pair<common::table_id_t, OnDiskGraphScanState>> scanStates;
+
+    // The scan in progress. Rel tables are scanned in the order of scanStates.
+    common::RelDataDirection direction = common::RelDataDirection::FWD;
+    // Rel tables connected to the bound node in the scanned direction.
+    const common::table_id_map_t<storage::RelTable*>* relTablesToScan = nullptr;
+    common::idx_t nextScanStateIdx = 0;
+    storage::RelTable* relTable = nullptr;
+    OnDiskGraphScanState* scanState = nullptr;
 };
 
 class OnDiskGraph final : public Graph {
@@ -51,23 +66,32 @@ public:
 
     std::vector<RelTableIDInfo> getRelTableIDInfos() override;
 
-    std::unique_ptr<GraphScanState> prepareScan(common::table_id_t relTableID) override;
+    std::unique_ptr<GraphScanState> prepareScan(common::table_id_t relTableID,
+        const std::optional<std::string>& edgePropertyName) override;
     std::unique_ptr<GraphScanState> prepareMultiTableScanFwd(
-        std::span<common::table_id_t> nodeTableIDs) override;
+        std::span<common::table_id_t> nodeTableIDs,
+        const std::optional<std::string>& edgePropertyName) override;
     std::unique_ptr<GraphScanState> prepareMultiTableScanBwd(
-        std::span<common::table_id_t> nodeTableIDs) override;
+        std::span<common::table_id_t> nodeTableIDs,
+        const std::optional<std::string>& edgePropertyName) override;
+
+    void initScanFwd(common::nodeID_t nodeID, GraphScanState& state) override;
+    void initScanBwd(common::nodeID_t nodeID, GraphScanState& state) override;
+    std::optional<NbrChunk> scanNext(GraphScanState& state) override;
 
-    std::vector<common::nodeID_t> scanFwd(common::nodeID_t nodeID, GraphScanState& state) override;
-    std::vector<common::nodeID_t> scanFwdRandom(common::nodeID_t nodeID,
-        GraphScanState& state) override;
-    std::vector<common::nodeID_t> scanBwd(common::nodeID_t nodeID, GraphScanState& state) override;
-    std::vector<common::nodeID_t> scanBwdRandom(common::nodeID_t nodeID,
-        GraphScanState& state) override;
+    // Returns the type of the given edge property. Since the property is scanned into the same
+    // vector for all rel tables, it must have the same type in each of the given tables that has it.
+    static common::LogicalType getEdgePropertyType(main::ClientContext* context,
+        std::span<const common::table_id_t> relTableIDs, const std::string& edgePropertyName);
 
 private:
-    void scan(common::nodeID_t nodeID, storage::RelTable* relTable,
-        OnDiskGraphScanStates& scanState, storage::RelTableScanState& relTableScanState,
-        std::vector<common::nodeID_t>& nbrNodeIDs);
+    std::unique_ptr<GraphScanState> prepareMultiTableScan(
+        const common::table_id_map_t<common::table_id_map_t<storage::RelTable*>>&
+            nodeTableIDToRelTables,
+        std::span<common::table_id_t> nodeTableIDs,
+        const std::optional<std::string>& edgePropertyName);
+    void initScan(common::nodeID_t nodeID, common::RelDataDirection direction,
+        const common::table_id_map_t<storage::RelTable*>& relTables, GraphScanState& state);
 
 private:
     main::ClientContext* context;
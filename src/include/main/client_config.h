@@ -19,6 +19,9 @@ struct ClientConfig {
     bool enableZoneMap;
     // Number of threads for execution.
     uint64_t numThreads;
+    // Maximum number of independent pipelines of a query, e.g., build sides of joins, that can be
+    // executed concurrently.
+    uint64_t maxNumConcurrentPipelines;
     // Timeout (milliseconds).
     uint64_t timeoutInMS;
     // Variable length maximum depth.
@@ -32,19 +35,41 @@ struct ClientConfig {
     // Scale factor for recursive pattern cardinality estimation.
     uint32_t recursivePatternCardinalityScaleFactor;
     bool disableMapKeyCheck;
+    // If graph algorithms run on an in-memory snapshot of the graph instead of scanning the rel
+    // tables in every iteration.
+    bool enableInMemGraph;
+    // Number of queries whose plans are cached for reuse by later runs of the same query text. 0
+    // disables the cache.
+    uint64_t queryCacheSize;
+    // If the result of read-only queries is streamed to the caller while the query executes
+    // instead of being collected in memory before the query returns.
+    bool enableResultStreaming;
+    // If non-zero, overrides the minimum number of build side tuples of a hash join, or groups of
+    // a hash aggregate, from which their finalize step runs on multiple threads. Only meant for
+    // testing.
+    uint64_t parallelFinalizeThreshold;
+    // If hash joins and hash aggregates spill their partitions to disk when they run out of
+    // memory instead of failing.
+    bool enableSpilling;
 };
 
 struct ClientConfigDefault {
     // 0 means timeout is disabled by default.
     static constexpr uint64_t TIMEOUT_IN_MS = 0;
     static constexpr uint32_t VAR_LENGTH_MAX_DEPTH = 30;
+    static constexpr uint64_t MAX_NUM_CONCURRENT_PIPELINES = 4;
     static constexpr bool ENABLE_SEMI_MASK = true;
-    static constexpr bool ENABLE_ZONE_MAP = false;
+    static constexpr bool ENABLE_ZONE_MAP = true;
     static constexpr bool ENABLE_PROGRESS_BAR = false;
     static constexpr uint64_t SHOW_PROGRESS_AFTER = 1000;
     static constexpr common::PathSemantic RECURSIVE_PATTERN_SEMANTIC = common::PathSemantic::WALK;
     static constexpr uint32_t RECURSIVE_PATTERN_FACTOR = 1;
     static constexpr bool DISABLE_MAP_KEY_CHECK = true;
+    static constexpr bool ENABLE_IN_MEM_GRAPH = true;
+    static constexpr uint64_t QUERY_CACHE_SIZE = 0;
+    static constexpr bool ENABLE_RESULT_STREAMING = false;
+    static constexpr uint64_t PARALLEL_FINALIZE_THRESHOLD = 0;
+    static constexpr bool ENABLE_SPILLING = false;
 };
 
 } // namespace main
@@ -11,6 +11,7 @@
 #include "main/client_config.h"
 #include "parser/statement.h"
 #include "prepared_statement.h"
+#include "query_cache.h"
 #include "query_result.h"
 #include "transaction/transaction_context.h"
 
@@ -22,6 +23,7 @@ class ExpressionBinder;
 } // namespace binder
 
 namespace common {
+class Profiler;
 class RandomEngine;
 class TaskScheduler;
 } // namespace common
@@ -30,11 +32,16 @@ namespace extension {
 struct ExtensionOptions;
 }
 
+namespace processor {
+struct ExecutionContext;
+} // namespace processor
+
 namespace main {
 struct DBConfig;
 class Database;
 class DatabaseManager;
 class AttachedKuzuDatabase;
+struct StreamingQuery;
 
 struct ActiveQuery {
     explicit ActiveQuery();
@@ -163,9 +170,26 @@ private:
     void bindParametersNoLock(PreparedStatement* preparedStatement,
         const std::unordered_map<std::string, std::unique_ptr<common::Value>>& inputParams);
 
+    bool canReusePlanNoLock(const PreparedStatement& preparedStatement) const;
+    std::unique_ptr<QueryResult> executeReusedPlanNoLock(PreparedStatement* preparedStatement,
+        std::optional<uint64_t> queryID);
+
     std::unique_ptr<QueryResult> executeAndAutoCommitIfNecessaryNoLock(
         PreparedStatement* preparedStatement, uint32_t planIdx = 0u,
-        std::optional<uint64_t> queryID = std::nullopt);
+        std::optional<uint64_t> queryID = std::nullopt, bool allowStreaming = true);
+
+    bool canStreamResult(PreparedStatement& preparedStatement,
+        const processor::PhysicalPlan& physicalPlan) const;
+    // Starts executing the plan in the background and returns a result that streams the tuples
+    // as the query produces them.
+    std::unique_ptr<QueryResult> streamResultNoLock(std::unique_ptr<QueryResult> queryResult,
+        std::unique_ptr<processor::PhysicalPlan> physicalPlan,
+        std::unique_ptr<common::Profiler> profiler,
+        std::unique_ptr<processor::ExecutionContext> executionContext,
+        const std::vector<std::shared_ptr<binder::Expression>>& columns);
+    // Stops the query whose result is being streamed, if any, before the connection runs anything
+    // else.
+    void finishStreamingQueryNoLock();
 
     bool canExecuteWriteQuery();
 
@@ -189,6 +213,12 @@ private:
     AttachedKuzuDatabase* remoteDatabase;
     // Progress bar.
     std::unique_ptr<common::ProgressBar> progressBar;
+    // Incremented whenever a setting is changed, as plans may depend on the settings.
+    uint64_t configVersion = 0;
+    // Plans of recently run queries.
+    QueryCache queryCache;
+    // The query whose result is being streamed.
+    std::unique_ptr<StreamingQuery> streamingQuery;
     std::mutex mtx;
 };
 
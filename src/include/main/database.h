@@ -61,10 +61,13 @@ struct KUZU_API SystemConfig {
      * the WAL file exceeds the checkpoint threshold.
      * @param checkpointThreshold The threshold of the WAL file size in bytes. When the size of the
      * WAL file exceeds this threshold, the database will checkpoint if autoCheckpoint is true.
+     * @param evictionPolicy The page replacement policy of the buffer manager. TWO_QUEUE keeps
+     * pages that are read only once (e.g., by large scans) from evicting frequently accessed ones.
      */
     explicit SystemConfig(uint64_t bufferPoolSize = -1u, uint64_t maxNumThreads = 0,
         bool enableCompression = true, bool readOnly = false, uint64_t maxDBSize = -1u,
-        bool autoCheckpoint = true, uint64_t checkpointThreshold = 16777216 /* 16MB */);
+        bool autoCheckpoint = true, uint64_t checkpointThreshold = 16777216 /* 16MB */,
+        storage::EvictionPolicy evictionPolicy = storage::EvictionPolicy::FIFO_SECOND_CHANCE);
 
     uint64_t bufferPoolSize;
     uint64_t maxNumThreads;
@@ -73,6 +76,7 @@ struct KUZU_API SystemConfig {
     uint64_t maxDBSize;
     bool autoCheckpoint;
     uint64_t checkpointThreshold;
+    storage::EvictionPolicy evictionPolicy;
 };
 
 /**
@@ -3,6 +3,7 @@
 #include <string>
 
 #include "common/types/value/value.h"
+#include "storage/enums/eviction_policy.h"
 
 namespace kuzu {
 namespace common {
@@ -60,6 +61,7 @@ struct DBConfig {
     bool autoCheckpoint;
     uint64_t checkpointThreshold;
     bool forceCheckpointOnClose;
+    storage::EvictionPolicy evictionPolicy;
 
     explicit DBConfig(const SystemConfig& systemConfig);
 
@@ -28,6 +28,7 @@ class Catalog;
 } // namespace catalog
 
 namespace common {
+class ArrowRowBatch;
 enum class StatementType : uint8_t;
 class Value;
 struct FileInfo;
@@ -50,6 +51,8 @@ namespace processor {
 class QueryProcessor;
 class FactorizedTable;
 class FlatTupleIterator;
+struct FlatTupleRun;
+class ResultStream;
 class PhysicalOperator;
 class PhysicalPlan;
 } // namespace processor
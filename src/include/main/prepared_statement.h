@@ -60,6 +60,13 @@ private:
     std::unique_ptr<binder::BoundStatementResult> statementResult;
     std::vector<std::unique_ptr<planner::LogicalPlan>> logicalPlans;
     std::shared_ptr<parser::Statement> parsedStatement;
+    // What the plans were bound and planned against. Later executions reuse the plans as long as
+    // none of it has changed.
+    bool planReusable = false;
+    const catalog::Catalog* plannedCatalog = nullptr;
+    uint64_t plannedCatalogVersion = 0;
+    uint64_t plannedConfigVersion = 0;
+    std::unordered_map<std::string, std::unique_ptr<common::Value>> plannedParameters;
 };
 
 } // namespace main
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "prepared_statement.h"
+
+namespace kuzu {
+namespace main {
+
+// Prepared statements of the queries recently run on a connection, keyed by query text, so that
+// running a query again can skip parsing, binding and planning it. The least recently used
+// statements are evicted once the cache is full.
+class QueryCache {
+public:
+    void setCapacity(uint64_t capacity_);
+
+    // Returns nullptr if the query is not cached.
+    PreparedStatement* get(const std::string& query);
+    void put(const std::string& query, std::unique_ptr<PreparedStatement> preparedStatement);
+    void erase(const std::string& query);
+
+private:
+    void evict();
+
+private:
+    uint64_t capacity = 0;
+    // Most recently used first.
+    std::list<std::pair<std::string, std::unique_ptr<PreparedStatement>>> entries;
+    std::unordered_map<std::string, decltype(entries)::iterator> entryIndex;
+};
+
+} // namespace main
+} // namespace kuzu
@@ -18,6 +18,7 @@ namespace main {
 class QueryResult {
     friend class Connection;
     friend class ClientContext;
+    friend class common::ArrowRowBatch;
     class QueryResultIterator {
     private:
         QueryResult* currentResult;
@@ -72,7 +73,8 @@ public:
      */
     KUZU_API std::vector<common::LogicalType> getColumnDataTypes() const;
     /**
-     * @return num of tuples in query result.
+     * @return num of tuples in query result. For a streamed result, this waits for the query to
+     * finish and keeps the rest of its result in memory.
      */
     KUZU_API uint64_t getNumTuples() const;
     /**
@@ -81,7 +83,8 @@ public:
      */
     KUZU_API QuerySummary* getQuerySummary() const;
     /**
-     * @return whether there are more tuples to read.
+     * @return whether there are more tuples to read. For a streamed result, this waits for the
+     * query to produce more tuples and throws if the query fails meanwhile.
      */
     KUZU_API bool hasNext() const;
     /**
@@ -104,11 +107,15 @@ public:
     KUZU_API std::string toString();
 
     /**
-     * @brief Resets the result tuple iterator.
+     * @brief Resets the result tuple iterator. A streamed result can only be reset as long as none
+     * of the tuples it has dropped after reading them are needed again.
      */
     KUZU_API void resetIterator();
 
-    processor::FactorizedTable* getTable() { return factorizedTable.get(); }
+    processor::FactorizedTable* getTable() {
+        collectRemainingTables();
+        return factorizedTable.get();
+    }
 
     /**
      * @brief Returns the arrow schema of the query result.
@@ -135,8 +142,20 @@ public:
 private:
     void initResultTableAndIterator(std::shared_ptr<processor::FactorizedTable> factorizedTable_,
         const std::vector<std::shared_ptr<binder::Expression>>& columns);
+    void setResultStream(std::shared_ptr<processor::ResultStream> resultStream_);
     void validateQuerySucceed() const;
 
+    // Moves on to the next table of a streamed result, dropping the current one. Returns false
+    // once the stream is exhausted.
+    bool fetchNextTable() const;
+    // Appends the tables the stream has not produced yet to the current table.
+    void collectRemainingTables() const;
+
+    // Used to export the result column by column. Callers must check hasNext() before reading a
+    // run.
+    bool canReadFlatTupleRuns() const;
+    processor::FlatTupleRun getNextFlatTupleRun(uint64_t maxNumFlatTuples);
+
 private:
     // execution status
     bool success = true;
@@ -146,9 +165,13 @@ private:
     std::vector<std::string> columnNames;
     std::vector<common::LogicalType> columnDataTypes;
     // data
-    std::shared_ptr<processor::FactorizedTable> factorizedTable;
-    std::unique_ptr<processor::FlatTupleIterator> iterator;
+    // The table and iterator move on to the next table of a streamed result as tuples are read.
+    mutable std::shared_ptr<processor::FactorizedTable> factorizedTable;
+    mutable std::unique_ptr<processor::FlatTupleIterator> iterator;
     std::shared_ptr<processor::FlatTuple> tuple;
+    // Set while the query producing the result is still streaming it.
+    mutable std::shared_ptr<processor::ResultStream> resultStream;
+    mutable uint64_t numFlatTuplesOfDroppedTables = 0;
 
     // execution statistics
     std::unique_ptr<QuerySummary> querySummary;
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "common/exception/not_implemented.h"
+#include "common/exception/runtime.h"
 #include "common/types/value/value.h"
 #include "main/client_context.h"
 #include "main/db_config.h"
@@ -20,6 +20,22 @@ struct ThreadsSetting {
     }
 };
 
+struct MaxConcurrentPipelinesSetting {
+    static constexpr auto name = "max_concurrent_pipelines";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        auto numPipelines = parameter.getValue<int64_t>();
+        if (numPipelines < 1) {
+            throw common::RuntimeException("max_concurrent_pipelines must be at least 1.");
+        }
+        context->getClientConfigUnsafe()->maxNumConcurrentPipelines = numPipelines;
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->maxNumConcurrentPipelines);
+    }
+};
+
 struct TimeoutSetting {
     static constexpr auto name = "timeout";
     static constexpr auto inputType = common::LogicalTypeID::INT64;
@@ -94,14 +110,64 @@ struct DisableMapKeyCheck {
     }
 };
 
+struct EnableInMemGraphSetting {
+    static constexpr auto name = "enable_in_mem_graph";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->enableInMemGraph = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->enableInMemGraph);
+    }
+};
+
+struct EnableSpillingSetting {
+    static constexpr auto name = "enable_spilling";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->enableSpilling = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->enableSpilling);
+    }
+};
+
+struct QueryCacheSizeSetting {
+    static constexpr auto name = "query_cache_size";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        auto cacheSize = parameter.getValue<int64_t>();
+        if (cacheSize < 0) {
+            throw common::RuntimeException("query_cache_size must be at least 0.");
+        }
+        context->getClientConfigUnsafe()->queryCacheSize = cacheSize;
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->queryCacheSize);
+    }
+};
+
+struct EnableResultStreamingSetting {
+    static constexpr auto name = "enable_result_streaming";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        context->getClientConfigUnsafe()->enableResultStreaming = parameter.getValue<bool>();
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->enableResultStreaming);
+    }
+};
+
 struct EnableZoneMapSetting {
     static constexpr auto name = "enable_zone_map";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
-    static void setContext(ClientContext* /*context*/, const common::Value& parameter) {
+    static void setContext(ClientContext* context, const common::Value& parameter) {
         parameter.validateType(inputType);
-        // TODO(Guodong/Xiyang/Ben): Turn me on when zone map is ready.
-        throw common::NotImplementedException("Zone map is not yet ready to be turned on.");
-        // context->getClientConfigUnsafe()->enableZoneMap = parameter.getValue<bool>();
+        context->getClientConfigUnsafe()->enableZoneMap = parameter.getValue<bool>();
     }
     static common::Value getSetting(const ClientContext* context) {
         return common::Value(context->getClientConfig()->enableZoneMap);
@@ -175,6 +241,22 @@ struct EnableMVCCSetting {
     }
 };
 
+struct ParallelFinalizeThresholdSetting {
+    static constexpr auto name = "debug_parallel_finalize_threshold";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter) {
+        parameter.validateType(inputType);
+        auto threshold = parameter.getValue<int64_t>();
+        if (threshold < 0) {
+            throw common::RuntimeException("debug_parallel_finalize_threshold must be at least 0.");
+        }
+        context->getClientConfigUnsafe()->parallelFinalizeThreshold = threshold;
+    }
+    static common::Value getSetting(const ClientContext* context) {
+        return common::Value(context->getClientConfig()->parallelFinalizeThreshold);
+    }
+};
+
 struct CheckpointThresholdSetting {
     static constexpr auto name = "checkpoint_threshold";
     static constexpr auto inputType = common::LogicalTypeID::INT64;
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <functional>
+
+#include "binder/expression/property_expression.h"
 #include "binder/query/query_graph.h"
 #include "planner/operator/logical_plan.h"
 
@@ -8,12 +11,19 @@ namespace main {
 class ClientContext;
 } // namespace main
 
+namespace storage {
+class ColumnStats;
+} // namespace storage
+
 namespace transaction {
 class Transaction;
 } // namespace transaction
 
 namespace planner {
 
+// The join enumerator and cost model see the table stats only through the cardinalities estimated
+// here. Joins on node IDs are estimated from the number of nodes; using the distinct counts of
+// properties for other joins is out of scope for now.
 class CardinalityEstimator {
 public:
     CardinalityEstimator() = default;
@@ -48,6 +58,17 @@ private:
 
     uint64_t getNumRels(const std::vector<common::table_id_t>& tableIDs);
 
+    double getSelectivity(const binder::Expression& predicate);
+    // Averages the selectivity estimated from the stats of the property's column in each table,
+    // weighted by the number of rows of the table. Tables without stats get defaultSelectivity.
+    double getSelectivity(const binder::PropertyExpression& property,
+        const std::function<double(const storage::ColumnStats&)>& estimate,
+        double defaultSelectivity);
+    // The expected degree of the nodes reached by extending the rel from the bound node, or 0 if
+    // the rel tables have no degree stats.
+    double getReachedNodeDegree(const binder::RelExpression& rel,
+        const binder::NodeExpression& boundNode);
+
 private:
     main::ClientContext* context;
     // The domain of nodeID is defined as the number of unique value of nodeID, i.e. num nodes.
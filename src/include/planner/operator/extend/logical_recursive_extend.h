@@ -27,15 +27,26 @@ public:
     void setJoinType(RecursiveJoinType joinType_) { joinType = joinType_; }
     RecursiveJoinType getJoinType() const { return joinType; }
     std::shared_ptr<LogicalOperator> getRecursiveChild() const { return recursiveChild; }
+    void setBwdRecursiveChild(std::shared_ptr<LogicalOperator> child) {
+        bwdRecursiveChild = std::move(child);
+    }
+    std::shared_ptr<LogicalOperator> getBwdRecursiveChild() const { return bwdRecursiveChild; }
 
     std::unique_ptr<LogicalOperator> copy() override {
-        return std::make_unique<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
+        auto op = std::make_unique<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
             extendFromSource_, joinType, children[0]->copy(), recursiveChild->copy());
+        if (bwdRecursiveChild != nullptr) {
+            op->bwdRecursiveChild = bwdRecursiveChild->copy();
+        }
+        return op;
     }
 
 private:
     RecursiveJoinType joinType;
     std::shared_ptr<LogicalOperator> recursiveChild;
+    // Recursive plan extending in the opposite direction. Only planned for shortest paths without
+    // node predicate, which can be searched from both ends if the nbr node is bound.
+    std::shared_ptr<LogicalOperator> bwdRecursiveChild;
 };
 
 class LogicalPathPropertyProbe : public LogicalOperator {
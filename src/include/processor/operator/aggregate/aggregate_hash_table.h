@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 #include "aggregate_input.h"
 #include "function/aggregate_function.h"
 #include "processor/result/base_hash_table.h"
@@ -60,6 +62,8 @@ public:
 
     FactorizedTable* getFactorizedTable() { return factorizedTable.get(); }
 
+    storage::MemoryManager& getMemoryManager() const { return memoryManager; }
+
     uint64_t getNumEntries() const { return factorizedTable->getNumTuples(); }
 
     void append(const std::vector<common::ValueVector*>& flatKeyVectors,
@@ -83,6 +87,21 @@ public:
 
     //! merge aggregate hash table by combining aggregate states under the same key
     void merge(AggregateHashTable& other);
+    //! merge only the given entries of another aggregate hash table
+    void merge(AggregateHashTable& other, std::span<uint8_t* const> entries);
+
+    //! create an empty hash table with the same schema and aggregate functions, which must not be
+    //! distinct
+    std::unique_ptr<AggregateHashTable> createEmptyCopy(storage::MemoryManager& memoryManager,
+        uint64_t numEntriesToAllocate) const;
+
+    //! bucket the entries by the numPartitionsLog2 most significant bits of their hashes
+    std::vector<std::vector<uint8_t*>> partitionEntries(uint64_t numPartitionsLog2) const;
+
+    // See FactorizedTable::pin() and unpin(). These also cover the hash slots. Memory owned by
+    // aggregate states (e.g., the overflow buffers of min/max over strings) is not covered.
+    void pin();
+    void unpin();
 
     void finalizeAggregateStates();
 
@@ -112,6 +131,9 @@ protected:
         common::DataChunkState* leadingState);
 
 private:
+    template<typename FUNC>
+    void mergeEntries(AggregateHashTable& other, uint64_t numEntries, FUNC getOtherEntry);
+
     void initializeFT(
         const std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions,
         FactorizedTableSchema tableSchema);
@@ -2,35 +2,114 @@
 
 #include "aggregate_hash_table.h"
 #include "processor/operator/aggregate/base_aggregate.h"
+#include "processor/operator/hash_join/spilled_partitions.h"
 
 namespace kuzu {
+namespace common {
+class TaskScheduler;
+} // namespace common
+
 namespace processor {
 
+// The rows [startOffset, endOffset) of the merged hash table of a partition.
+struct HashAggregatePartitionRange {
+    common::idx_t partitionIdx = common::INVALID_IDX;
+    AggregateHashTable* table = nullptr;
+    uint64_t startOffset = 0;
+    uint64_t endOffset = 0;
+};
+
+// If spilling is enabled and the groups of the thread-local hash tables grow beyond the memory
+// limit, each thread from then on flushes its partially aggregated hash table into spilled
+// partitions (see SpilledPartitions) whenever it grows beyond its share of the limit, and starts
+// over with an empty one. The partitions are taken from the most significant bits of the group
+// hashes, so each group falls into a single partition. At finalize, the runs of each partition
+// are merged into one hash table, which is unpinned once finalized, and pinned while it is
+// scanned. There is a single level of partitioning, so the merged hash table of each partition
+// must fit in the buffer pool; finalize fails otherwise.
+// Only aggregates whose states live entirely in the hash table's tuples can spill (see
+// canSpill()).
 // NOLINTNEXTLINE(cppcoreguidelines-virtual-class-destructor): This is a final class.
 class HashAggregateSharedState final : public BaseAggregateSharedState {
+    // If the thread-local hash tables hold at least this many entries in total, they are radix
+    // partitioned on the most significant bits of the group hashes and each partition is merged
+    // and finalized on its own thread.
+    static constexpr uint64_t MIN_NUM_ENTRIES_TO_PARTITION = 1 << 18;
+    static constexpr uint64_t NUM_PARTITIONS_LOG2 = 6;
+    static constexpr uint64_t NUM_PARTITIONS = 1 << NUM_PARTITIONS_LOG2;
 
 public:
     explicit HashAggregateSharedState(
         const std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions)
-        : BaseAggregateSharedState{aggregateFunctions} {}
+        : BaseAggregateSharedState{aggregateFunctions}, memoryLimit{UINT64_MAX},
+          localMemoryLimit{UINT64_MAX}, memoryUsage{0}, spilling{false} {}
 
     void appendAggregateHashTable(std::unique_ptr<AggregateHashTable> aggregateHashTable);
 
-    void combineAggregateHashTable(storage::MemoryManager& memoryManager);
-
-    void finalizeAggregateHashTable();
+    // COLLECT and MIN/MAX of strings keep their values in memory owned by their states, which
+    // would neither be accounted for nor spilled.
+    static bool canSpill(
+        const std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions);
+    void enableSpilling(uint64_t memoryLimit_, uint64_t numThreads) {
+        memoryLimit = memoryLimit_;
+        localMemoryLimit = memoryLimit_ / std::max<uint64_t>(numThreads, 1);
+    }
+    // Accounts for memory allocated by thread-local hash tables, and starts spilling if it exceeds
+    // the limit.
+    void addMemoryUsage(uint64_t numBytes);
+    bool isSpilling() const { return spilling.load(std::memory_order_relaxed); }
+    // Once spilling, a thread-local hash table is flushed if its groups take up more than this.
+    uint64_t getLocalMemoryLimit() const { return localMemoryLimit; }
+
+    // Flushes the groups of the hash table into the spilled partitions.
+    static void spill(AggregateHashTable& aggregateHashTable,
+        SpilledPartitions<AggregateHashTable>& partitions);
+    void mergeSpilledPartitions(SpilledPartitions<AggregateHashTable>& localPartitions);
+
+    // Merges the thread-local hash tables (or spilled partitions), using up to numThreads threads,
+    // and finalizes the aggregate states of the merged ones.
+    void finalizeAggregateHashTables(main::ClientContext& context);
 
     std::pair<uint64_t, uint64_t> getNextRangeToRead() override;
+    // Same as getNextRangeToRead(), but returns the partition the rows are in, and the range of the
+    // rows in its merged hash table. A range never spans multiple partitions. The hash table stays
+    // pinned until the range is released.
+    HashAggregatePartitionRange getNextPartitionRangeToRead();
+    void releasePartitionRange(const HashAggregatePartitionRange& range);
 
-    inline uint8_t* getRow(uint64_t idx) { return globalAggregateHashTable->getEntry(idx); }
-
-    FactorizedTable* getFactorizedTable() { return globalAggregateHashTable->getFactorizedTable(); }
+    uint64_t getNumEntries() const { return numEntries; }
 
     uint64_t getCurrentOffset() const { return currentOffset; }
 
+private:
+    void mergeSerially();
+    void mergePartitions(common::TaskScheduler& taskScheduler, uint64_t numThreads);
+    void mergeSpilledRuns(main::ClientContext& context, uint64_t numThreads);
+    void appendSpilledRunsNoLock(SpilledPartitions<AggregateHashTable>& localPartitions);
+
+    HashAggregatePartitionRange getNextPartitionRangeToReadNoLock();
+    void releasePartitionRangeNoLock(const HashAggregatePartitionRange& range);
+
 private:
     std::vector<std::unique_ptr<AggregateHashTable>> localAggregateHashTables;
-    std::unique_ptr<AggregateHashTable> globalAggregateHashTable;
+    // The merged hash tables, one per radix partition, or a single one if the local tables are
+    // merged serially.
+    std::vector<std::unique_ptr<AggregateHashTable>> globalAggregateHashTables;
+    uint64_t numEntries = 0;
+    // Position of the next rows to read in globalAggregateHashTables.
+    common::idx_t currentPartitionIdx = 0;
+    uint64_t currentOffsetInPartition = 0;
+
+    uint64_t memoryLimit;
+    uint64_t localMemoryLimit;
+    std::atomic<uint64_t> memoryUsage;
+    std::atomic<bool> spilling;
+    // partitionIdx -> runs of partially aggregated groups.
+    std::vector<std::vector<std::unique_ptr<AggregateHashTable>>> spilledRuns;
+    // Set if globalAggregateHashTables are merged from spilled partitions, in which case they are
+    // unpinned unless numPins of the partition is non-zero.
+    bool spilled = false;
+    std::vector<uint64_t> numPins;
 };
 
 struct HashAggregateInfo {
@@ -55,6 +134,8 @@ struct HashAggregateLocalState {
         std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions,
         std::vector<common::LogicalType> types);
     void append(const std::vector<AggregateInput>& aggregateInputs, uint64_t multiplicity) const;
+    // Only set once the hash table is flushed to spilled partitions for the first time.
+    std::unique_ptr<SpilledPartitions<AggregateHashTable>> spilledPartitions;
 };
 
 struct HashAggregatePrintInfo final : OPPrintInfo {
@@ -97,6 +178,10 @@ public:
             cloneAggFunctions(), copyVector(aggInfos), children[0]->clone(), id, printInfo->copy());
     }
 
+private:
+    // Flushes the thread-local hash table to spilled partitions and replaces it with an empty one.
+    void spillLocalHashTable(ExecutionContext* context);
+
 private:
     HashAggregateInfo hashInfo;
     HashAggregateLocalState localState;
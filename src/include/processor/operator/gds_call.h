@@ -51,6 +51,8 @@ private:
 
 class GDSCall : public Sink {
     static constexpr PhysicalOperatorType operatorType_ = PhysicalOperatorType::GDS_CALL;
+    // The graph is projected in memory if the algorithm scans it at least this many times.
+    static constexpr uint64_t MIN_NUM_GRAPH_SCANS_TO_PROJECT = 3;
 
 public:
     GDSCall(std::unique_ptr<ResultSetDescriptor> descriptor, GDSCallInfo info,
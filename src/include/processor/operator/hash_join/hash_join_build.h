@@ -1,6 +1,8 @@
 #pragma once
 
 #include "join_hash_table.h"
+#include "processor/operator/hash_join/runtime_join_filter.h"
+#include "processor/operator/hash_join/spilled_partitions.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
@@ -35,10 +37,16 @@ class HashJoinBuild;
 // HashJoinBuild thread when they finished materializing thread-local tuples. Also, the state holds
 // a global htDirectory, which will be updated by the last thread in the hash join build side
 // task/pipeline, and probed by the HashJoinProbe operators.
+// If spilling is enabled and the materialized tuples grow beyond the memory limit, the build side
+// switches to a grace hash join: the tuples are partitioned by key (see JoinPartitioner) into
+// spilled partitions, and the probe side joins one partition at a time. The hash table of a
+// partition is built by the first probe thread that needs it, and unpinned once no probe thread
+// uses it anymore.
 class HashJoinSharedState {
 public:
     explicit HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable)
-        : hashTable{std::move(hashTable)} {};
+        : hashTable{std::move(hashTable)}, memoryLimit{UINT64_MAX}, memoryUsage{0},
+          spilling{false} {};
 
     virtual ~HashJoinSharedState() = default;
 
@@ -46,9 +54,40 @@ public:
 
     inline JoinHashTable* getHashTable() { return hashTable.get(); }
 
+    void enableSpilling(uint64_t memoryLimit_) { memoryLimit = memoryLimit_; }
+    // Accounts for tuples materialized in memory, and starts spilling if they exceed the limit.
+    void addMemoryUsage(uint64_t numBytes);
+    bool isSpilling() const { return spilling.load(std::memory_order_relaxed); }
+
+    void mergeSpilledPartitions(SpilledPartitions<JoinHashTable>& localPartitions);
+    // Returns the pinned hash table of the partition, with its hash slots built.
+    JoinHashTable* acquireSpilledPartition(uint64_t partitionIdx);
+    void releaseSpilledPartition(uint64_t partitionIdx);
+    uint64_t getNumSpilledTuples() const;
+    // Calls func on each run of the spilled partitions, while it is pinned.
+    void scanSpilledRuns(const std::function<void(JoinHashTable&)>& func);
+
+    // Only set if there is a scan on the probe side that can apply the filter.
+    void setRuntimeFilter(std::shared_ptr<RuntimeJoinFilter> filter) {
+        runtimeFilter = std::move(filter);
+    }
+    RuntimeJoinFilter* getRuntimeFilter() const { return runtimeFilter.get(); }
+
 protected:
+    struct SpilledPartition {
+        std::vector<std::unique_ptr<JoinHashTable>> runs;
+        // Set once the runs are merged and the hash slots are built.
+        bool built = false;
+        uint64_t numPins = 0;
+    };
+
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+    std::shared_ptr<RuntimeJoinFilter> runtimeFilter;
+    uint64_t memoryLimit;
+    std::atomic<uint64_t> memoryUsage;
+    std::atomic<bool> spilling;
+    std::vector<SpilledPartition> spilledPartitions;
 };
 
 class HashJoinBuildInfo {
@@ -79,6 +118,9 @@ private:
 };
 
 class HashJoinBuild : public Sink {
+    // JoinHashTable::allocateHashSlots() allocates the next power of two of 2 slots per tuple.
+    static constexpr uint64_t MAX_NUM_HASH_SLOTS_PER_TUPLE = 4;
+
 public:
     HashJoinBuild(std::unique_ptr<ResultSetDescriptor> resultSetDescriptor,
         PhysicalOperatorType operatorType, std::shared_ptr<HashJoinSharedState> sharedState,
@@ -108,6 +150,9 @@ protected:
 private:
     void setKeyState(common::DataChunkState* state);
 
+    void appendVectorsToSpilledPartitions(ExecutionContext* context);
+    void finalizeSpilledPartitions(ExecutionContext* context);
+
 protected:
     std::shared_ptr<HashJoinSharedState> sharedState;
     std::unique_ptr<HashJoinBuildInfo> info;
@@ -118,6 +163,11 @@ protected:
     std::vector<common::ValueVector*> payloadVectors;
 
     std::unique_ptr<JoinHashTable> hashTable; // local state
+
+private:
+    common::logical_type_vec_t keyTypes;
+    std::unique_ptr<JoinPartitioner> partitioner;
+    std::unique_ptr<SpilledPartitions<JoinHashTable>> spilledPartitions;
 };
 
 } // namespace processor
@@ -3,6 +3,7 @@
 #include "common/enums/join_type.h"
 #include "processor/operator/filtering_operator.h"
 #include "processor/operator/hash_join/hash_join_build.h"
+#include "processor/operator/hash_join/spilled_partitions.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/result/result_set.h"
 
@@ -35,6 +36,8 @@ public:
     ProbeDataInfo(const ProbeDataInfo& other)
         : ProbeDataInfo{other.keysDataPos, other.payloadsOutPos} {
         markDataPos = other.markDataPos;
+        probeSideDataPos = other.probeSideDataPos;
+        probeSideFStateTypes = other.probeSideFStateTypes;
     }
 
     inline uint32_t getNumPayloads() const { return payloadsOutPos.size(); }
@@ -43,6 +46,9 @@ public:
     std::vector<DataPos> keysDataPos;
     std::vector<DataPos> payloadsOutPos;
     DataPos markDataPos;
+    // Vectors in scope of the probe side, which are materialized if the build side is spilled.
+    std::vector<DataPos> probeSideDataPos;
+    std::vector<common::FStateType> probeSideFStateTypes;
 };
 
 struct HashJoinProbePrintInfo final : OPPrintInfo {
@@ -73,7 +79,7 @@ public:
         : PhysicalOperator{type_, std::move(probeChild), std::move(buildChild), id,
               std::move(printInfo)},
           sharedState{std::move(sharedState)}, joinType{joinType}, flatProbe{flatProbe},
-          probeDataInfo{probeDataInfo} {}
+          probeDataInfo{probeDataInfo}, hashTable{nullptr} {}
 
     // This constructor is used for cloning only.
     HashJoinProbe(std::shared_ptr<HashJoinSharedState> sharedState, common::JoinType joinType,
@@ -82,7 +88,7 @@ public:
         std::unique_ptr<OPPrintInfo> printInfo)
         : PhysicalOperator{type_, std::move(probeChild), id, std::move(printInfo)},
           sharedState{std::move(sharedState)}, joinType{joinType}, flatProbe{flatProbe},
-          probeDataInfo{probeDataInfo} {}
+          probeDataInfo{probeDataInfo}, hashTable{nullptr} {}
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
@@ -94,6 +100,13 @@ public:
     }
 
 private:
+    // If the build side is spilled, the probe side tuples are first partitioned in the same way as
+    // the build side tuples, and then read back one partition at a time, so that only the hash
+    // table of that partition needs to be in memory.
+    bool getNextInput(ExecutionContext* context);
+    void spillProbeSide(ExecutionContext* context);
+    bool getNextSpilledTuple();
+
     inline bool getMatchedTuples(ExecutionContext* context) {
         return flatProbe ? getMatchedTuplesForFlatKey(context) :
                            getMatchedTuplesForUnFlatKey(context);
@@ -127,6 +140,19 @@ private:
     std::unique_ptr<common::ValueVector> hashVector;
     std::unique_ptr<common::ValueVector> tmpHashVector;
     common::SelectionVector hashSelVec;
+
+    // The hash table to probe, which is the hash table of the current partition if the build side
+    // is spilled.
+    JoinHashTable* hashTable;
+    std::vector<common::ValueVector*> probeSideVectors;
+    std::vector<ft_col_idx_t> probeSideColIdxes;
+    FactorizedTableSchema spilledTableSchema;
+    bool spillFlatRows = false;
+    std::unique_ptr<JoinPartitioner> partitioner;
+    std::unique_ptr<SpilledPartitions<FactorizedTable>> spilledPartitions;
+    uint64_t partitionIdx = 0;
+    uint64_t runIdx = 0;
+    ft_tuple_idx_t tupleIdx = 0;
 };
 
 } // namespace processor
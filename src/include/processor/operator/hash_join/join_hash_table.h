@@ -4,6 +4,11 @@
 #include "storage/buffer_manager/memory_manager.h"
 
 namespace kuzu {
+namespace main {
+class ClientContext;
+} // namespace main
+
+
 namespace processor {
 
 class JoinHashTable : public BaseHashTable {
@@ -21,7 +26,9 @@ public:
         std::vector<common::ValueVector*> payloadVectors);
 
     void allocateHashSlots(uint64_t numTuples);
-    void buildHashSlots();
+    // Builds the hash slots. If a client context is given and the table is large enough, they are
+    // built in parallel on the threads of the client.
+    void buildHashSlots(main::ClientContext* context = nullptr);
 
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector& hashVector,
         common::SelectionVector& hashSelVec, common::ValueVector& tmpHashResultVector,
@@ -39,34 +46,49 @@ public:
         factorizedTable->lookup(vectors, colIdxesToScan, tuplesToRead, startPos, numTuplesToRead);
     }
     void merge(JoinHashTable& other) { factorizedTable->merge(*other.factorizedTable); }
+    // See FactorizedTable::pin() and unpin(). These also cover the hash slots.
+    void pin();
+    void unpin();
     uint64_t getNumTuples() { return factorizedTable->getNumTuples(); }
     uint8_t** getPrevTuple(const uint8_t* tuple) const {
         return (uint8_t**)(tuple + prevPtrColOffset);
     }
     uint8_t* getTupleForHash(common::hash_t hash) {
-        auto slotIdx = getSlotIdxForHash(hash);
+        auto slotIdx = getSlotIdx(hash);
         KU_ASSERT(slotIdx < maxNumHashSlots);
         return ((uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]
                                 ->getData()))[slotIdx & slotIdxInBlockMask];
     }
     FactorizedTable* getFactorizedTable() { return factorizedTable.get(); }
     const FactorizedTableSchema* getTableSchema() { return factorizedTable->getTableSchema(); }
+    common::offset_t getHashValueColOffset() const;
 
 private:
+    // Slot indexes are taken from the most significant bits of the hash, so that the slots of the
+    // tuples in the same radix partition (see getPartitionIdx()) form a contiguous range.
+    uint64_t getSlotIdx(common::hash_t hash) const {
+        return numHashSlotsLog2 == 0 ? 0 : hash >> (64 - numHashSlotsLog2);
+    }
+    static uint64_t getPartitionIdx(common::hash_t hash) {
+        return hash >> (64 - NUM_PARTITIONS_LOG2);
+    }
+
     uint8_t** findHashSlot(const uint8_t* tuple) const;
-    // This function returns the pointer that previously stored in the same slot.
-    uint8_t* insertEntry(uint8_t* tuple) const;
+    // Inserts the tuple into its slot, chaining it to the tuple previously stored in the slot.
+    void insertTuple(uint8_t* tuple) const;
 
     // Join hash table assumes all keys to be flat.
     void computeVectorHashes(std::vector<common::ValueVector*> keyVectors);
 
-    common::offset_t getHashValueColOffset() const;
-
 private:
     static constexpr uint64_t PREV_PTR_COL_IDX = 1;
     static constexpr uint64_t HASH_COL_IDX = 2;
+    static constexpr uint64_t NUM_PARTITIONS_LOG2 = 8;
+    static constexpr uint64_t NUM_PARTITIONS = 1 << NUM_PARTITIONS_LOG2;
+    static constexpr uint64_t MIN_NUM_TUPLES_TO_BUILD_IN_PARALLEL = 1 << 20;
     const FactorizedTableSchema* tableSchema;
     uint64_t prevPtrColOffset;
+    uint64_t numHashSlotsLog2 = 0;
 };
 
 } // namespace processor
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "common/vector/value_vector.h"
+#include "processor/data_pos.h"
+#include "processor/result/result_set.h"
+
+namespace kuzu {
+namespace processor {
+
+class JoinHashTable;
+
+// A filter built from the keys of a join hash table once the build side is finalized. It is
+// passed to the scans on the probe side, so that tuples whose keys cannot find a match are
+// discarded before they are materialized and flow through the probe pipeline.
+// The filter consists of a register-blocked bloom filter on the key hashes (each key sets
+// NUM_BITS_PER_KEY bits inside a single 64-bit word) and, for integer keys, the min/max range of
+// the keys. It has false positives but no false negatives, so it is only used for inner joins.
+class RuntimeJoinFilter {
+    static constexpr uint64_t NUM_BITS_PER_KEY = 16;
+    static constexpr uint64_t NUM_HASH_BITS_PER_KEY = 4;
+    static constexpr uint64_t MAX_NUM_WORDS = 1 << 22; // 32MB.
+
+public:
+    explicit RuntimeJoinFilter(common::LogicalType keyType)
+        : keyType{std::move(keyType)}, wordIdxMask{0}, hasRange{false}, min{0}, max{0},
+          built{false} {}
+
+    const common::LogicalType& getKeyType() const { return keyType; }
+
+    // Must be called after all tuples are appended to the hash table, by a single thread.
+    void build(JoinHashTable& hashTable);
+    // Builds the filter from tuples spread over multiple hash tables (e.g., the runs of a spilled
+    // build side): init() sizes the filter for the total number of tuples, and insert() adds the
+    // tuples of one table.
+    void init(uint64_t numTuples);
+    void insert(JoinHashTable& hashTable);
+
+    // Discards the keys that are guaranteed to have no match in the hash table from the selection
+    // vector of the key vector's state. The hash vector must be unflat and is used as scratch.
+    void select(common::ValueVector& keyVector, common::ValueVector& hashVector) const;
+
+private:
+    static uint64_t getBitMask(common::hash_t hash) {
+        uint64_t mask = 0;
+        for (auto i = 0u; i < NUM_HASH_BITS_PER_KEY; i++) {
+            mask |= (uint64_t)1 << ((hash >> (i * 6)) & 63);
+        }
+        return mask;
+    }
+    uint64_t getWordIdx(common::hash_t hash) const { return (hash >> 32) & wordIdxMask; }
+
+    void insertHash(common::hash_t hash) { words[getWordIdx(hash)] |= getBitMask(hash); }
+    bool mayContain(common::hash_t hash) const {
+        const auto mask = getBitMask(hash);
+        return (words[getWordIdx(hash)] & mask) == mask;
+    }
+
+    void extendRange(JoinHashTable& hashTable);
+
+private:
+    common::LogicalType keyType;
+    std::vector<uint64_t> words;
+    uint64_t wordIdxMask;
+    bool hasRange;
+    int64_t min;
+    int64_t max;
+    bool built;
+};
+
+// Applies a runtime join filter to the key vector in the result set of a probe side pipeline. Each
+// clone of the operator applying the filter holds its own RuntimeJoinFilterApplier. The filter is
+// turned off for the clone if it turns out not to be selective.
+class RuntimeJoinFilterApplier {
+    static constexpr uint64_t MIN_NUM_TUPLES_TO_SAMPLE = 4 * common::DEFAULT_VECTOR_CAPACITY;
+    static constexpr double MAX_SELECTIVITY = 0.9;
+
+public:
+    RuntimeJoinFilterApplier(DataPos keyPos, std::shared_ptr<RuntimeJoinFilter> filter)
+        : keyPos{keyPos}, filter{std::move(filter)}, keyVector{nullptr}, numInputTuples{0},
+          numOutputTuples{0}, enabled{true} {}
+    EXPLICIT_COPY_DEFAULT_MOVE(RuntimeJoinFilterApplier);
+
+    void init(const ResultSet& resultSet, storage::MemoryManager* memoryManager);
+
+    // Returns the number of selected tuples in the key vector's state after filtering.
+    common::sel_t apply();
+
+    bool isEnabled() const { return enabled; }
+
+private:
+    RuntimeJoinFilterApplier(const RuntimeJoinFilterApplier& other)
+        : keyPos{other.keyPos}, filter{other.filter}, keyVector{nullptr}, numInputTuples{0},
+          numOutputTuples{0}, enabled{true} {}
+
+private:
+    DataPos keyPos;
+    std::shared_ptr<RuntimeJoinFilter> filter;
+    common::ValueVector* keyVector;
+    std::unique_ptr<common::ValueVector> hashVector;
+    uint64_t numInputTuples;
+    uint64_t numOutputTuples;
+    bool enabled;
+};
+
+} // namespace processor
+} // namespace kuzu
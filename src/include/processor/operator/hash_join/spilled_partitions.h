@@ -0,0 +1,86 @@
+#pragma once
+
+#include <functional>
+#include <type_traits>
+
+#include "common/vector/value_vector.h"
+#include "processor/operator/hash_join/join_hash_table.h"
+#include "processor/result/factorized_table.h"
+
+namespace kuzu {
+namespace processor {
+
+// Splits the selected tuples of a batch into partitions by the hash of a key, so that the tuples
+// of both sides of a hash join with equal keys fall into the same partition. The partition is taken
+// from the least significant bits of the hash, which are independent of the bits used to locate the
+// hash slot in a JoinHashTable.
+class JoinPartitioner {
+public:
+    static constexpr uint64_t NUM_PARTITIONS_LOG2 = 5;
+    static constexpr uint64_t NUM_PARTITIONS = 1 << NUM_PARTITIONS_LOG2;
+
+    explicit JoinPartitioner(storage::MemoryManager* memoryManager);
+
+    // Calls func(partitionIdx) for each partition that the selected tuples of the key vector's
+    // state fall into. If the state is unflat, it only selects the tuples of the partition during
+    // the call.
+    void partition(common::ValueVector& keyVector, const std::function<void(uint64_t)>& func);
+
+private:
+    static uint64_t getPartitionIdx(common::hash_t hash) { return hash & (NUM_PARTITIONS - 1); }
+
+private:
+    std::unique_ptr<common::ValueVector> hashVector;
+    std::shared_ptr<common::SelectionVector> partitionSelVector;
+    std::vector<common::sel_t> partitionIdxes;
+    std::vector<common::sel_t> partitionOffsets;
+    std::vector<common::sel_t> sortedPositions;
+};
+
+// The tuples that a thread spilled, as a list of runs for each partition. Runs are allocated from a
+// spillable memory manager. Tuples are appended to the last run of a partition, which is only
+// pinned during the append, so that the partially filled blocks of all partitions don't have to
+// fit in memory at once. Once the last run grows to MAX_NUM_BLOCKS_PER_RUN blocks, a new run is
+// started. Buffers keep their address when they are pinned again, so pointers into a run stay
+// valid. RUN is either a FactorizedTable or a hash table (JoinHashTable or AggregateHashTable).
+template<typename RUN>
+class SpilledPartitions {
+    static constexpr uint64_t MAX_NUM_BLOCKS_PER_RUN = 2;
+
+public:
+    explicit SpilledPartitions(std::function<std::unique_ptr<RUN>()> createRun)
+        : createRun{std::move(createRun)}, partitions(JoinPartitioner::NUM_PARTITIONS) {}
+
+    // Calls func(run) with the pinned run of the partition to append to.
+    template<typename FUNC>
+    void append(uint64_t partitionIdx, FUNC func) {
+        auto& runs = partitions[partitionIdx];
+        if (runs.empty() || getNumBlocks(*runs.back()) >= MAX_NUM_BLOCKS_PER_RUN) {
+            runs.push_back(createRun());
+        } else {
+            runs.back()->pin();
+        }
+        func(*runs.back());
+        runs.back()->unpin();
+    }
+
+    std::vector<std::unique_ptr<RUN>>& getRuns(uint64_t partitionIdx) {
+        return partitions[partitionIdx];
+    }
+
+private:
+    static uint64_t getNumBlocks(RUN& run) {
+        if constexpr (std::is_same_v<RUN, FactorizedTable>) {
+            return run.getTupleDataBlocks().size();
+        } else {
+            return run.getFactorizedTable()->getTupleDataBlocks().size();
+        }
+    }
+
+private:
+    std::function<std::unique_ptr<RUN>()> createRun;
+    std::vector<std::vector<std::unique_ptr<RUN>>> partitions;
+};
+
+} // namespace processor
+} // namespace kuzu
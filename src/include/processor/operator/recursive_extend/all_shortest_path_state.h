@@ -8,8 +8,10 @@ namespace processor {
 template<bool TRACK_PATH>
 class AllShortestPathState : public BaseBFSState {
 public:
-    AllShortestPathState(uint8_t upperBound, TargetDstNodes* targetDstNodes)
-        : BaseBFSState{upperBound, targetDstNodes}, minDistance{0}, numVisitedDstNodes{0} {}
+    AllShortestPathState(uint8_t upperBound, TargetDstNodes* targetDstNodes,
+        const DenseNodeMapInfo& denseNodeMapInfo)
+        : BaseBFSState{upperBound, targetDstNodes, denseNodeMapInfo}, minDistance{0},
+          numVisitedDstNodes{0}, visitedNodeToDistance{denseNodeMapInfo} {}
 
     inline bool isComplete() final {
         return isCurrentFrontierEmpty() || isUpperBoundReached() ||
@@ -17,43 +19,52 @@ public:
     }
 
     inline void resetState() final {
+        // All visited nodes are in some frontier.
+        for (auto& frontier : frontiers) {
+            for (auto& nodeID : frontier->nodeIDs) {
+                visitedNodeToDistance.erase(nodeID);
+            }
+        }
         BaseBFSState::resetState();
         minDistance = 0;
         numVisitedDstNodes = 0;
-        visitedNodeToDistance.clear();
     }
 
     inline void markSrc(common::nodeID_t nodeID) override {
-        visitedNodeToDistance.insert({nodeID, -1});
+        visitedNodeToDistance.getOrInsert(nodeID) = toStoredDistance(-1);
         if (targetDstNodes->contains(nodeID)) {
             numVisitedDstNodes++;
         }
-        currentFrontier->addNodeWithMultiplicity(nodeID, 1);
+        currentFrontier->addSrcNode(nodeID);
     }
 
     void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
         common::relID_t relID, uint64_t multiplicity) final {
-        if (!visitedNodeToDistance.contains(nbrNodeID)) {
-            visitedNodeToDistance.insert({nbrNodeID, (int64_t)currentLevel});
+        auto& distance = visitedNodeToDistance.getOrInsert(nbrNodeID);
+        if (distance == 0) {
+            distance = toStoredDistance(currentLevel);
             if (targetDstNodes->contains(nbrNodeID)) {
                 minDistance = currentLevel;
                 numVisitedDstNodes++;
             }
             if constexpr (TRACK_PATH) {
-                nextFrontier->addEdge(boundNodeID, nbrNodeID, relID);
+                nextFrontier->addEdge(boundNodeID, nbrNodeID, relID, nodeIdxes);
             } else {
-                nextFrontier->addNodeWithMultiplicity(nbrNodeID, multiplicity);
+                nextFrontier->addNodeWithMultiplicity(nbrNodeID, multiplicity, nodeIdxes);
             }
-        } else if (currentLevel <= visitedNodeToDistance.at(nbrNodeID)) {
+        } else if (toStoredDistance(currentLevel) <= distance) {
             if constexpr (TRACK_PATH) {
-                nextFrontier->addEdge(boundNodeID, nbrNodeID, relID);
+                nextFrontier->addEdge(boundNodeID, nbrNodeID, relID, nodeIdxes);
             } else {
-                nextFrontier->addNodeWithMultiplicity(nbrNodeID, multiplicity);
+                nextFrontier->addNodeWithMultiplicity(nbrNodeID, multiplicity, nodeIdxes);
             }
         }
     }
 
 private:
+    // Distances are stored shifted by 2, so that 0 means not visited and the src is at -1.
+    static uint16_t toStoredDistance(int64_t distance) { return distance + 2; }
+
     inline bool isAllDstReachedWithMinDistance() const {
         return numVisitedDstNodes == targetDstNodes->getNumNodes() && currentLevel > minDistance;
     }
@@ -61,7 +72,7 @@ private:
 private:
     uint32_t minDistance; // Min distance to add dst nodes that have been reached.
     uint64_t numVisitedDstNodes;
-    common::node_id_map_t<int64_t> visitedNodeToDistance;
+    DenseNodeMap<uint16_t> visitedNodeToDistance;
 };
 
 } // namespace processor
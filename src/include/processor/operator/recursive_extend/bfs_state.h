@@ -30,6 +30,8 @@ public:
     }
 
     inline uint64_t getNumNodes() const { return numNodes; }
+    // Empty if there is no semi mask.
+    inline const common::node_id_set_t& getNodeIDs() const { return nodeIDs; }
 
 private:
     uint64_t numNodes;
@@ -39,9 +41,10 @@ private:
 
 class BaseBFSState {
 public:
-    explicit BaseBFSState(uint8_t upperBound, TargetDstNodes* targetDstNodes)
+    BaseBFSState(uint8_t upperBound, TargetDstNodes* targetDstNodes,
+        const DenseNodeMapInfo& denseNodeMapInfo)
         : upperBound{upperBound}, currentLevel{0}, nextNodeIdxToExtend{0},
-          targetDstNodes{targetDstNodes} {}
+          targetDstNodes{targetDstNodes}, nodeIdxes{denseNodeMapInfo} {}
     virtual ~BaseBFSState() = default;
 
     // Get next node offset to extend from current level.
@@ -53,6 +56,10 @@ public:
     }
 
     virtual void resetState() {
+        if (!frontiers.empty()) {
+            // The BFS may complete before the last frontier is finalized.
+            frontiers.back()->clearNodeIdxes(nodeIdxes);
+        }
         currentLevel = 0;
         nextNodeIdxToExtend = 0;
         frontiers.clear();
@@ -64,8 +71,9 @@ public:
     virtual void markSrc(common::nodeID_t nodeID) = 0;
     virtual void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
         common::relID_t relID, uint64_t multiplicity) = 0;
-    inline uint64_t getMultiplicity(common::nodeID_t nodeID) const {
-        return currentFrontier->getMultiplicity(nodeID);
+    // Multiplicity of the node last returned by getNextNodeID().
+    inline uint64_t getBoundNodeMultiplicity() const {
+        return currentFrontier->getMultiplicity(nextNodeIdxToExtend - 1);
     }
 
     inline void finalizeCurrentLevel() { moveNextLevelAsCurrentLevel(); }
@@ -85,12 +93,13 @@ protected:
         nextFrontier = frontiers[frontiers.size() - 1].get();
     }
     void moveNextLevelAsCurrentLevel() {
+        nextFrontier->clearNodeIdxes(nodeIdxes);
         currentFrontier = nextFrontier;
         currentLevel++;
         nextNodeIdxToExtend = 0;
         if (currentLevel < upperBound) { // No need to sort if we are not extending further.
             addNextFrontier();
-            std::sort(currentFrontier->nodeIDs.begin(), currentFrontier->nodeIDs.end());
+            currentFrontier->sortNodes();
         }
     }
 
@@ -105,6 +114,8 @@ protected:
     std::vector<std::unique_ptr<Frontier>> frontiers;
     // Target information.
     TargetDstNodes* targetDstNodes;
+    // Positions of the nodes in the frontier being built.
+    Frontier::node_idx_map_t nodeIdxes;
 };
 
 } // namespace processor
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+
+#include "common/types/internal_id_util.h"
+
+namespace kuzu {
+namespace processor {
+
+/**
+ * BFS state to find the shortest paths between a single pair of nodes by searching from both ends.
+ * Each step extends the side with the smaller frontier by one level, and the search stops at the
+ * first level where the two sides meet. A shortest path of length fwdLevel + bwdLevel can only
+ * meet the other side in its current frontier, so counting paths only requires the number of
+ * paths from each end to the nodes of the two frontiers.
+ */
+class BidirectionalBFSState {
+    struct Side {
+        uint8_t level = 0;
+        common::node_id_set_t visited;
+        // Nodes of the current level along with their number of shortest paths from this end.
+        common::node_id_map_t<uint64_t> frontier;
+        std::vector<common::nodeID_t> frontierNodeIDs;
+        common::node_id_map_t<uint64_t> nextFrontier;
+
+        void reset(common::nodeID_t nodeID) {
+            level = 0;
+            visited.clear();
+            visited.insert(nodeID);
+            frontier.clear();
+            frontier.insert({nodeID, 1});
+            frontierNodeIDs.clear();
+            frontierNodeIDs.push_back(nodeID);
+            nextFrontier.clear();
+        }
+    };
+
+public:
+    explicit BidirectionalBFSState(uint8_t upperBound)
+        : upperBound{upperBound}, extendingFwd{true}, nextNodeIdxToExtend{0}, numShortestPaths{0} {}
+
+    void resetState(common::nodeID_t srcNodeID, common::nodeID_t dstNodeID) {
+        fwd.reset(srcNodeID);
+        bwd.reset(dstNodeID);
+        extendingFwd = true;
+        nextNodeIdxToExtend = 0;
+        numShortestPaths = srcNodeID == dstNodeID ? 1 : 0;
+    }
+
+    bool isComplete() const {
+        return numShortestPaths != 0 || fwd.frontier.empty() || bwd.frontier.empty() ||
+               fwd.level + bwd.level == upperBound;
+    }
+
+    // Whether the current level is extended from the src node (with the recursive plan) or from
+    // the dst node (with the backward recursive plan).
+    bool isExtendingFwd() const { return extendingFwd; }
+    bool isFirstLevelOfSide() const { return getExtendingSide().level == 0; }
+
+    // Get next node offset to extend from the current level of the extending side.
+    common::nodeID_t getNextNodeID() {
+        auto& side = getExtendingSide();
+        if (nextNodeIdxToExtend == side.frontierNodeIDs.size()) {
+            return common::nodeID_t{common::INVALID_OFFSET, common::INVALID_TABLE_ID};
+        }
+        return side.frontierNodeIDs[nextNodeIdxToExtend++];
+    }
+
+    void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID) {
+        auto& side = getExtendingSide();
+        if (side.visited.contains(nbrNodeID)) {
+            return;
+        }
+        side.nextFrontier[nbrNodeID] += side.frontier.at(boundNodeID);
+    }
+
+    void finalizeCurrentLevel() {
+        auto& side = getExtendingSide();
+        auto& otherSide = extendingFwd ? bwd : fwd;
+        side.level++;
+        for (auto& [nodeID, numPaths] : side.nextFrontier) {
+            side.visited.insert(nodeID);
+            if (otherSide.frontier.contains(nodeID)) {
+                numShortestPaths += numPaths * otherSide.frontier.at(nodeID);
+            }
+        }
+        side.frontier = std::move(side.nextFrontier);
+        side.nextFrontier.clear();
+        side.frontierNodeIDs.clear();
+        for (auto& [nodeID, _] : side.frontier) {
+            side.frontierNodeIDs.push_back(nodeID);
+        }
+        std::sort(side.frontierNodeIDs.begin(), side.frontierNodeIDs.end());
+        extendingFwd = fwd.frontier.size() <= bwd.frontier.size();
+        nextNodeIdxToExtend = 0;
+    }
+
+    // Both are only valid if the search is complete.
+    uint64_t getNumShortestPaths() const { return numShortestPaths; }
+    uint8_t getShortestPathLength() const { return fwd.level + bwd.level; }
+
+private:
+    const Side& getExtendingSide() const { return extendingFwd ? fwd : bwd; }
+    Side& getExtendingSide() { return extendingFwd ? fwd : bwd; }
+
+private:
+    uint8_t upperBound;
+    Side fwd;
+    Side bwd;
+    bool extendingFwd;
+    uint64_t nextNodeIdxToExtend;
+    uint64_t numShortestPaths;
+};
+
+} // namespace processor
+} // namespace kuzu
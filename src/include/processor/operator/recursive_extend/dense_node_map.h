@@ -0,0 +1,133 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+
+#include "common/types/internal_id_util.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+namespace kuzu {
+namespace processor {
+
+// What a DenseNodeMap needs to allocate its arrays.
+struct DenseNodeMapInfo {
+    storage::MemoryManager* memoryManager = nullptr;
+    // Sizes of the node tables whose values may be kept in arrays.
+    common::table_id_map_t<common::offset_t> numNodesPerTable;
+};
+
+/**
+ * A map from nodeIDs to values of type T. Values start out in a hash map. Once the hash map holds
+ * so many values of a node table whose number of nodes is known that an array indexed by node
+ * offset would take up less memory, the values of that table are moved into such an array, which
+ * is allocated from the memory manager. So BFS states whose frontiers stay small never allocate
+ * memory proportional to the size of the tables. A zero T means that the node has no value. BFS
+ * states reuse the map across sources and erase the values of the nodes they visited, so resetting
+ * is proportional to the number of visited nodes rather than to the size of the tables. Arrays are
+ * kept once allocated.
+ */
+template<typename T>
+class DenseNodeMap {
+    static_assert(std::is_integral_v<T>);
+
+    struct TableValues {
+        common::offset_t numNodes;
+        uint64_t numSparseValues = 0;
+        std::unique_ptr<storage::MemoryBuffer> denseValues;
+
+        explicit TableValues(common::offset_t numNodes) : numNodes{numNodes} {}
+    };
+
+public:
+    static constexpr common::offset_t MAX_NUM_DENSE_NODES = 1 << 24;
+    // Rough number of bytes a value takes up in the hash map.
+    static constexpr uint64_t NUM_BYTES_PER_SPARSE_VALUE =
+        sizeof(common::nodeID_t) + sizeof(T) + 2 * sizeof(void*);
+
+    explicit DenseNodeMap(const DenseNodeMapInfo& info) : memoryManager{info.memoryManager} {
+        for (auto& [tableID, numNodes] : info.numNodesPerTable) {
+            tables.emplace(tableID, TableValues{numNodes});
+        }
+    }
+
+    T get(common::nodeID_t nodeID) {
+        if (auto value = getDenseValue(nodeID)) {
+            return *value;
+        }
+        auto iter = sparseValues.find(nodeID);
+        return iter == sparseValues.end() ? T{} : iter->second;
+    }
+    T& getOrInsert(common::nodeID_t nodeID) {
+        if (auto value = getDenseValue(nodeID)) {
+            return *value;
+        }
+        auto [iter, inserted] = sparseValues.try_emplace(nodeID, T{});
+        if (inserted && cachedTable != nullptr && nodeID.offset < cachedTable->numNodes &&
+            ++cachedTable->numSparseValues * NUM_BYTES_PER_SPARSE_VALUE >=
+                getNumDenseBytes(cachedTable->numNodes) &&
+            numDenseNodes + cachedTable->numNodes <= MAX_NUM_DENSE_NODES) {
+            makeDense(nodeID.tableID, *cachedTable);
+            return *getDenseValue(nodeID);
+        }
+        return iter->second;
+    }
+    void erase(common::nodeID_t nodeID) {
+        if (auto value = getDenseValue(nodeID)) {
+            *value = T{};
+            return;
+        }
+        if (sparseValues.erase(nodeID) > 0 && cachedTable != nullptr &&
+            nodeID.offset < cachedTable->numNodes) {
+            cachedTable->numSparseValues--;
+        }
+    }
+
+private:
+    static uint64_t getNumDenseBytes(common::offset_t numNodes) {
+        // Small buffers still take up a whole page of the memory manager.
+        return std::max<uint64_t>(numNodes * sizeof(T),
+            common::BufferPoolConstants::PAGE_256KB_SIZE);
+    }
+
+    // Also caches the table of the node, even if its values are not in an array.
+    T* getDenseValue(common::nodeID_t nodeID) {
+        // Consecutive lookups are mostly for nodes of the same table.
+        if (nodeID.tableID != cachedTableID) {
+            cachedTableID = nodeID.tableID;
+            auto iter = tables.find(cachedTableID);
+            cachedTable = iter == tables.end() ? nullptr : &iter->second;
+        }
+        if (cachedTable == nullptr || cachedTable->denseValues == nullptr ||
+            nodeID.offset >= cachedTable->numNodes) {
+            return nullptr;
+        }
+        return reinterpret_cast<T*>(cachedTable->denseValues->buffer.data()) + nodeID.offset;
+    }
+
+    void makeDense(common::table_id_t tableID, TableValues& table) {
+        table.denseValues =
+            memoryManager->allocateBuffer(true /* initializeToZero */, table.numNodes * sizeof(T));
+        numDenseNodes += table.numNodes;
+        auto values = reinterpret_cast<T*>(table.denseValues->buffer.data());
+        for (auto iter = sparseValues.begin(); iter != sparseValues.end();) {
+            if (iter->first.tableID == tableID && iter->first.offset < table.numNodes) {
+                values[iter->first.offset] = iter->second;
+                iter = sparseValues.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+        table.numSparseValues = 0;
+    }
+
+private:
+    storage::MemoryManager* memoryManager;
+    common::table_id_map_t<TableValues> tables;
+    common::offset_t numDenseNodes = 0;
+    common::node_id_map_t<T> sparseValues;
+    common::table_id_t cachedTableID = common::INVALID_TABLE_ID;
+    TableValues* cachedTable = nullptr;
+};
+
+} // namespace processor
+} // namespace kuzu
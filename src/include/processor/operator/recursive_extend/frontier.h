@@ -1,6 +1,6 @@
 #pragma once
 
-#include "common/types/internal_id_util.h"
+#include "dense_node_map.h"
 
 namespace kuzu {
 namespace processor {
@@ -8,35 +8,54 @@ namespace processor {
 using node_rel_id_t = std::pair<common::nodeID_t, common::relID_t>;
 
 /*
- * A Frontier can stores dst node offsets, its multiplicity and its bwd edges. Note that we don't
- * need to track all information in BFS computation.
+ * A Frontier stores dst node IDs, and their multiplicities and bwd edges in vectors parallel to the
+ * node IDs. Note that we don't need to track all information in BFS computation.
  *
  * Computation                   |  Information tracked
  * Shortest path track path      |  nodeIDs & bwdEdges
  * Shortest path NOT track path  |  nodeIDs
  * Var length track path         |  nodeIDs & bwdEdges
- * Var length NOT track path     |  nodeIDs & nodeIDToMultiplicity
+ * Var length NOT track path     |  nodeIDs & multiplicities
+ *
+ * While a frontier is built, the position of each of its nodes is kept in a DenseNodeMap (shifted
+ * by 1 so that 0 means not in the frontier), which is shared by all frontiers of a BFS because only
+ * one frontier is built at a time.
  */
 class Frontier {
 public:
+    using node_idx_map_t = DenseNodeMap<common::idx_t>;
+
     inline void resetState() {
         nodeIDs.clear();
         bwdEdges.clear();
-        nodeIDToMultiplicity.clear();
+        multiplicities.clear();
     }
 
-    void addEdge(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID, common::nodeID_t relID);
+    // Src nodes are added to the first frontier, which is not built through a node_idx_map_t.
+    void addSrcNode(common::nodeID_t nodeID);
+
+    void addEdge(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID, common::nodeID_t relID,
+        node_idx_map_t& nodeIdxes);
 
-    void addNodeWithMultiplicity(common::nodeID_t nodeID, uint64_t multiplicity);
+    void addNodeWithMultiplicity(common::nodeID_t nodeID, uint64_t multiplicity,
+        node_idx_map_t& nodeIdxes);
 
-    inline uint64_t getMultiplicity(common::nodeID_t nodeID) const {
-        return nodeIDToMultiplicity.empty() ? 1 : nodeIDToMultiplicity.at(nodeID);
+    // Must be called once the frontier is built, before nodeIdxes is used for another frontier.
+    void clearNodeIdxes(node_idx_map_t& nodeIdxes) const;
+
+    void sortNodes();
+
+    inline uint64_t getMultiplicity(common::idx_t nodeIdx) const {
+        return multiplicities.empty() ? 1 : multiplicities[nodeIdx];
     }
 
+    // Looks up the bwd edges of a node. The frontier must be sorted.
+    const std::vector<node_rel_id_t>& getBwdEdges(common::nodeID_t nodeID) const;
+
 public:
     std::vector<common::nodeID_t> nodeIDs;
-    common::node_id_map_t<std::vector<node_rel_id_t>> bwdEdges;
-    common::node_id_map_t<uint64_t> nodeIDToMultiplicity;
+    std::vector<std::vector<node_rel_id_t>> bwdEdges;
+    std::vector<uint64_t> multiplicities;
 };
 
 // We assume number of edges per table is smaller than 2^63. So we mask the highest bit of rel
@@ -59,7 +59,7 @@ using path_semantic_check_func_t =
     std::function<bool(const std::vector<common::nodeID_t>&, const std::vector<common::relID_t>&)>;
 
 class PathScanner : public BaseFrontierScanner {
-    using nbrs_t = std::vector<node_rel_id_t>*;
+    using nbrs_t = const std::vector<node_rel_id_t>*;
 
 public:
     PathScanner(TargetDstNodes* targetDstNodes, size_t k,
@@ -79,16 +79,13 @@ public:
         const std::vector<common::relID_t>& edgeIDs);
 
 private:
-    inline void initScanFromDstOffset() final {
-        auto dummyRelID = common::relID_t{common::INVALID_OFFSET, common::INVALID_TABLE_ID};
-        initDfs(std::make_pair(currentDstNodeID, dummyRelID), k);
-    }
+    void initScanFromDstOffset() final;
     // Scan current stacks until exhausted or vector is filled up.
     void scanFromDstOffset(RecursiveJoinVectors& vectors, common::sel_t& vectorPos,
         common::sel_t& nodeIDDataVectorPos, common::sel_t& relIDDataVectorPos) final;
 
-    // Initialize stacks for given offset.
-    void initDfs(const node_rel_id_t& nodeAndRelID, size_t currentDepth);
+    // Initialize stacks for given nbrs of the node at currentDepth.
+    void initDfs(nbrs_t nbrs, size_t currentDepth);
 
     void writePathToVector(RecursiveJoinVectors& vectors, common::sel_t& vectorPos,
         common::sel_t& nodeIDDataVectorPos, common::sel_t& relIDDataVectorPos);
@@ -120,12 +117,18 @@ private:
 class DstNodeWithMultiplicityScanner : public BaseFrontierScanner {
 public:
     DstNodeWithMultiplicityScanner(TargetDstNodes* targetDstNodes, size_t k)
-        : BaseFrontierScanner{targetDstNodes, k} {}
+        : BaseFrontierScanner{targetDstNodes, k}, multiplicity{0} {}
 
 private:
-    inline void initScanFromDstOffset() final {}
+    inline void initScanFromDstOffset() final {
+        multiplicity = frontiers[k]->getMultiplicity(lastFrontierCursor - 1);
+    }
     void scanFromDstOffset(RecursiveJoinVectors& vectors, common::sel_t& vectorPos,
         common::sel_t& nodeIDDataVectorPos, common::sel_t& relIDDataVectorPos) final;
+
+private:
+    // Number of times the current dst node remains to be written.
+    uint64_t multiplicity;
 };
 
 /*
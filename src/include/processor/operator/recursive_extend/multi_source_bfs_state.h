@@ -0,0 +1,181 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+
+#include "bfs_state.h"
+
+namespace kuzu {
+namespace processor {
+
+/**
+ * Shortest path BFS state for a batch of up to 64 sources (MS-BFS). Each node keeps a bitmask of
+ * the sources it has been reached from, so a node in the frontier of several sources is extended
+ * only once per level and the adjacency scan is shared by all of them. Since a bitmask cannot carry
+ * multiplicities, this is only used for shortest paths where the path is not tracked.
+ */
+class MultiSourceShortestPathState {
+    using src_mask_t = uint64_t;
+
+public:
+    static constexpr uint64_t MAX_NUM_SOURCES = sizeof(src_mask_t) * 8;
+
+    // A dst node reached from a source, along with the length of its shortest path.
+    struct DstNode {
+        common::nodeID_t nodeID;
+        uint8_t length;
+    };
+
+    MultiSourceShortestPathState(uint8_t lowerBound, uint8_t upperBound,
+        TargetDstNodes* targetDstNodes,
+        const DenseNodeMapInfo& denseNodeMapInfo)
+        : lowerBound{lowerBound}, upperBound{upperBound}, currentLevel{0},
+          nextNodeIdxToExtend{0}, boundNodeMask{0}, activeSrcMask{0}, visited{denseNodeMapInfo},
+          nextFrontierNodeIdxes{denseNodeMapInfo}, targetDstNodes{targetDstNodes} {}
+
+    void resetState() {
+        currentLevel = 0;
+        nextNodeIdxToExtend = 0;
+        boundNodeMask = 0;
+        activeSrcMask = 0;
+        numSources = 0;
+        for (auto& nodeID : visitedNodeIDs) {
+            visited.erase(nodeID);
+        }
+        visitedNodeIDs.clear();
+        clearNextFrontier();
+        currentFrontier.clear();
+        for (auto i = 0u; i < MAX_NUM_SOURCES; ++i) {
+            numVisitedDstNodes[i] = 0;
+            dstNodes[i].clear();
+        }
+    }
+
+    bool isFull() const { return numSources == MAX_NUM_SOURCES; }
+    uint64_t getNumSources() const { return numSources; }
+    bool isComplete() const {
+        return currentFrontier.empty() || currentLevel == upperBound || activeSrcMask == 0;
+    }
+
+    // Sources must be added before the BFS starts.
+    void addSrc(common::nodeID_t nodeID) {
+        KU_ASSERT(!isFull() && currentLevel == 0);
+        const src_mask_t srcMask = src_mask_t{1} << numSources++;
+        activeSrcMask |= srcMask;
+        auto& nodeMask = visited.getOrInsert(nodeID);
+        if (nodeMask == 0) {
+            visitedNodeIDs.push_back(nodeID);
+            currentFrontier.emplace_back(nodeID, srcMask);
+        } else {
+            // The same node is the source of an earlier tuple in the batch.
+            std::find_if(currentFrontier.begin(), currentFrontier.end(), [&](const auto& entry) {
+                return entry.first == nodeID;
+            })->second |= srcMask;
+        }
+        nodeMask |= srcMask;
+        if (targetDstNodes->contains(nodeID)) {
+            markDstNodeVisited(nodeID, srcMask);
+        }
+    }
+
+    // Get next node to extend from current level. Nodes reached only from sources that have
+    // already visited all their dst nodes are skipped.
+    common::nodeID_t getNextNodeID() {
+        while (nextNodeIdxToExtend < currentFrontier.size()) {
+            auto& [nodeID, nodeMask] = currentFrontier[nextNodeIdxToExtend++];
+            boundNodeMask = nodeMask & activeSrcMask;
+            if (boundNodeMask != 0) {
+                return nodeID;
+            }
+        }
+        return common::nodeID_t{common::INVALID_OFFSET, common::INVALID_TABLE_ID};
+    }
+
+    // Marks the nbr as visited from all sources of the node returned by the last getNextNodeID().
+    void markVisited(common::nodeID_t nbrNodeID) {
+        auto& nodeMask = visited.getOrInsert(nbrNodeID);
+        const auto newSrcMask = boundNodeMask & ~nodeMask;
+        if (newSrcMask == 0) {
+            return;
+        }
+        if (nodeMask == 0) {
+            visitedNodeIDs.push_back(nbrNodeID);
+        }
+        nodeMask |= newSrcMask;
+        auto& nodeIdx = nextFrontierNodeIdxes.getOrInsert(nbrNodeID);
+        if (nodeIdx == 0) {
+            nextFrontier.emplace_back(nbrNodeID, newSrcMask);
+            nodeIdx = nextFrontier.size();
+        } else {
+            nextFrontier[nodeIdx - 1].second |= newSrcMask;
+        }
+        if (targetDstNodes->contains(nbrNodeID)) {
+            markDstNodeVisited(nbrNodeID, newSrcMask, currentLevel + 1);
+        }
+    }
+
+    void finalizeCurrentLevel() {
+        currentLevel++;
+        nextNodeIdxToExtend = 0;
+        currentFrontier.clear();
+        if (currentLevel < upperBound) { // No need to sort if we are not extending further.
+            currentFrontier = nextFrontier;
+            std::sort(currentFrontier.begin(), currentFrontier.end());
+        }
+        clearNextFrontier();
+    }
+
+    // Dst nodes reached from the source at srcIdx, in the order of their path length.
+    const std::vector<DstNode>& getDstNodes(common::idx_t srcIdx) const {
+        KU_ASSERT(srcIdx < numSources);
+        return dstNodes[srcIdx];
+    }
+
+private:
+    void clearNextFrontier() {
+        for (auto& [nodeID, _] : nextFrontier) {
+            nextFrontierNodeIdxes.erase(nodeID);
+        }
+        nextFrontier.clear();
+    }
+
+    void markDstNodeVisited(common::nodeID_t nodeID, src_mask_t srcMask, uint8_t length = 0) {
+        while (srcMask != 0) {
+            const auto srcIdx = std::countr_zero(srcMask);
+            srcMask &= srcMask - 1;
+            if (length >= lowerBound) {
+                dstNodes[srcIdx].push_back(DstNode{nodeID, length});
+            }
+            if (++numVisitedDstNodes[srcIdx] == targetDstNodes->getNumNodes()) {
+                activeSrcMask &= ~(src_mask_t{1} << srcIdx);
+            }
+        }
+    }
+
+private:
+    // Static information
+    uint8_t lowerBound;
+    uint8_t upperBound;
+    // Level state
+    uint8_t currentLevel;
+    uint64_t nextNodeIdxToExtend;
+    src_mask_t boundNodeMask;
+    // Sources that have not visited all their dst nodes yet.
+    src_mask_t activeSrcMask;
+    uint64_t numSources = 0;
+    // Bit i of a node's mask is set if the node has been reached from the i-th source.
+    DenseNodeMap<src_mask_t> visited;
+    std::vector<common::nodeID_t> visitedNodeIDs;
+    std::vector<std::pair<common::nodeID_t, src_mask_t>> currentFrontier;
+    std::vector<std::pair<common::nodeID_t, src_mask_t>> nextFrontier;
+    // Positions of the nodes in nextFrontier, shifted by 1.
+    DenseNodeMap<common::idx_t> nextFrontierNodeIdxes;
+    // Per source output.
+    uint64_t numVisitedDstNodes[MAX_NUM_SOURCES]{};
+    std::vector<DstNode> dstNodes[MAX_NUM_SOURCES];
+    // Target information.
+    TargetDstNodes* targetDstNodes;
+};
+
+} // namespace processor
+} // namespace kuzu
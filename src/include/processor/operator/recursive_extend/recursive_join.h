@@ -1,12 +1,15 @@
 #pragma once
 
 #include "bfs_state.h"
+#include "bidirectional_bfs_state.h"
 #include "common/enums/extend_direction.h"
 #include "common/enums/query_rel_type.h"
 #include "common/mask.h"
 #include "frontier_scanner.h"
+#include "multi_source_bfs_state.h"
 #include "planner/operator/extend/recursive_join_type.h"
 #include "processor/operator/physical_operator.h"
+#include "processor/result/factorized_table.h"
 
 namespace kuzu {
 namespace processor {
@@ -36,9 +39,17 @@ struct RecursiveJoinDataInfo {
     std::unordered_set<common::table_id_t> recursiveDstNodeTableIDs;
     DataPos recursiveEdgeIDPos;
     DataPos recursiveEdgeDirectionPos;
+    // Backward recursive join info. Only set if the shortest paths can be searched from both ends.
+    std::unique_ptr<ResultSetDescriptor> bwdLocalResultSetDescriptor;
+    DataPos bwdRecursiveNodePredicateExecFlagPos;
+    DataPos bwdRecursiveDstNodeIDPos;
     // Path info
     DataPos pathPos;
     std::unordered_map<common::table_id_t, std::string> tableIDToName;
+    // Multi-source info. Input tuples of a batch of sources are materialized while the batch is
+    // computed and restored when the output of their source is scanned.
+    std::vector<DataPos> srcPayloadsPos;
+    FactorizedTableSchema srcPayloadsTableSchema;
 
     RecursiveJoinDataInfo() = default;
     EXPLICIT_COPY_DEFAULT_MOVE(RecursiveJoinDataInfo);
@@ -56,8 +67,15 @@ private:
         recursiveDstNodeTableIDs = other.recursiveDstNodeTableIDs;
         recursiveEdgeIDPos = other.recursiveEdgeIDPos;
         recursiveEdgeDirectionPos = other.recursiveEdgeDirectionPos;
+        if (other.bwdLocalResultSetDescriptor != nullptr) {
+            bwdLocalResultSetDescriptor = other.bwdLocalResultSetDescriptor->copy();
+        }
+        bwdRecursiveNodePredicateExecFlagPos = other.bwdRecursiveNodePredicateExecFlagPos;
+        bwdRecursiveDstNodeIDPos = other.bwdRecursiveDstNodeIDPos;
         pathPos = other.pathPos;
         tableIDToName = other.tableIDToName;
+        srcPayloadsPos = other.srcPayloadsPos;
+        srcPayloadsTableSchema = other.srcPayloadsTableSchema.copy();
     }
 };
 
@@ -79,6 +97,9 @@ struct RecursiveJoinVectors {
     common::ValueVector* recursiveEdgeDirectionVector = nullptr;
     common::ValueVector* recursiveDstNodeIDVector = nullptr;
     common::ValueVector* recursiveNodePredicateExecFlagVector = nullptr;
+
+    common::ValueVector* bwdRecursiveDstNodeIDVector = nullptr;
+    common::ValueVector* bwdRecursiveNodePredicateExecFlagVector = nullptr;
 };
 
 struct RecursiveJoinInfo {
@@ -89,6 +110,8 @@ struct RecursiveJoinInfo {
     planner::RecursiveJoinType joinType;
     common::ExtendDirection direction;
     bool extendFromSource;
+    // Compute the BFS of a batch of sources together. See MultiSourceShortestPathState.
+    bool multiSource = false;
 
     RecursiveJoinInfo() = default;
     EXPLICIT_COPY_DEFAULT_MOVE(RecursiveJoinInfo);
@@ -102,6 +125,7 @@ private:
         joinType = other.joinType;
         direction = other.direction;
         extendFromSource = other.extendFromSource;
+        multiSource = other.multiSource;
     }
 };
 
@@ -111,10 +135,11 @@ class RecursiveJoin : public PhysicalOperator {
 public:
     RecursiveJoin(RecursiveJoinInfo info, std::shared_ptr<RecursiveJoinSharedState> sharedState,
         std::unique_ptr<PhysicalOperator> child, uint32_t id,
-        std::unique_ptr<PhysicalOperator> recursiveRoot, std::unique_ptr<OPPrintInfo> printInfo)
+        std::unique_ptr<PhysicalOperator> recursiveRoot,
+        std::unique_ptr<PhysicalOperator> bwdRecursiveRoot, std::unique_ptr<OPPrintInfo> printInfo)
         : PhysicalOperator{type_, std::move(child), id, std::move(printInfo)},
           info{std::move(info)}, sharedState{std::move(sharedState)},
-          recursiveRoot{std::move(recursiveRoot)} {}
+          recursiveRoot{std::move(recursiveRoot)}, bwdRecursiveRoot{std::move(bwdRecursiveRoot)} {}
 
     std::vector<common::NodeSemiMask*> getSemiMask() const;
 
@@ -123,13 +148,17 @@ public:
     bool getNextTuplesInternal(ExecutionContext* context) final;
 
     std::unique_ptr<PhysicalOperator> clone() final {
+        auto bwdRecursiveRootCopy =
+            bwdRecursiveRoot == nullptr ? nullptr : bwdRecursiveRoot->clone();
         return std::make_unique<RecursiveJoin>(info.copy(), sharedState, children[0]->clone(), id,
-            recursiveRoot->clone(), printInfo->copy());
+            recursiveRoot->clone(), std::move(bwdRecursiveRootCopy), printInfo->copy());
     }
 
 private:
     void initLocalRecursivePlan(ExecutionContext* context);
 
+    void initLocalBwdRecursivePlan(ExecutionContext* context);
+
     void populateTargetDstNodes(ExecutionContext* context);
 
     bool scanOutput();
@@ -139,6 +168,20 @@ private:
 
     void updateVisitedNodes(common::nodeID_t boundNodeID);
 
+    bool getNextTuplesMultiSource(ExecutionContext* context);
+
+    bool scanMultiSourceOutput();
+
+    // Compute BFS for the batch of src nodes in msBFSState.
+    void computeMultiSourceBFS(ExecutionContext* context);
+
+    void restoreSrcPayloads(common::idx_t srcIdx);
+
+    bool getNextTuplesBidirectional(ExecutionContext* context);
+
+    // Compute the shortest paths from a given src node to the only target dst node.
+    void computeBidirectionalBFS(ExecutionContext* context);
+
 private:
     RecursiveJoinInfo info;
     std::shared_ptr<RecursiveJoinSharedState> sharedState;
@@ -152,6 +195,26 @@ private:
     std::unique_ptr<BaseBFSState> bfsState;
     std::unique_ptr<FrontiersScanner> frontiersScanner;
     std::unique_ptr<TargetDstNodes> targetDstNodes;
+
+    // Multi-source state
+    std::unique_ptr<MultiSourceShortestPathState> msBFSState;
+    std::unique_ptr<FactorizedTable> srcPayloads;
+    std::vector<common::ValueVector*> srcPayloadVectors;
+    std::vector<ft_col_idx_t> srcPayloadColIdxes;
+    // Multiplicity of the result set when each source of the batch was pulled.
+    std::vector<uint64_t> srcMultiplicities;
+    bool hasMoreSources = true;
+    common::idx_t restoredSrcIdx = common::INVALID_IDX;
+    common::idx_t nextSrcIdxToScan = 0;
+    uint64_t nextDstIdxToScan = 0;
+
+    // Bidirectional state
+    std::unique_ptr<ResultSet> bwdLocalResultSet;
+    std::unique_ptr<PhysicalOperator> bwdRecursiveRoot;
+    OffsetScanNodeTable* bwdRecursiveSource = nullptr;
+    std::unique_ptr<BidirectionalBFSState> biBFSState;
+    common::nodeID_t targetDstNodeID;
+    uint64_t numDstRowsToScan = 0;
 };
 
 } // namespace processor
@@ -8,40 +8,48 @@ namespace processor {
 template<bool TRACK_PATH>
 class ShortestPathState : public BaseBFSState {
 public:
-    ShortestPathState(uint8_t upperBound, TargetDstNodes* targetDstNodes)
-        : BaseBFSState{upperBound, targetDstNodes}, numVisitedDstNodes{0} {}
+    ShortestPathState(uint8_t upperBound, TargetDstNodes* targetDstNodes,
+        const DenseNodeMapInfo& denseNodeMapInfo)
+        : BaseBFSState{upperBound, targetDstNodes, denseNodeMapInfo}, numVisitedDstNodes{0},
+          visited{denseNodeMapInfo} {}
     ~ShortestPathState() override = default;
 
     inline bool isComplete() final {
         return isCurrentFrontierEmpty() || isUpperBoundReached() || isAllDstReached();
     }
     inline void resetState() final {
+        // All visited nodes are in some frontier.
+        for (auto& frontier : frontiers) {
+            for (auto& nodeID : frontier->nodeIDs) {
+                visited.erase(nodeID);
+            }
+        }
         BaseBFSState::resetState();
         numVisitedDstNodes = 0;
-        visited.clear();
     }
 
     inline void markSrc(common::nodeID_t nodeID) final {
-        visited.insert(nodeID);
+        visited.getOrInsert(nodeID) = true;
         if (targetDstNodes->contains(nodeID)) {
             numVisitedDstNodes++;
         }
-        currentFrontier->addNodeWithMultiplicity(nodeID, 1);
+        currentFrontier->addSrcNode(nodeID);
     }
 
     inline void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
         common::nodeID_t relID, uint64_t /*multiplicity*/) final {
-        if (visited.contains(nbrNodeID)) {
+        auto& isVisited = visited.getOrInsert(nbrNodeID);
+        if (isVisited) {
             return;
         }
-        visited.insert(nbrNodeID);
+        isVisited = true;
         if (targetDstNodes->contains(nbrNodeID)) {
             numVisitedDstNodes++;
         }
         if constexpr (TRACK_PATH) {
-            nextFrontier->addEdge(boundNodeID, nbrNodeID, relID);
+            nextFrontier->addEdge(boundNodeID, nbrNodeID, relID, nodeIdxes);
         } else {
-            nextFrontier->addNodeWithMultiplicity(nbrNodeID, 1);
+            nextFrontier->addNodeWithMultiplicity(nbrNodeID, 1, nodeIdxes);
         }
     }
 
@@ -52,7 +60,7 @@ private:
 
 private:
     uint64_t numVisitedDstNodes;
-    common::node_id_set_t visited;
+    DenseNodeMap<uint8_t> visited;
 };
 
 } // namespace processor
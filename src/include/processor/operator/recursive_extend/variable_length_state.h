@@ -7,23 +7,24 @@ namespace processor {
 
 template<bool TRACK_PATH>
 struct VariableLengthState : public BaseBFSState {
-    VariableLengthState(uint8_t upperBound, TargetDstNodes* targetDstNodes)
-        : BaseBFSState{upperBound, targetDstNodes} {}
+    VariableLengthState(uint8_t upperBound, TargetDstNodes* targetDstNodes,
+        const DenseNodeMapInfo& denseNodeMapInfo)
+        : BaseBFSState{upperBound, targetDstNodes, denseNodeMapInfo} {}
     ~VariableLengthState() override = default;
 
     inline void resetState() final { BaseBFSState::resetState(); }
     inline bool isComplete() final { return isCurrentFrontierEmpty() || isUpperBoundReached(); }
 
     inline void markSrc(common::nodeID_t nodeID) final {
-        currentFrontier->addNodeWithMultiplicity(nodeID, 1 /* multiplicity */);
+        currentFrontier->addSrcNode(nodeID);
     }
 
     inline void markVisited(common::nodeID_t boundNodeID, common::nodeID_t nbrNodeID,
         common::relID_t relID, uint64_t multiplicity) final {
         if constexpr (TRACK_PATH) {
-            nextFrontier->addEdge(boundNodeID, nbrNodeID, relID);
+            nextFrontier->addEdge(boundNodeID, nbrNodeID, relID, nodeIdxes);
         } else {
-            nextFrontier->addNodeWithMultiplicity(nbrNodeID, multiplicity);
+            nextFrontier->addNodeWithMultiplicity(nbrNodeID, multiplicity, nodeIdxes);
         }
     }
 };
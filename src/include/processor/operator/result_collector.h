@@ -3,6 +3,7 @@
 #include "common/enums/accumulate_type.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
+#include "processor/result/result_stream.h"
 
 namespace kuzu {
 namespace processor {
@@ -19,9 +20,14 @@ public:
 
     std::shared_ptr<FactorizedTable> getTable() { return table; }
 
+    void setStream(std::shared_ptr<ResultStream> stream_) { stream = std::move(stream_); }
+    ResultStream* getStream() const { return stream.get(); }
+
 private:
     std::mutex mtx;
     std::shared_ptr<FactorizedTable> table;
+    // If set, tuples are pushed to the stream as they are collected instead of into the table.
+    std::shared_ptr<ResultStream> stream;
 };
 
 struct ResultCollectorInfo {
@@ -61,6 +67,8 @@ struct ResultCollectorPrintInfo final : OPPrintInfo {
 
 class ResultCollector : public Sink {
     static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::RESULT_COLLECTOR;
+    // Number of flat tuples collected by a thread before they are pushed to the result stream.
+    static constexpr uint64_t NUM_FLAT_TUPLES_PER_STREAMED_TABLE = common::DEFAULT_VECTOR_CAPACITY;
 
 public:
     ResultCollector(std::unique_ptr<ResultSetDescriptor> resultSetDescriptor,
@@ -76,6 +84,13 @@ public:
 
     std::shared_ptr<FactorizedTable> getResultFactorizedTable() { return sharedState->getTable(); }
 
+    // Only results that are collected as they are, i.e. not for optional matches, can be streamed.
+    bool canStreamResult() const { return info.accumulateType == common::AccumulateType::REGULAR; }
+    void streamResultTo(std::shared_ptr<ResultStream> stream) {
+        sharedState->setStream(std::move(stream));
+    }
+    bool isStreamingResult() const { return sharedState->getStream() != nullptr; }
+
     std::unique_ptr<PhysicalOperator> clone() final {
         return make_unique<ResultCollector>(resultSetDescriptor->copy(), info.copy(), sharedState,
             children[0]->clone(), id, printInfo->copy());
@@ -84,6 +99,9 @@ public:
 private:
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) final;
 
+    uint64_t getNumFlatTuplesOfPayloads() const;
+    void pushLocalTableToStream(ExecutionContext* context);
+
 private:
     ResultCollectorInfo info;
     std::shared_ptr<ResultCollectorSharedState> sharedState;
@@ -92,6 +110,8 @@ private:
 
     std::unique_ptr<common::ValueVector> markVector;
     std::unique_ptr<FactorizedTable> localTable;
+    // Only maintained when the result is streamed.
+    uint64_t numFlatTuplesInLocalTable = 0;
 };
 
 } // namespace processor
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "processor/operator/hash_join/runtime_join_filter.h"
 #include "processor/operator/physical_operator.h"
 #include "storage/store/table.h"
 
@@ -11,6 +12,8 @@ struct ScanTableInfo {
     DataPos IDPos;
     // Output vector (properties or CSRs) positions
     std::vector<DataPos> outVectorsPos;
+    // Filters passed from the build side of hash joins on the scanned vectors.
+    std::vector<RuntimeJoinFilterApplier> runtimeFilters;
 
     ScanTableInfo(DataPos nodeIDPos, std::vector<DataPos> outVectorsPos)
         : IDPos{nodeIDPos}, outVectorsPos{std::move(outVectorsPos)} {}
@@ -18,7 +21,8 @@ struct ScanTableInfo {
 
 private:
     ScanTableInfo(const ScanTableInfo& other)
-        : IDPos{other.IDPos}, outVectorsPos{other.outVectorsPos} {}
+        : IDPos{other.IDPos}, outVectorsPos{other.outVectorsPos},
+          runtimeFilters{copyVector(other.runtimeFilters)} {}
 };
 
 class ScanTable : public PhysicalOperator {
@@ -34,11 +38,21 @@ public:
         : PhysicalOperator{operatorType, id, std::move(printInfo)}, info{std::move(info)},
           IDVector{nullptr}, outState{nullptr} {}
 
+    bool isOutputVector(const DataPos& pos) const;
+
+    void addRuntimeFilter(const DataPos& keyPos, std::shared_ptr<RuntimeJoinFilter> filter) {
+        KU_ASSERT(isOutputVector(keyPos));
+        info.runtimeFilters.emplace_back(keyPos, std::move(filter));
+    }
+
 protected:
-    void initLocalStateInternal(ResultSet*, ExecutionContext*) override;
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
     virtual void initVectors(storage::TableScanState& state, const ResultSet& resultSet) const;
 
+    // Returns false if no output tuple is left after applying the runtime filters.
+    bool applyRuntimeFilters();
+
 protected:
     ScanTableInfo info;
     // Node/Rel id vector.
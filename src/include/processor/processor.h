@@ -19,7 +19,9 @@ public:
 private:
     void decomposePlanIntoTask(PhysicalOperator* op, common::Task* task, ExecutionContext* context);
 
-    void initTask(common::Task* task);
+    void initTask(common::Task* task, uint64_t maxNumConcurrentPipelines);
+
+    static bool canExecutePipelinesConcurrently(const PhysicalOperator* op);
 
 private:
     std::unique_ptr<common::TaskScheduler> taskScheduler;
@@ -15,6 +15,12 @@ public:
 
     virtual ~BaseHashTable() = default;
 
+    // Number of bytes of the tuples (including their overflow) and of the hash slots allocated so
+    // far.
+    uint64_t getMemoryUsage() const {
+        return factorizedTable->getMemoryUsage() + hashSlotsBlocks.size() * HASH_BLOCK_SIZE;
+    }
+
 protected:
     static constexpr uint64_t HASH_BLOCK_SIZE = common::BufferPoolConstants::PAGE_256KB_SIZE;
 
@@ -29,12 +29,15 @@ public:
     }
 
     uint8_t* getData() const { return block->buffer.data(); }
+    uint64_t getSize() const { return block->buffer.size(); }
     uint8_t* getWritableData() const { return block->buffer.last(freeSize).data(); }
     void resetNumTuplesAndFreeSize() {
         freeSize = block->buffer.size();
         numTuples = 0;
     }
     void resetToZero() { memset(block->buffer.data(), 0, block->buffer.size()); }
+    void pin() { block->pin(); }
+    void unpin() { block->unpin(); }
 
     static void copyTuples(DataBlock* blockToCopyFrom, ft_tuple_idx_t tupleIdxToCopyFrom,
         DataBlock* blockToCopyInto, ft_tuple_idx_t tupleIdxToCopyTo, uint32_t numTuplesToCopy,
@@ -70,6 +73,25 @@ public:
 
     void merge(DataBlockCollection& other);
 
+    uint64_t getMemoryUsage() const {
+        uint64_t memoryUsage = 0;
+        for (auto& block : blocks) {
+            memoryUsage += block->getSize();
+        }
+        return memoryUsage;
+    }
+
+    void pin() {
+        for (auto& block : blocks) {
+            block->pin();
+        }
+    }
+    void unpin() {
+        for (auto& block : blocks) {
+            block->unpin();
+        }
+    }
+
 private:
     uint32_t numBytesPerTuple;
     uint32_t numTuplesPerBlock;
@@ -123,6 +145,9 @@ public:
     }
 
     bool hasUnflatCol() const;
+
+    // Number of bytes of the tuple blocks and of the overflow buffer allocated so far.
+    uint64_t getMemoryUsage() const;
     bool hasUnflatCol(std::vector<ft_col_idx_t>& colIdxes) const {
         return std::any_of(colIdxes.begin(), colIdxes.end(),
             [this](ft_col_idx_t colIdx) { return !tableSchema.getColumn(colIdx)->isFlat(); });
@@ -164,6 +189,12 @@ public:
     void setNonOverflowColNull(uint8_t* nullBuffer, ft_col_idx_t colIdx);
     void clear();
 
+    // Unpinning only has an effect if the table is allocated from a spillable memory manager, in
+    // which case its blocks may be spilled to disk. The table must be pinned again before it is
+    // accessed.
+    void pin();
+    void unpin();
+
 private:
     void setOverflowColNull(uint8_t* nullBuffer, ft_col_idx_t colIdx, ft_tuple_idx_t tupleIdx);
 
@@ -229,6 +260,16 @@ private:
     std::unique_ptr<common::InMemOverflowBuffer> inMemOverflowBuffer;
 };
 
+// Consecutive flat tuples of a tuple in a factorizedTable. The flat columns of the tuple are shared
+// by all flat tuples of the run, and the values of its unflat columns are stored contiguously from
+// position startIdx in the unflat tuple blocks.
+struct FlatTupleRun {
+    const FactorizedTable* table = nullptr;
+    const uint8_t* tuple = nullptr;
+    uint64_t startIdx = 0;
+    uint64_t numFlatTuples = 0;
+};
+
 class FlatTupleIterator {
 public:
     explicit FlatTupleIterator(FactorizedTable& factorizedTable,
@@ -240,9 +281,16 @@ public:
 
     void getNextFlatTuple();
 
+    // Flat tuples can only be read in runs if all unflat columns belong to the same group, i.e. the
+    // flat tuples of a tuple are not a cartesian product. Runs do not update the values.
+    bool canReadFlatTupleRuns() const;
+    FlatTupleRun getNextFlatTupleRun(uint64_t maxNumFlatTuples);
+
     void resetState();
 
 private:
+    void moveToNextTuple();
+
     // The dataChunkPos may be not consecutive, which means some entries in the
     // flatTuplePositionsInDataChunk is invalid. We put pair(UINT64_MAX, UINT64_MAX) in the
     // invalid entries.
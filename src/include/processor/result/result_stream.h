@@ -0,0 +1,58 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "processor/result/factorized_table.h"
+
+namespace kuzu {
+namespace processor {
+
+// Hands the tables the result of a query is collected into from the threads executing the query
+// to the consumer of the result as soon as they fill up, instead of once the query finishes.
+// Producers block while `capacity` tables are waiting to be consumed, which bounds the memory
+// taken by the result no matter how large it is. Once `shouldDrain` returns true, e.g., because a
+// checkpoint waits for the transaction of the query to end, the bound is lifted for good, so that
+// the query can finish even if its result is not consumed.
+class ResultStream {
+public:
+    static constexpr uint64_t DEFAULT_CAPACITY = 8;
+    // How often a blocked producer checks whether the stream should be drained.
+    static constexpr uint64_t DRAIN_CHECK_INTERVAL_IN_MS = 10;
+
+    explicit ResultStream(std::function<bool()> shouldDrain = nullptr,
+        uint64_t capacity = DEFAULT_CAPACITY)
+        : shouldDrain{std::move(shouldDrain)}, capacity{capacity}, draining{false},
+          finished{false}, cancelled{false} {}
+
+    // Producer side. Blocks while the stream is full and not draining. Returns false if the stream
+    // has been cancelled, in which case the table is dropped and producers should stop.
+    bool push(std::unique_ptr<FactorizedTable> table);
+    // Marks that no more tables will be pushed, either because the query finished or because it
+    // failed with the given exception.
+    void finish(std::exception_ptr exception = nullptr);
+
+    // Consumer side. Blocks until a table is available. Returns nullptr once all tables have been
+    // consumed. Throws if the query failed or the stream was cancelled before the query finished.
+    std::unique_ptr<FactorizedTable> pop();
+    // Stops the query if it is still producing tables. Tables pushed so far can still be popped.
+    void cancel();
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::function<bool()> shouldDrain;
+    uint64_t capacity;
+    std::deque<std::unique_ptr<FactorizedTable>> tables;
+    bool draining;
+    bool finished;
+    bool cancelled;
+    std::exception_ptr exception;
+};
+
+} // namespace processor
+} // namespace kuzu
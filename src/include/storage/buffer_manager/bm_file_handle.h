@@ -10,6 +10,7 @@
 #include "common/copy_constructors.h"
 #include "common/types/types.h"
 #include "storage/buffer_manager/vm_region.h"
+#include "storage/enums/page_access_hint.h"
 #include "storage/enums/page_read_policy.h"
 #include "storage/file_handle.h"
 
@@ -61,6 +62,15 @@ public:
         // KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
         stateAndVersion.store(updateStateAndIncrementVersion(stateAndVersion.load(), UNLOCKED));
     }
+    // Unlock the page and directly mark it as evictable.
+    void unlockAndMark() {
+        stateAndVersion.store(updateStateAndIncrementVersion(stateAndVersion.load(), MARKED));
+    }
+    // The version is reset to 0 when a page is evicted and only incremented on unlock, so a zero
+    // version means the page has not been unpinned since it was cached into its frame.
+    bool isUnpinnedForTheFirstTime() const {
+        return (getVersion(stateAndVersion.load()) & ~DIRTY_MASK) == 0;
+    }
     // Change page state from Mark to Unlocked.
     bool tryClearMark(uint64_t oldStateAndVersion) {
         KU_ASSERT(getState(oldStateAndVersion) == MARKED);
@@ -104,9 +114,13 @@ class BMFileHandle final : public FileHandle {
 public:
     uint8_t* pinPage(common::page_idx_t pageIdx, PageReadPolicy readPolicy);
     void optimisticReadPage(common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& readOp);
+        const std::function<void(uint8_t*)>& readOp,
+        PageAccessHint accessHint = PageAccessHint::DEFAULT);
     // The function assumes that the requested page is already pinned.
     void unpinPage(common::page_idx_t pageIdx);
+    // Asynchronously reads ahead pages in [startPageIdx, startPageIdx + numPages) that are not
+    // cached in frames, so that later pins of them don't block on I/O.
+    void prefetchPages(common::page_idx_t startPageIdx, common::page_idx_t numPages);
 
     // This function assumes the page is already LOCKED.
     void setLockedPageDirty(common::page_idx_t pageIdx) {
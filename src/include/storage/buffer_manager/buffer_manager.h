@@ -8,6 +8,8 @@
 
 #include "common/types/types.h"
 #include "storage/buffer_manager/bm_file_handle.h"
+#include "storage/enums/eviction_policy.h"
+#include "storage/enums/page_access_hint.h"
 #include "storage/enums/page_read_policy.h"
 
 namespace kuzu {
@@ -59,6 +61,8 @@ public:
     std::atomic<EvictionCandidate>* next();
     void removeCandidatesForFile(uint32_t fileIndex);
     void clear(std::atomic<EvictionCandidate>& candidate);
+    // Returns false if the slot no longer holds the expected candidate.
+    bool tryClear(std::atomic<EvictionCandidate>& candidate, EvictionCandidate expected);
 
     uint64_t getSize() const { return size; }
     uint64_t getCapacity() const { return capacity; }
@@ -113,13 +117,27 @@ private:
  * constants.h), which is usually much larger than `maxSize`, and is expected to be large enough to
  * contain all disk pages. Each disk page in database files is directly mapped to a unique
  * PAGE_4KB_SIZE frame in the region.
- * 2) For each BMFileHandle backed by a temp in-mem file in MM, BM allocates a virtual memory region
- * of `maxSize` for it. Each memory buffer is mapped to a unique PAGE_256KB_SIZE frame in that
- * region. Both disk pages and memory buffers are all managed by the BM to make sure that actually
+ * 2) For the BMFileHandles of MM, which are backed by a temp in-mem file or by the spill file, BM
+ * allocates a virtual memory region of `maxSize` * MAX_SPILLED_TO_BUFFER_POOL_SIZE_RATIO, as
+ * spilled memory buffers keep their frames. Each memory buffer is mapped to a unique
+ * PAGE_256KB_SIZE frame in that region.
+ * Both disk pages and memory buffers are all managed by the BM to make sure that actually
  * used physical memory doesn't go beyond max size specified by users. Currently, the BM uses a
  * queue based replacement policy and the MADV_DONTNEED hint to explicitly control evictions. See
  * comments above `claimAFrame()` for more details.
  *
+ * Replacement policies (see `EvictionPolicy`):
+ * 1) FIFO_SECOND_CHANCE (default): all cached pages live in a single eviction queue, and pages that
+ * were read since the last eviction sweep are given a second chance.
+ * 2) TWO_QUEUE: a scan-resistant variant of 2Q. Newly cached pages enter the probationary queue
+ * (`evictionQueue`) and become MARKED on their first unpin, i.e., they are immediately evictable
+ * unless referenced again. Pages found UNLOCKED (re-referenced) during a sweep of the probationary
+ * queue are promoted to the protected queue, which is managed with second chance. Eviction prefers
+ * the probationary queue as long as the protected queue stays within its share of the pool.
+ * Reads with `PageAccessHint::USE_ONCE` (sequential scans of node tables that are large compared
+ * to the buffer pool) never count as a reference, so such scans only churn through the
+ * probationary queue.
+ *
  * Page states in BM:
  * A page can be in one of the four states: a) LOCKED, b) UNLOCKED, c) MARKED, d) EVICTED.
  * Every page is initialized as in the EVICTED state.
@@ -171,7 +189,8 @@ class BufferManager {
     friend class BMFileHandle;
 
 public:
-    BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize);
+    BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize,
+        EvictionPolicy evictionPolicy = EvictionPolicy::FIFO_SECOND_CHANCE);
     ~BufferManager() = default;
 
     // Currently, these functions are specifically used only for WAL files.
@@ -189,14 +208,19 @@ public:
     }
 
     uint64_t getUsedMemory() const { return usedMemory; }
+    uint64_t getNumPrefetchedPages() const { return numPrefetchedPages; }
+    EvictionPolicy getEvictionPolicy() const { return evictionPolicy; }
 
 private:
     uint8_t* pin(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy = PageReadPolicy::READ_PAGE);
     void optimisticRead(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& func);
+        const std::function<void(uint8_t*)>& func,
+        PageAccessHint accessHint = PageAccessHint::DEFAULT);
     // The function assumes that the requested page is already pinned.
     void unpin(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
+    void prefetch(BMFileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages);
     uint8_t* getFrame(BMFileHandle& fileHandle, common::page_idx_t pageIdx) const {
         return vmRegions[fileHandle.getPageSizeClass()]->getFrame(fileHandle.getFrameIdx(pageIdx));
     }
@@ -213,7 +237,7 @@ private:
     bool claimAFrame(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy);
     // Return number of bytes freed.
-    uint64_t tryEvictPage(std::atomic<EvictionCandidate>& candidate);
+    uint64_t tryEvictPage(EvictionQueue& queue, std::atomic<EvictionCandidate>& candidate);
 
     void cachePageIntoFrame(BMFileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy);
@@ -232,11 +256,21 @@ private:
     }
 
     uint64_t evictPages();
+    // Evicts up to a batch of pages from the given queue. If `promotionQueue` is not null,
+    // referenced candidates are moved to it instead of being given a second chance.
+    uint64_t evictPagesFromQueue(EvictionQueue& queue, EvictionQueue* promotionQueue);
+    bool shouldEvictFromProtectedQueueFirst() const;
 
 private:
     std::atomic<uint64_t> bufferPoolSize;
+    EvictionPolicy evictionPolicy;
+    // Under TWO_QUEUE, this is the probationary queue.
     EvictionQueue evictionQueue;
+    // Only allocated under TWO_QUEUE.
+    std::unique_ptr<EvictionQueue> protectedQueue;
     std::atomic<uint64_t> usedMemory;
+    // Number of pages handed to the file system as read-ahead hints.
+    std::atomic<uint64_t> numPrefetchedPages;
     // Each VMRegion corresponds to a virtual memory region of a specific page size. Currently, we
     // hold two sizes of PAGE_4KB and PAGE_256KB.
     std::vector<std::unique_ptr<VMRegion>> vmRegions;
@@ -4,6 +4,7 @@
 #include <memory>
 #include <mutex>
 #include <stack>
+#include <string>
 
 #include "common/constants.h"
 #include "common/types/types.h"
@@ -30,28 +31,44 @@ public:
         uint64_t size = common::BufferPoolConstants::PAGE_256KB_SIZE);
     ~MemoryBuffer();
 
+    // Only buffers from a spillable memory manager (see MemoryManager::getSpillableMemoryManager())
+    // can be unpinned; for others these are no-ops. Once unpinned, the buffer manager may write the
+    // buffer to the spill file and evict it. Pinning reads it back into the same address, so
+    // pointers into the buffer stay valid across unpin() and pin().
+    void pin();
+    void unpin();
+
 public:
     std::span<uint8_t> buffer;
     common::page_idx_t pageIdx;
     MemoryAllocator* allocator;
+
+private:
+    bool pinned;
 };
 
 class MemoryAllocator {
     friend class MemoryBuffer;
 
 public:
-    MemoryAllocator(BufferManager* bm, common::VirtualFileSystem* vfs,
-        main::ClientContext* context);
+    // If spillFilePath is empty, buffers are allocated from a temp in-mem file. Otherwise, they are
+    // backed by the given file, to which they can be spilled when unpinned.
+    MemoryAllocator(BufferManager* bm, common::VirtualFileSystem* vfs, main::ClientContext* context,
+        const std::string& spillFilePath = "");
 
     ~MemoryAllocator();
 
     std::unique_ptr<MemoryBuffer> allocateBuffer(bool initializeToZero, uint64_t size);
     inline common::page_offset_t getPageSize() const { return pageSize; }
+    bool isSpillable() const { return spillable; }
 
 private:
-    void freeBlock(common::page_idx_t pageIdx, std::span<uint8_t> buffer);
+    void freeBlock(common::page_idx_t pageIdx, std::span<uint8_t> buffer, bool pinned);
+    void pinBlock(common::page_idx_t pageIdx);
+    void unpinBlock(common::page_idx_t pageIdx);
 
 private:
+    bool spillable;
     BMFileHandle* fh;
     BufferManager* bm;
     common::page_offset_t pageSize;
@@ -73,13 +90,22 @@ private:
  *
  * MM will return a MemoryBuffer to the caller, which is a wrapper of the allocated memory block,
  * and it will automatically call its allocator to reclaim the memory block when it is destroyed.
+ *
+ * If a spill file path is given, MM also owns a spillable MM, whose memory buffers are backed by the
+ * spill file instead of a temp in-mem file. Operators that may run out of memory (e.g., hash joins)
+ * allocate from it, and unpin the buffers they don't need for a while, so that the buffer manager
+ * can write them to disk.
  */
 class MemoryManager {
 public:
     explicit MemoryManager(BufferManager* bm, common::VirtualFileSystem* vfs,
-        main::ClientContext* context)
+        main::ClientContext* context, const std::string& spillFilePath = "")
         : bm{bm} {
         allocator = std::make_unique<MemoryAllocator>(bm, vfs, context);
+        if (!spillFilePath.empty()) {
+            spillableMemoryManager = std::unique_ptr<MemoryManager>(new MemoryManager(bm,
+                std::make_unique<MemoryAllocator>(bm, vfs, context, spillFilePath)));
+        }
     }
 
     std::unique_ptr<MemoryBuffer> allocateBuffer(bool initializeToZero = false,
@@ -87,10 +113,17 @@ public:
         return allocator->allocateBuffer(initializeToZero, size);
     }
     BufferManager* getBufferManager() const { return bm; }
+    // Returns nullptr if spilling is not supported, e.g., for in-memory databases.
+    MemoryManager* getSpillableMemoryManager() const { return spillableMemoryManager.get(); }
+
+private:
+    MemoryManager(BufferManager* bm, std::unique_ptr<MemoryAllocator> allocator)
+        : bm{bm}, allocator{std::move(allocator)} {}
 
 private:
     BufferManager* bm;
     std::unique_ptr<MemoryAllocator> allocator;
+    std::unique_ptr<MemoryManager> spillableMemoryManager;
 };
 } // namespace storage
 } // namespace kuzu
@@ -105,6 +105,9 @@ enum class CompressionType : uint8_t {
     INTEGER_BITPACKING = 1,
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
+    DELTA_BITPACKING = 4,
+    RUN_LENGTH_ENCODING = 5,
+    ALP = 6,
 };
 
 // Data statistics used for determining how to handle compressed data
@@ -115,10 +118,15 @@ struct CompressionMetadata {
     StorageValue min;
     StorageValue max;
     CompressionType compression;
-    uint8_t _padding[7]{};
-
-    CompressionMetadata(StorageValue min, StorageValue max, CompressionType compression)
-        : min(min), max(max), compression(compression) {}
+    // Parameter of the compression which can't be derived from the minimum and maximum:
+    // the bit width of the deltas for DELTA_BITPACKING, and the log2 of the number of values per
+    // page for RUN_LENGTH_ENCODING and ALP.
+    uint8_t param;
+    uint8_t _padding[6]{};
+
+    CompressionMetadata(StorageValue min, StorageValue max, CompressionType compression,
+        uint8_t param = 0)
+        : min(min), max(max), compression(compression), param(param) {}
     inline bool isConstant() const { return compression == CompressionType::CONSTANT; }
 
     // Returns the number of values which will be stored in the given data size
@@ -346,6 +354,157 @@ protected:
         const BitpackInfo<T>& header) const;
 };
 
+template<typename T>
+concept EncodedIntegerType = IntegerBitpackingType<T> && sizeof(T) <= sizeof(uint64_t);
+
+// Delta encoding for sorted data (e.g. sequential IDs, CSR offsets and timestamps).
+// Values are stored in blocks of BLOCK_SIZE values, each starting with the first value of the
+// block followed by the bitpacked differences between consecutive values, so that reading a value
+// only requires decoding the block containing it. The bit width of the deltas is stored in the
+// compression metadata.
+//
+// Updating a value would change the deltas around it, so only writes of nulls are done in place.
+template<EncodedIntegerType T>
+class DeltaBitpacking : public CompressionAlg {
+    using U = common::numeric_utils::MakeUnSignedT<T>;
+
+public:
+    static constexpr uint64_t BLOCK_SIZE = 4 * IntegerBitpacking<T>::CHUNK_SIZE;
+
+public:
+    DeltaBitpacking() = default;
+    DeltaBitpacking(const DeltaBitpacking&) = default;
+
+    // Returns the metadata for delta compressing the values, or nullopt if they are not sorted
+    static std::optional<CompressionMetadata> analyze(std::span<const T> values, StorageValue min,
+        StorageValue max);
+
+    static inline uint64_t numValues(uint64_t dataSize, const CompressionMetadata& metadata) {
+        return dataSize / getBlockSize(metadata.param) * BLOCK_SIZE;
+    }
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata, const common::NullMask* nullMask) const final;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    CompressionType getCompressionType() const override {
+        return CompressionType::DELTA_BITPACKING;
+    }
+
+private:
+    // The first value of a block is stored in 8 bytes to keep the packed deltas aligned
+    static inline uint64_t getBlockSize(uint8_t bitWidth) {
+        return sizeof(uint64_t) + BLOCK_SIZE * bitWidth / 8;
+    }
+};
+
+// Run-length encoding for columns with long runs of repeated values.
+// Each page stores the number of runs, followed by the (exclusive) end position of each run
+// within the page and the value of each run. Reading a value binary searches the run ends.
+// Pages hold a fixed number of values (a power of two stored in the compression metadata),
+// chosen so that the runs of every page fit.
+//
+// Updating a value may split a run, so only writes of nulls are done in place.
+template<EncodedIntegerType T>
+class RunLengthEncoding : public CompressionAlg {
+    using run_end_t = uint16_t;
+
+public:
+    static constexpr uint8_t MAX_LOG2_NUM_VALUES_PER_PAGE = 15;
+
+public:
+    RunLengthEncoding() = default;
+    RunLengthEncoding(const RunLengthEncoding&) = default;
+
+    // Returns the metadata for run-length encoding the values into pages of the given size, or
+    // nullopt if the runs are too short for it to be worthwhile
+    static std::optional<CompressionMetadata> analyze(std::span<const T> values, StorageValue min,
+        StorageValue max, uint64_t pageSize);
+
+    static inline uint64_t numValues(uint64_t /*dataSize*/, const CompressionMetadata& metadata) {
+        return uint64_t{1} << metadata.param;
+    }
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata, const common::NullMask* nullMask) const final;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    CompressionType getCompressionType() const override {
+        return CompressionType::RUN_LENGTH_ENCODING;
+    }
+
+private:
+    static inline uint64_t getMaxNumRuns(uint64_t pageSize) {
+        // The run ends are followed by up to 7 bytes of padding to align the values
+        return (pageSize - sizeof(run_end_t) - sizeof(uint64_t)) / (sizeof(run_end_t) + sizeof(T));
+    }
+    static inline uint64_t getValuesStart(uint64_t numRuns) {
+        auto runEndsEnd = sizeof(run_end_t) * (1 + numRuns);
+        return (runEndsEnd + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+    }
+};
+
+// Lossless floating point compression based on ALP (Adaptive Lossless floating-Point compression).
+// Values with few decimal digits are encoded as integers round(value * 10^exponent / 10^factor),
+// which are bitpacked with frame of reference encoding. Values which don't decode back to exactly
+// the same value (e.g. NaN, infinity, -0.0 or values with too many digits) are stored unencoded
+// as exceptions.
+//
+// Each page picks its own exponent and factor and stores them in a header along with the frame of
+// reference and bit width, followed by the packed integers, the positions of the exceptions and
+// their values. Pages hold a fixed number of values (a power of two stored in the compression
+// metadata), chosen so that every page fits.
+//
+// Updating a value may turn it into an exception, so only writes of nulls are done in place.
+template<std::floating_point T>
+class FloatCompression : public CompressionAlg {
+public:
+    static constexpr uint8_t MAX_LOG2_NUM_VALUES_PER_PAGE = 14;
+
+public:
+    FloatCompression() = default;
+    FloatCompression(const FloatCompression&) = default;
+
+    // Returns the metadata for compressing the values into pages of the given size, or nullopt if
+    // the compressed values wouldn't take less space than uncompressed values
+    static std::optional<CompressionMetadata> analyze(std::span<const T> values, StorageValue min,
+        StorageValue max, uint64_t pageSize);
+
+    static inline uint64_t numValues(uint64_t /*dataSize*/, const CompressionMetadata& metadata) {
+        return uint64_t{1} << metadata.param;
+    }
+
+    void setValuesFromUncompressed(const uint8_t* srcBuffer, common::offset_t srcOffset,
+        uint8_t* dstBuffer, common::offset_t dstOffset, common::offset_t numValues,
+        const CompressionMetadata& metadata, const common::NullMask* nullMask) const final;
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    CompressionType getCompressionType() const override { return CompressionType::ALP; }
+};
+
 class BooleanBitpacking : public CompressionAlg {
 public:
     BooleanBitpacking() = default;
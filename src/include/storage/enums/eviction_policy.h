@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace storage {
+
+// Replacement policy used by the BufferManager to pick pages to evict.
+// FIFO_SECOND_CHANCE: a single circular queue; recently read pages get one more round.
+// TWO_QUEUE: newly cached pages enter a probationary queue and are only promoted to the protected
+// queue once they are referenced again, so one-off scans cannot flush the hot working set.
+enum class EvictionPolicy : uint8_t { FIFO_SECOND_CHANCE = 0, TWO_QUEUE = 1 };
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kuzu {
+namespace storage {
+
+// Hint given by callers on how a page is going to be accessed.
+// USE_ONCE: the page is read as part of a sequential scan and is unlikely to be read again soon.
+// Such reads do not count as a reference to the page, so they don't protect it from eviction.
+enum class PageAccessHint : uint8_t { DEFAULT = 0, USE_ONCE = 1 };
+
+} // namespace storage
+} // namespace kuzu
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <span>
 #include <string_view>
 #include <type_traits>
 
@@ -98,6 +99,35 @@ public:
         return lookupInPersistentIndex(transaction, key, result, isVisible);
     }
 
+    // Batched version of the above. `results[i]` is set to the offset of `keys[i]`, or
+    // INVALID_OFFSET if the key doesn't exist. Keys not resolved by the local storage are probed in
+    // the persistent storage together.
+    void lookupInternal(const transaction::Transaction* transaction, std::span<const Key> keys,
+        std::span<common::offset_t> results, visible_func isVisible) {
+        KU_ASSERT(transaction->getType() != transaction::TransactionType::CHECKPOINT);
+        KU_ASSERT(keys.size() == results.size());
+        if (!localStorage->hasUpdates()) {
+            lookupInPersistentIndex(transaction, keys, results, isVisible);
+            return;
+        }
+        std::vector<Key> persistentKeys;
+        std::vector<common::idx_t> persistentKeyPositions;
+        for (auto i = 0u; i < keys.size(); i++) {
+            const auto localLookupState = localStorage->lookup(keys[i], results[i], isVisible);
+            if (localLookupState == HashIndexLocalLookupState::KEY_NOT_EXIST) {
+                persistentKeys.push_back(keys[i]);
+                persistentKeyPositions.push_back(i);
+            } else if (localLookupState == HashIndexLocalLookupState::KEY_DELETED) {
+                results[i] = common::INVALID_OFFSET;
+            }
+        }
+        std::vector<common::offset_t> persistentResults(persistentKeys.size());
+        lookupInPersistentIndex(transaction, persistentKeys, persistentResults, isVisible);
+        for (auto i = 0u; i < persistentKeys.size(); i++) {
+            results[persistentKeyPositions[i]] = persistentResults[i];
+        }
+    }
+
     // For deletions, we don't check if the deleted keys exist or not. Thus, we don't need to check
     // in the persistent storage and directly delete keys in the local storage.
     void deleteInternal(Key key) const { localStorage->deleteKey(key); }
@@ -172,6 +202,38 @@ private:
         } while (nextChainedSlot(transaction, iter));
         return false;
     }
+    // Reads the primary slots of all keys in one batched pass over the slot disk array, then
+    // follows the (rare) overflow chains key by key.
+    void lookupInPersistentIndex(const transaction::Transaction* transaction,
+        std::span<const Key> keys, std::span<common::offset_t> results, visible_func isVisible) {
+        std::fill(results.begin(), results.end(), common::INVALID_OFFSET);
+        auto& header = transaction->getType() == transaction::TransactionType::CHECKPOINT ?
+                           this->indexHeaderForWriteTrx :
+                           this->indexHeaderForReadTrx;
+        if (header.numEntries == 0 || keys.empty()) {
+            return;
+        }
+        std::vector<uint64_t> slotIds(keys.size());
+        std::vector<uint8_t> fingerprints(keys.size());
+        for (auto i = 0u; i < keys.size(); i++) {
+            auto hashValue = HashIndexUtils::hash(keys[i]);
+            fingerprints[i] = HashIndexUtils::getFingerprintForHash(hashValue);
+            slotIds[i] = HashIndexUtils::getPrimarySlotIdForHash(header, hashValue);
+        }
+        std::vector<Slot<T>> slots(keys.size());
+        pSlots->get(slotIds, transaction, slots);
+        for (auto i = 0u; i < keys.size(); i++) {
+            SlotIterator iter{SlotInfo{slotIds[i], SlotType::PRIMARY}, slots[i]};
+            do {
+                auto entryPos = findMatchedEntryInSlot(transaction, iter.slot, keys[i],
+                    fingerprints[i], isVisible);
+                if (entryPos != SlotHeader::INVALID_ENTRY_POS) {
+                    results[i] = iter.slot.entries[entryPos].value;
+                    break;
+                }
+            } while (nextChainedSlot(transaction, iter));
+        }
+    }
     void deleteFromPersistentIndex(const transaction::Transaction* transaction, Key key,
         visible_func isVisible);
 
@@ -330,6 +392,11 @@ public:
 
     bool lookup(const transaction::Transaction* trx, common::ValueVector* keyVector,
         uint64_t vectorPos, common::offset_t& result, visible_func isVisible);
+    // Looks up all selected keys of `keyVector`. `offsets[i]` is set to the offset of the i-th
+    // selected key, or INVALID_OFFSET if it doesn't exist. Keys are grouped by the hash index they
+    // belong to, and each hash index resolves its keys in one batched probe.
+    void lookup(const transaction::Transaction* trx, const common::ValueVector& keyVector,
+        common::offset_t* offsets, visible_func isVisible);
 
     inline bool insert(const transaction::Transaction* transaction, common::ku_string_t key,
         common::offset_t value, visible_func isVisible) {
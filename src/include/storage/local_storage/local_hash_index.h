@@ -111,13 +111,16 @@ public:
 
     common::offset_t lookup(const common::ValueVector& keyVector, visible_func isVisible) {
         KU_ASSERT(keyVector.state->getSelVector().getSelSize() == 1);
+        return lookup(keyVector, keyVector.state->getSelVector().getSelectedPositions()[0],
+            std::move(isVisible));
+    }
+    common::offset_t lookup(const common::ValueVector& keyVector, common::sel_t pos,
+        visible_func isVisible) {
         common::offset_t result = common::INVALID_OFFSET;
         common::TypeUtils::visit(
             keyDataTypeID,
-            [&]<common::IndexHashable T>(T) {
-                const auto pos = keyVector.state->getSelVector().getSelectedPositions()[0];
-                result = lookup(keyVector.getValue<T>(pos), isVisible);
-            },
+            [&]<common::IndexHashable T>(
+                T) { result = lookup(keyVector.getValue<T>(pos), isVisible); },
             [](auto) { KU_UNREACHABLE; });
         return result;
     }
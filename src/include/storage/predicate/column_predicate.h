@@ -7,7 +7,7 @@
 namespace kuzu {
 namespace storage {
 
-struct CompressionMetadata;
+struct ZoneMap;
 
 class ColumnPredicate;
 class ColumnPredicateSet {
@@ -19,7 +19,7 @@ public:
         predicates.push_back(std::move(predicate));
     }
 
-    common::ZoneMapCheckResult checkZoneMap(const CompressionMetadata& metadata);
+    common::ZoneMapCheckResult checkZoneMap(const ZoneMap& zoneMap) const;
 
 private:
     ColumnPredicateSet(const ColumnPredicateSet& other);
@@ -32,7 +32,7 @@ class ColumnPredicate {
 public:
     virtual ~ColumnPredicate() = default;
 
-    virtual common::ZoneMapCheckResult checkZoneMap(const CompressionMetadata& metadata) const = 0;
+    virtual common::ZoneMapCheckResult checkZoneMap(const ZoneMap& zoneMap) const = 0;
 
     virtual std::unique_ptr<ColumnPredicate> copy() const = 0;
 
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "column_predicate.h"
+#include "common/types/value/value.h"
+
+namespace kuzu {
+namespace storage {
+
+// `column IN [v1, v2, ...]` with a literal list whose element type matches the column.
+class ColumnInListPredicate : public ColumnPredicate {
+public:
+    explicit ColumnInListPredicate(std::vector<common::Value> values) : values{std::move(values)} {}
+
+    common::ZoneMapCheckResult checkZoneMap(const ZoneMap& zoneMap) const override;
+
+    std::unique_ptr<ColumnPredicate> copy() const override {
+        return std::make_unique<ColumnInListPredicate>(values);
+    }
+
+private:
+    std::vector<common::Value> values;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "column_predicate.h"
+#include "common/enums/expression_type.h"
+
+namespace kuzu {
+namespace storage {
+
+// IS NULL / IS NOT NULL on a column.
+class ColumnNullPredicate : public ColumnPredicate {
+public:
+    explicit ColumnNullPredicate(common::ExpressionType expressionType)
+        : expressionType{expressionType} {
+        KU_ASSERT(expressionType == common::ExpressionType::IS_NULL ||
+                  expressionType == common::ExpressionType::IS_NOT_NULL);
+    }
+
+    common::ZoneMapCheckResult checkZoneMap(const ZoneMap& zoneMap) const override;
+
+    std::unique_ptr<ColumnPredicate> copy() const override {
+        return std::make_unique<ColumnNullPredicate>(expressionType);
+    }
+
+private:
+    common::ExpressionType expressionType;
+};
+
+} // namespace storage
+} // namespace kuzu
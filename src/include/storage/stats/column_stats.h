@@ -0,0 +1,46 @@
+#pragma once
+
+#include "common/types/types.h"
+#include "storage/stats/equi_depth_histogram.h"
+#include "storage/stats/hyperloglog.h"
+
+namespace kuzu {
+namespace storage {
+
+class ColumnChunkData;
+
+// Statistics of the values of a column: the number of values and nulls, a sketch of the number of
+// distinct values and, for numeric columns, the distribution of the values. Statistics collected
+// from different chunks of the column are merged.
+class ColumnStats {
+public:
+    // Values sampled from each chunk to build its histogram.
+    static constexpr uint64_t NUM_SAMPLED_VALUES_PER_CHUNK = 1024;
+
+    ColumnStats() : numValues{0}, numNulls{0} {}
+
+    static bool hasDistinctCount(common::PhysicalTypeID physicalType);
+    static bool hasHistogram(common::PhysicalTypeID physicalType);
+
+    void update(const ColumnChunkData& chunk, common::offset_t startOffset,
+        common::length_t numValuesToUpdate);
+    void merge(const ColumnStats& other);
+
+    // Including nulls.
+    uint64_t getNumValues() const { return numValues; }
+    uint64_t getNumNulls() const { return numNulls; }
+    uint64_t getNumDistinctValues() const;
+    const EquiDepthHistogram& getHistogram() const { return histogram; }
+
+    void serialize(common::Serializer& serializer) const;
+    static ColumnStats deserialize(common::Deserializer& deserializer);
+
+private:
+    uint64_t numValues;
+    uint64_t numNulls;
+    HyperLogLog hll;
+    EquiDepthHistogram histogram;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// Splits the values it summarizes into buckets holding the same number of values. Values are
+// assumed to be spread uniformly within each bucket, so a bucket whose bounds are equal stands
+// for a value repeated once per value in the bucket.
+class EquiDepthHistogram {
+public:
+    static constexpr uint64_t MAX_NUM_BUCKETS = 64;
+
+    EquiDepthHistogram() : numValues{0} {}
+
+    // Builds the histogram of `numValues` values from a uniform sample of them.
+    static EquiDepthHistogram build(std::vector<double> sample, uint64_t numValues);
+
+    // Widens the histogram to also summarize the values of another histogram.
+    void merge(const EquiDepthHistogram& other);
+
+    bool isEmpty() const { return numValues == 0; }
+    uint64_t getNumValues() const { return numValues; }
+    double getMin() const { return bounds.front(); }
+    double getMax() const { return bounds.back(); }
+
+    double getFractionLessThan(double value) const;
+    double getFractionLessThanOrEqual(double value) const;
+    double getMean() const;
+    double getMeanOfSquares() const;
+
+    void serialize(common::Serializer& serializer) const;
+    static EquiDepthHistogram deserialize(common::Deserializer& deserializer);
+
+private:
+    uint64_t getNumBuckets() const { return bounds.size() - 1; }
+
+private:
+    uint64_t numValues;
+    // Bucket i covers [bounds[i], bounds[i + 1]].
+    std::vector<double> bounds;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <array>
+
+#include "common/types/types.h"
+
+namespace kuzu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// HyperLogLog sketch estimating the number of distinct values inserted into it. Sketches built
+// over disjoint sets of values are merged by taking the maximum of each register.
+class HyperLogLog {
+public:
+    // 2^10 registers give a standard error of about 3% and take 1KB.
+    static constexpr uint64_t PRECISION = 10;
+    static constexpr uint64_t NUM_REGISTERS = 1 << PRECISION;
+
+    HyperLogLog() : registers{} {}
+
+    void insertHash(common::hash_t hash);
+    void merge(const HyperLogLog& other);
+
+    uint64_t count() const;
+
+    void serialize(common::Serializer& serializer) const;
+    static HyperLogLog deserialize(common::Deserializer& deserializer);
+
+private:
+    std::array<uint8_t, NUM_REGISTERS> registers;
+};
+
+} // namespace storage
+} // namespace kuzu
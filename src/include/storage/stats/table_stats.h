@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "common/enums/rel_direction.h"
+#include "storage/stats/column_stats.h"
+
+namespace kuzu {
+namespace storage {
+
+class ChunkedNodeGroup;
+
+// Statistics of a node or rel table used for cardinality estimation. They are collected as data
+// is appended to the table and are not adjusted on updates or deletions.
+class TableStats {
+public:
+    TableStats() = default;
+
+    // Updates the stats of column columnIDs[i] from the i-th chunk of the group. Chunks mapped to
+    // INVALID_COLUMN_ID are skipped.
+    void update(const std::vector<common::column_id_t>& columnIDs,
+        const ChunkedNodeGroup& chunkedGroup, common::row_idx_t startRow,
+        common::row_idx_t numRows);
+    void merge(const TableStats& other);
+    void mergeColumnStats(common::column_id_t columnID, const ColumnStats& other);
+
+    // Keeps the stats of the given columns only, renumbering them by their position.
+    void vacuumColumns(const std::vector<common::column_id_t>& columnIDs);
+
+    const ColumnStats* getColumnStats(common::column_id_t columnID) const {
+        return columnID < columnStats.size() ? &columnStats[columnID] : nullptr;
+    }
+
+    // Rel tables only. Distribution of the number of rels of the bound nodes that have any rel.
+    const EquiDepthHistogram& getDegreeHistogram(common::RelDataDirection direction) const {
+        return degreeHistograms[static_cast<uint8_t>(direction)];
+    }
+    void setDegreeHistogram(common::RelDataDirection direction, EquiDepthHistogram histogram) {
+        degreeHistograms[static_cast<uint8_t>(direction)] = std::move(histogram);
+    }
+    // Builds the degree histogram of the bound nodes of a CSR node group from its CSR lengths.
+    static EquiDepthHistogram computeDegreeHistogram(const ColumnChunkData& lengthChunk,
+        common::offset_t numNodes);
+
+    void serialize(common::Serializer& serializer) const;
+    static TableStats deserialize(common::Deserializer& deserializer);
+
+private:
+    // Indexed by column ID.
+    std::vector<ColumnStats> columnStats;
+    std::array<EquiDepthHistogram, 2> degreeHistograms;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -110,6 +110,10 @@ public:
         transaction::TransactionType trxType = transaction::TransactionType::READ_ONLY);
 
     void get(uint64_t idx, const transaction::Transaction* transaction, std::span<std::byte> val);
+    // Reads the elements at `idxs` into `vals`, which holds one element per index. All the array
+    // pages are prefetched first, and the elements sharing a page are copied in one page access.
+    void get(std::span<const uint64_t> idxs, const transaction::Transaction* transaction,
+        std::span<std::byte> vals);
 
     // Note: This function is to be used only by the WRITE trx.
     void update(const transaction::Transaction* transaction, uint64_t idx,
@@ -288,6 +292,12 @@ public:
         return val;
     }
 
+    inline void get(std::span<const uint64_t> idxs, const transaction::Transaction* transaction,
+        std::span<U> vals) {
+        KU_ASSERT(idxs.size() == vals.size());
+        diskArray.get(idxs, transaction, std::as_writable_bytes(vals));
+    }
+
     // Note: Currently, this function doesn't support shrinking the size of the array.
     inline uint64_t resize(const transaction::Transaction* transaction, uint64_t newNumElements) {
         U defaultVal;
@@ -20,6 +20,7 @@ class Transaction;
 namespace storage {
 
 class Column;
+class ColumnStats;
 struct TableScanState;
 struct TableAddColumnState;
 struct NodeGroupScanState;
@@ -88,6 +89,11 @@ public:
         const NodeGroupScanState& nodeGroupScanState, common::offset_t rowIdxInGroup,
         common::length_t numRowsToScan) const;
 
+    // Returns true if the per-vector zone maps of the scanned columns show that no row in the range
+    // can satisfy the column predicates. The range must be within a single vector.
+    bool canSkipScan(const transaction::Transaction* transaction, const TableScanState& scanState,
+        common::offset_t rowIdxInGroup, common::length_t numRowsToScan) const;
+
     template<ResidencyState SCAN_RESIDENCY_STATE>
     void scanCommitted(transaction::Transaction* transaction, TableScanState& scanState,
         NodeGroupScanState& nodeGroupScanState, ChunkedNodeGroup& output) const;
@@ -109,8 +115,10 @@ public:
 
     bool delete_(const transaction::Transaction* transaction, common::row_idx_t rowIdxInChunk);
 
+    // Fills the new column with its default value. The stats of the filled values are collected
+    // into newColumnStats if it is set.
     void addColumn(transaction::Transaction* transaction, const TableAddColumnState& addColumnState,
-        bool enableCompression, BMFileHandle* dataFH);
+        bool enableCompression, BMFileHandle* dataFH, ColumnStats* newColumnStats);
 
     bool isDeleted(const transaction::Transaction* transaction, common::row_idx_t rowInChunk) const;
     bool isInserted(const transaction::Transaction* transaction,
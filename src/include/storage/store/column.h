@@ -5,6 +5,7 @@
 #include "common/types/types.h"
 #include "storage/compression/compression.h"
 #include "storage/db_file_id.h"
+#include "storage/enums/page_access_hint.h"
 #include "storage/store/column_chunk_data.h"
 
 namespace kuzu {
@@ -81,6 +82,12 @@ public:
     virtual void scan(transaction::Transaction* transaction, const ChunkState& state,
         common::offset_t startOffsetInGroup, common::offset_t endOffsetInGroup, uint8_t* result);
 
+    // Issues read-ahead for all on-disk pages of the chunk, including null and children chunks.
+    void prefetch(const ChunkState& state) const;
+    // Issues read-ahead for the data and null pages holding values in [startOffset, endOffset).
+    void prefetch(const ChunkState& state, common::offset_t startOffset,
+        common::offset_t endOffset) const;
+
     // Batch write to a set of sequential pages.
     virtual void write(ColumnChunkData& persistentChunk, ChunkState& state,
         common::offset_t dstOffset, ColumnChunkData* data, common::offset_t srcOffset,
@@ -106,17 +113,18 @@ protected:
         common::offset_t startOffsetInChunk, common::row_idx_t numValuesToScan,
         common::ValueVector* nodeIDVector, common::ValueVector* resultVector);
     void scanUnfiltered(transaction::Transaction* transaction, PageCursor& pageCursor,
-        uint64_t numValuesToScan, common::ValueVector* resultVector,
-        const ColumnChunkMetadata& chunkMeta, uint64_t startPosInVector = 0) const;
+        uint64_t numValuesToScan, common::ValueVector* resultVector, const ChunkState& state,
+        uint64_t startPosInVector = 0) const;
     void scanFiltered(transaction::Transaction* transaction, PageCursor& pageCursor,
         uint64_t numValuesToScan, const common::SelectionVector& selVector,
-        common::ValueVector* resultVector, const ColumnChunkMetadata& chunkMeta) const;
+        common::ValueVector* resultVector, const ChunkState& state) const;
 
     virtual void lookupInternal(transaction::Transaction* transaction, const ChunkState& state,
         common::offset_t nodeOffset, common::ValueVector* resultVector, uint32_t posInVector);
 
     void readFromPage(transaction::Transaction* transaction, common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& func) const;
+        const std::function<void(uint8_t*)>& func,
+        PageAccessHint accessHint = PageAccessHint::DEFAULT) const;
 
     virtual void writeValues(ColumnChunkData& persistentChunk, ChunkState& state,
         common::offset_t dstOffset, const uint8_t* data, const common::NullMask* nullChunkData,
@@ -8,7 +8,9 @@
 #include "common/null_mask.h"
 #include "common/types/types.h"
 #include "storage/compression/compression.h"
+#include "storage/enums/page_access_hint.h"
 #include "storage/enums/residency_state.h"
+#include "storage/store/zone_map.h"
 
 namespace kuzu {
 namespace evaluator {
@@ -46,6 +48,8 @@ struct ChunkState {
     Column* column;
     ColumnChunkMetadata metadata;
     uint64_t numValuesPerPage = UINT64_MAX;
+    // Hint for the pages read by scans. Lookups always read with the default hint.
+    PageAccessHint accessHint = PageAccessHint::DEFAULT;
     std::unique_ptr<ChunkState> nullState;
     // Used for struct/list/string columns.
     std::vector<ChunkState> childrenStates;
@@ -69,6 +73,16 @@ struct ChunkState {
         return childrenStates[childIdx];
     }
 
+    void setAccessHint(PageAccessHint hint) {
+        accessHint = hint;
+        if (nullState) {
+            nullState->setAccessHint(hint);
+        }
+        for (auto& childState : childrenStates) {
+            childState.setAccessHint(hint);
+        }
+    }
+
     void resetState() {
         numValuesPerPage = UINT64_MAX;
         if (nullState) {
@@ -132,6 +146,16 @@ public:
         KU_ASSERT(residencyState == ResidencyState::ON_DISK);
         metadata = metadata_;
     }
+    // Returns nullptr if there are no statistics for the vector, in which case it must be scanned.
+    const ZoneMap* getVectorZoneMap(common::idx_t vectorIdx) const {
+        if (residencyState != ResidencyState::ON_DISK || vectorIdx >= vectorZoneMaps.size()) {
+            return nullptr;
+        }
+        return &vectorZoneMaps[vectorIdx];
+    }
+    // Widens the zone maps of an on-disk chunk after values were written to it in place.
+    void updateVectorZoneMaps(common::offset_t dstOffset, const uint8_t* data,
+        common::offset_t srcOffset, common::length_t numValues, const common::NullMask* nullMask);
 
     // Only have side effects on in-memory or temporary chunks.
     virtual void resetToAllNull();
@@ -226,6 +250,10 @@ protected:
 private:
     uint64_t getBufferSize(uint64_t capacity_) const;
 
+    void populateVectorZoneMaps();
+    void widenVectorZoneMaps(common::offset_t dstOffset, const uint8_t* data,
+        common::offset_t srcOffset, common::length_t numValues, const common::NullMask* nullMask);
+
 protected:
     using flush_buffer_func_t = std::function<ColumnChunkMetadata(const uint8_t*, uint64_t,
         BMFileHandle*, common::page_idx_t, const ColumnChunkMetadata&)>;
@@ -248,6 +276,9 @@ protected:
 
     // On-disk metadata for column chunk.
     ColumnChunkMetadata metadata;
+    // Zone maps of each vector of values in the on-disk chunk. Only kept for property chunks of
+    // types with min/max statistics.
+    std::vector<ZoneMap> vectorZoneMaps;
 };
 
 template<>
@@ -3,6 +3,7 @@
 #include <array>
 
 #include "common/data_chunk/data_chunk.h"
+#include "storage/stats/equi_depth_histogram.h"
 #include "storage/store/csr_chunked_node_group.h"
 #include "storage/store/node_group.h"
 
@@ -137,6 +138,8 @@ struct CSRNodeGroupCheckpointState final : NodeGroupCheckpointState {
 
     std::unique_ptr<ChunkedCSRHeader> oldHeader;
     std::unique_ptr<ChunkedCSRHeader> newHeader;
+    // Degrees of the bound nodes after checkpoint, collected across node groups.
+    EquiDepthHistogram degreeHistogram;
 
     CSRNodeGroupCheckpointState(std::vector<common::column_id_t> columnIDs,
         std::vector<std::unique_ptr<Column>> columns, BMFileHandle& dataFH, MemoryManager* mm,
@@ -190,7 +193,7 @@ public:
         common::row_idx_t rowIdxInGroup);
 
     void addColumn(transaction::Transaction* transaction, TableAddColumnState& addColumnState,
-        BMFileHandle* dataFH) override;
+        BMFileHandle* dataFH, ColumnStats* newColumnStats) override;
 
     void checkpoint(NodeGroupCheckpointState& state) override;
 
@@ -207,6 +210,8 @@ public:
 private:
     void initializePersistentCSRHeader(transaction::Transaction* transaction,
         RelTableScanState& relScanState, CSRNodeGroupScanState& nodeGroupScanState) const;
+    static void prefetchPersistentCSRList(const RelTableScanState& relScanState,
+        const CSRNodeGroupScanState& nodeGroupScanState);
 
     void updateCSRIndex(common::offset_t boundNodeOffsetInGroup, common::row_idx_t startRow,
         common::length_t length) const;
@@ -145,7 +145,7 @@ public:
 
     common::row_idx_t getNumDeletedRows(const transaction::Transaction* transaction);
     virtual void addColumn(transaction::Transaction* transaction,
-        TableAddColumnState& addColumnState, BMFileHandle* dataFH);
+        TableAddColumnState& addColumnState, BMFileHandle* dataFH, ColumnStats* newColumnStats);
 
     void flush(BMFileHandle& dataFH);
 
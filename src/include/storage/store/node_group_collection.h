@@ -52,7 +52,8 @@ public:
 
     common::column_id_t getNumColumns() const { return types.size(); }
 
-    void addColumn(transaction::Transaction* transaction, TableAddColumnState& addColumnState);
+    void addColumn(transaction::Transaction* transaction, TableAddColumnState& addColumnState,
+        ColumnStats* newColumnStats);
 
     uint64_t getEstimatedMemoryUsage();
 
@@ -118,6 +118,10 @@ public:
 
     bool lookupPK(const transaction::Transaction* transaction, common::ValueVector* keyVector,
         uint64_t vectorPos, common::offset_t& result) const;
+    // Looks up all selected keys of `keyVector`. `offsets[i]` is set to the offset of the i-th
+    // selected key, or INVALID_OFFSET if it doesn't exist.
+    void lookupPKs(const transaction::Transaction* transaction,
+        const common::ValueVector& keyVector, common::offset_t* offsets) const;
     template<common::IndexHashable T>
     size_t appendPKWithIndexPos(const transaction::Transaction* transaction,
         const IndexBuffer<T>& buffer, uint64_t indexPos) {
@@ -170,6 +174,9 @@ private:
 
     void serialize(common::Serializer& serializer) const override;
 
+    // Stats are collected for every column, which map one to one to the chunks of a node group.
+    std::vector<common::column_id_t> getStatsColumnIDs() const;
+
 private:
     std::vector<std::unique_ptr<Column>> columns;
     std::unique_ptr<NodeGroupCollection> nodeGroups;
@@ -27,7 +27,8 @@ public:
         const common::ValueVector& dataVector) const;
     bool delete_(transaction::Transaction* transaction, common::ValueVector& boundNodeIDVector,
         const common::ValueVector& relIDVector) const;
-    void addColumn(transaction::Transaction* transaction, TableAddColumnState& addColumnState);
+    void addColumn(transaction::Transaction* transaction, TableAddColumnState& addColumnState,
+        ColumnStats* newColumnStats);
 
     void checkIfNodeHasRels(transaction::Transaction* transaction,
         common::ValueVector* srcNodeIDVector) const;
@@ -62,7 +63,8 @@ public:
         return numRows;
     }
 
-    void checkpoint(const std::vector<common::column_id_t>& columnIDs);
+    // Returns the degree histogram of the bound nodes after checkpoint.
+    EquiDepthHistogram checkpoint(const std::vector<common::column_id_t>& columnIDs);
 
     void serialize(common::Serializer& serializer) const;
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <mutex>
+#include <unordered_map>
+
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "common/enums/zone_map_check_result.h"
 #include "common/mask.h"
@@ -25,6 +28,11 @@ struct TableScanState {
 
     // Only used when scan from persistent data.
     std::vector<Column*> columns;
+    // Hint for the pages read by sequential scans of persistent data.
+    PageAccessHint accessHint = PageAccessHint::DEFAULT;
+    // Whether the persistent data of a node group is read from start to end, so that its pages
+    // are worth reading ahead. Lookups and scans done to update or checkpoint data don't.
+    bool readAhead = false;
 
     TableScanSource source = TableScanSource::NONE;
     common::node_group_idx_t nodeGroupIdx = common::INVALID_NODE_GROUP_IDX;
@@ -168,6 +176,17 @@ public:
 
     virtual common::row_idx_t getNumRows() = 0;
 
+    // Stats of the data appended to the table, see TableStats. The stats collected by a
+    // transaction are kept aside until it commits, and dropped if it rolls back.
+    ColumnStats getColumnStats(common::column_id_t columnID) const;
+    EquiDepthHistogram getDegreeHistogram(common::RelDataDirection direction) const;
+    void updateStats(transaction::Transaction* transaction,
+        const std::vector<common::column_id_t>& columnIDs, const ChunkedNodeGroup& chunkedGroup,
+        common::row_idx_t startRow, common::row_idx_t numRows);
+    void mergeStats(transaction::Transaction* transaction, const TableStats& other);
+    void commitStats(common::transaction_t transactionID);
+    void rollbackStats(common::transaction_t transactionID);
+
     void setHasChanges() { hasChanges = true; }
 
     template<class TARGET>
@@ -191,6 +210,13 @@ protected:
     std::unique_ptr<common::DataChunk> constructDataChunk(
         const std::vector<common::LogicalType>& types);
 
+    void mergeColumnStats(transaction::Transaction* transaction, common::column_id_t columnID,
+        const ColumnStats& other);
+    void setDegreeHistogram(common::RelDataDirection direction, EquiDepthHistogram histogram);
+    // Keeps the stats of the checkpointed columns and persists them in the table's catalog entry.
+    void checkpointStats(const std::vector<common::column_id_t>& columnIDs,
+        catalog::TableCatalogEntry* tableEntry);
+
 protected:
     common::TableType tableType;
     common::table_id_t tableID;
@@ -201,6 +227,9 @@ protected:
     BufferManager* bufferManager;
     ShadowFile* shadowFile;
     bool hasChanges;
+    mutable std::mutex statsMtx;
+    TableStats stats;
+    std::unordered_map<common::transaction_t, TableStats> uncommittedStats;
 };
 
 } // namespace storage
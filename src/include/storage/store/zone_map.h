@@ -0,0 +1,66 @@
+#pragma once
+
+#include "storage/compression/compression.h"
+
+namespace kuzu {
+namespace storage {
+
+// Min/max statistics over a range of values of a column chunk. On-disk chunks keep one zone map per
+// vector of values so that scans can skip vectors which cannot satisfy a column predicate.
+struct ZoneMap {
+    StorageValue min;
+    StorageValue max;
+    // If false, min and max are meaningless as all values in the range are null.
+    bool hasNonNullValues;
+    bool hasNulls;
+
+    ZoneMap() : min{}, max{}, hasNonNullValues{false}, hasNulls{false} {}
+
+    static bool isSupported(common::PhysicalTypeID physicalType) {
+        switch (physicalType) {
+        case common::PhysicalTypeID::BOOL:
+        case common::PhysicalTypeID::INT128:
+        case common::PhysicalTypeID::INT64:
+        case common::PhysicalTypeID::INT32:
+        case common::PhysicalTypeID::INT16:
+        case common::PhysicalTypeID::INT8:
+        case common::PhysicalTypeID::UINT64:
+        case common::PhysicalTypeID::UINT32:
+        case common::PhysicalTypeID::UINT16:
+        case common::PhysicalTypeID::UINT8:
+        case common::PhysicalTypeID::DOUBLE:
+        case common::PhysicalTypeID::FLOAT:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Widens the zone map so that it also covers the given values. Min and max are either both
+    // provided or both absent (when all the new values are null).
+    void update(const std::optional<StorageValue>& newMin,
+        const std::optional<StorageValue>& newMax, bool newHasNulls,
+        common::PhysicalTypeID physicalType) {
+        KU_ASSERT(newMin.has_value() == newMax.has_value());
+        hasNulls = hasNulls || newHasNulls;
+        if (!newMin) {
+            return;
+        }
+        if (!hasNonNullValues) {
+            min = *newMin;
+            max = *newMax;
+            hasNonNullValues = true;
+            return;
+        }
+        if (min.gt(*newMin, physicalType)) {
+            min = *newMin;
+        }
+        if (newMax->gt(max, physicalType)) {
+            max = *newMax;
+        }
+    }
+};
+static_assert(std::is_trivially_copyable_v<ZoneMap>);
+
+} // namespace storage
+} // namespace kuzu
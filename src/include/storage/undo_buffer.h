@@ -62,6 +62,7 @@ private:
     const UndoBuffer& undoBuffer;
 };
 
+class Table;
 class UpdateInfo;
 class VersionInfo;
 struct VectorUpdateInfo;
@@ -78,6 +79,7 @@ public:
         UPDATE_INFO = 6,
         INSERT_INFO = 7,
         DELETE_INFO = 8,
+        TABLE_STATS = 9,
     };
 
     explicit UndoBuffer(transaction::Transaction* transaction);
@@ -91,6 +93,7 @@ public:
         common::row_idx_t startRowInVector, common::row_idx_t numRows);
     void createVectorUpdateInfo(UpdateInfo* updateInfo, common::idx_t vectorIdx,
         VectorUpdateInfo* vectorUpdateInfo);
+    void createTableStats(Table* table);
 
     void commit(common::transaction_t commitTS) const;
     void rollback();
@@ -119,6 +122,8 @@ private:
 
     void commitVectorUpdateInfo(const uint8_t* record, common::transaction_t commitTS) const;
     void rollbackVectorUpdateInfo(const uint8_t* record) const;
+    void commitTableStats(const uint8_t* record) const;
+    void rollbackTableStats(const uint8_t* record) const;
 
 private:
     std::mutex mtx;
@@ -17,6 +17,7 @@ class ClientContext;
 } // namespace main
 namespace storage {
 class LocalStorage;
+class Table;
 class UndoBuffer;
 class WAL;
 } // namespace storage
@@ -100,6 +101,7 @@ public:
         common::row_idx_t startRowInVector, common::row_idx_t numRows) const;
     void pushVectorUpdateInfo(storage::UpdateInfo& updateInfo, common::idx_t vectorIdx,
         storage::VectorUpdateInfo& vectorUpdateInfo) const;
+    void pushTableStats(storage::Table& table) const;
 
 private:
     TransactionType type;
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
 #include <unordered_set>
 
 #include "storage/wal/wal.h"
@@ -10,6 +14,7 @@
 namespace kuzu {
 namespace main {
 class ClientContext;
+class Database;
 } // namespace main
 
 namespace testing {
@@ -25,6 +30,7 @@ public:
     // Timestamp starts from 1. 0 is reserved for the dummy system transaction.
     explicit TransactionManager(storage::WAL& wal)
         : wal{wal}, lastTransactionID{Transaction::START_TRANSACTION_ID}, lastTimestamp{1} {};
+    ~TransactionManager();
 
     std::unique_ptr<Transaction> beginTransaction(main::ClientContext& clientContext,
         TransactionType type);
@@ -32,11 +38,29 @@ public:
     void commit(main::ClientContext& clientContext);
     void rollback(main::ClientContext& clientContext, const Transaction* transaction);
     void checkpoint(main::ClientContext& clientContext);
+    // Waits for a running background checkpoint to finish and stops the background checkpointer.
+    void stopBackgroundCheckpointer();
+    // Whether a checkpoint waits for the active transactions to leave. Transactions that can take
+    // long for reasons other than their own work, e.g., streamed query results nobody reads,
+    // should then finish as soon as they can.
+    bool isCheckpointWaiting() const { return checkpointWaiting.load(); }
 
 private:
     bool canAutoCheckpoint(const main::ClientContext& clientContext) const;
     bool canCheckpointNoLock() const;
     void checkpointNoLock(main::ClientContext& clientContext);
+    // Callers must make sure no transaction is active and none can start.
+    void checkpointStorageNoLock(main::ClientContext& clientContext);
+
+    // Auto checkpoints are run by a background thread, so that the commit crossing the checkpoint
+    // threshold does not wait for active transactions to leave and for the checkpoint itself.
+    // They are run synchronously if the threshold is 0 or the last background checkpoint failed.
+    void autoCheckpointNoLock(main::ClientContext& clientContext);
+    void requestBackgroundCheckpoint(main::Database* database);
+    void runBackgroundCheckpointer(main::Database* database);
+    void checkpointWhenNoTransactionIsActive(main::ClientContext& clientContext);
+    // Returns false if no transaction left the system before the checkpoint wait timeout.
+    bool checkpointOnceNoTransactionIsActive(main::ClientContext& clientContext);
     // This functions locks the mutex to start new transactions. This lock needs to be manually
     // unlocked later by calling allowReceivingNewTransactions() by the thread that called
     // stopNewTransactionsAndWaitUntilAllTransactionsLeave().
@@ -62,6 +86,15 @@ private:
     std::mutex mtxForSerializingPublicFunctionCalls;
     std::mutex mtxForStartingNewTransactions;
     uint64_t checkpointWaitTimeoutInMicros = common::DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS;
+
+    std::thread backgroundCheckpointer;
+    std::mutex mtxForBackgroundCheckpointer;
+    std::condition_variable cvForBackgroundCheckpointer;
+    bool backgroundCheckpointRequested = false;
+    bool stopBackgroundCheckpointerRequested = false;
+    // The error of the last background checkpoint, if it failed.
+    std::string backgroundCheckpointError;
+    std::atomic<bool> checkpointWaiting{false};
 };
 } // namespace transaction
 } // namespace kuzu
@@ -1,10 +1,14 @@
 #include "main/client_context.h"
 
+#include <thread>
+
 #include "binder/binder.h"
+#include "catalog/catalog.h"
 #include "common/exception/connection.h"
 #include "common/exception/runtime.h"
 #include "common/random_engine.h"
 #include "common/string_utils.h"
+#include "common/types/value/nested.h"
 #include "extension/extension.h"
 #include "main/attached_database.h"
 #include "main/database.h"
@@ -16,9 +20,12 @@
 #include "planner/operator/logical_plan_util.h"
 #include "planner/planner.h"
 #include "processor/plan_mapper.h"
+#include "processor/operator/result_collector.h"
 #include "processor/processor.h"
+#include "processor/result/result_stream.h"
 #include "storage/storage_manager.h"
 #include "transaction/transaction_context.h"
+#include "transaction/transaction_manager.h"
 
 #if defined(_WIN32)
 #include "common/windows_utils.h"
@@ -57,6 +64,7 @@ ClientContext::ClientContext(Database* database)
     clientConfig.enableSemiMask = ClientConfigDefault::ENABLE_SEMI_MASK;
     clientConfig.enableZoneMap = ClientConfigDefault::ENABLE_ZONE_MAP;
     clientConfig.numThreads = database->dbConfig.maxNumThreads;
+    clientConfig.maxNumConcurrentPipelines = ClientConfigDefault::MAX_NUM_CONCURRENT_PIPELINES;
     clientConfig.timeoutInMS = ClientConfigDefault::TIMEOUT_IN_MS;
     clientConfig.varLengthMaxDepth = ClientConfigDefault::VAR_LENGTH_MAX_DEPTH;
     clientConfig.enableProgressBar = ClientConfigDefault::ENABLE_PROGRESS_BAR;
@@ -65,9 +73,25 @@ ClientContext::ClientContext(Database* database)
     clientConfig.recursivePatternCardinalityScaleFactor =
         ClientConfigDefault::RECURSIVE_PATTERN_FACTOR;
     clientConfig.disableMapKeyCheck = ClientConfigDefault::DISABLE_MAP_KEY_CHECK;
+    clientConfig.enableInMemGraph = ClientConfigDefault::ENABLE_IN_MEM_GRAPH;
+    clientConfig.queryCacheSize = ClientConfigDefault::QUERY_CACHE_SIZE;
+    clientConfig.enableResultStreaming = ClientConfigDefault::ENABLE_RESULT_STREAMING;
+    clientConfig.parallelFinalizeThreshold = ClientConfigDefault::PARALLEL_FINALIZE_THRESHOLD;
+    clientConfig.enableSpilling = ClientConfigDefault::ENABLE_SPILLING;
 }
 
-ClientContext::~ClientContext() = default;
+// A query whose result is streamed while it executes in the background.
+struct StreamingQuery {
+    std::unique_ptr<PhysicalPlan> physicalPlan;
+    std::unique_ptr<Profiler> profiler;
+    std::unique_ptr<ExecutionContext> executionContext;
+    std::shared_ptr<ResultStream> resultStream;
+    std::thread thread;
+};
+
+ClientContext::~ClientContext() {
+    finishStreamingQueryNoLock();
+}
 
 uint64_t ClientContext::getTimeoutRemainingInMS() const {
     KU_ASSERT(hasTimeout());
@@ -83,6 +107,7 @@ void ClientContext::startTimer() {
 
 void ClientContext::setQueryTimeOut(uint64_t timeoutInMS) {
     lock_t lck{mtx};
+    finishStreamingQueryNoLock();
     clientConfig.timeoutInMS = timeoutInMS;
 }
 
@@ -92,6 +117,7 @@ uint64_t ClientContext::getQueryTimeOut() const {
 
 void ClientContext::setMaxNumThreadForExec(uint64_t numThreads) {
     lock_t lck{mtx};
+    finishStreamingQueryNoLock();
     clientConfig.numThreads = numThreads;
 }
 
@@ -242,6 +268,7 @@ std::unique_ptr<PreparedStatement> ClientContext::prepare(std::string_view query
         return preparedStatementWithError("Connection Exception: Query is empty.");
     }
     std::unique_lock<std::mutex> lck{mtx};
+    finishStreamingQueryNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = Parser::parseQuery(query);
@@ -258,6 +285,7 @@ std::unique_ptr<PreparedStatement> ClientContext::prepare(std::string_view query
 std::unique_ptr<PreparedStatement> ClientContext::prepareTest(std::string_view query) {
     auto preparedStatement = std::unique_ptr<PreparedStatement>();
     std::unique_lock<std::mutex> lck{mtx};
+    finishStreamingQueryNoLock();
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = Parser::parseQuery(query);
@@ -284,9 +312,23 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view queryStatemen
 std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     std::string_view encodedJoin, bool enumerateAllPlans, std::optional<uint64_t> queryID) {
     lock_t lck{mtx};
+    finishStreamingQueryNoLock();
     if (query.empty()) {
         return queryResultWithError("Connection Exception: Query is empty.");
     }
+    queryCache.setCapacity(clientConfig.queryCacheSize);
+    const auto useQueryCache =
+        clientConfig.queryCacheSize > 0 && encodedJoin.empty() && !enumerateAllPlans;
+    const auto queryText = std::string(query);
+    if (useQueryCache) {
+        const auto cachedStatement = queryCache.get(queryText);
+        if (cachedStatement != nullptr) {
+            if (canReusePlanNoLock(*cachedStatement)) {
+                return executeReusedPlanNoLock(cachedStatement, queryID);
+            }
+            queryCache.erase(queryText);
+        }
+    }
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
         parsedStatements = Parser::parseQuery(query);
@@ -298,8 +340,13 @@ std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     for (auto& statement : parsedStatements) {
         auto preparedStatement = prepareNoLock(statement,
             enumerateAllPlans /* enumerate all plans */, encodedJoin, false /*requireNewTx*/);
-        auto currentQueryResult =
-            executeAndAutoCommitIfNecessaryNoLock(preparedStatement.get(), 0u, queryID);
+        // The result of a statement can only be streamed if no statement runs after it.
+        auto currentQueryResult = executeAndAutoCommitIfNecessaryNoLock(preparedStatement.get(),
+            0u, queryID, statement == parsedStatements.back() /* allowStreaming */);
+        if (useQueryCache && parsedStatements.size() == 1 && preparedStatement->planReusable &&
+            currentQueryResult->isSuccess()) {
+            queryCache.put(queryText, std::move(preparedStatement));
+        }
         if (!lastResult) {
             // first result of the query
             queryResult = std::move(currentQueryResult);
@@ -329,10 +376,38 @@ std::unique_ptr<PreparedStatement> ClientContext::preparedStatementWithError(
     return preparedStatement;
 }
 
+static bool containsTableFunctionCall(const LogicalOperator& op) {
+    if (op.getOperatorType() == LogicalOperatorType::TABLE_FUNCTION_CALL) {
+        return true;
+    }
+    for (auto i = 0u; i < op.getNumChildren(); i++) {
+        if (containsTableFunctionCall(*op.getChild(i))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Only the plans of queries are reused. Table functions, e.g. scans of files, are bound against
+// state outside the catalog, such as the columns of a file, so their plans are not reused either.
+static bool canReusePlans(StatementType statementType,
+    const std::vector<std::unique_ptr<LogicalPlan>>& plans) {
+    if (statementType != StatementType::QUERY) {
+        return false;
+    }
+    for (auto& plan : plans) {
+        if (containsTableFunctionCall(*plan->getLastOperator())) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::unique_ptr<PreparedStatement> ClientContext::prepareNoLock(
     std::shared_ptr<Statement> parsedStatement, bool enumerateAllPlans,
     std::string_view encodedJoin, bool requireNewTx,
     std::optional<std::unordered_map<std::string, std::shared_ptr<Value>>> inputParams) {
+    finishStreamingQueryNoLock();
     auto preparedStatement = std::make_unique<PreparedStatement>();
     auto compilingTimer = TimeMetric(true /* enable */);
     compilingTimer.start();
@@ -356,6 +431,9 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareNoLock(
             }
         }
         // binding
+        preparedStatement->plannedCatalog = getCatalog();
+        preparedStatement->plannedCatalogVersion = getCatalog()->getVersion();
+        preparedStatement->plannedConfigVersion = configVersion;
         auto binder = Binder(this);
         if (inputParams) {
             binder.setInputParameters(*inputParams);
@@ -391,6 +469,13 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareNoLock(
         } else {
             preparedStatement->logicalPlans = std::move(plans);
         }
+        preparedStatement->planReusable =
+            canReusePlans(preparedStatement->getStatementType(), preparedStatement->logicalPlans);
+        if (preparedStatement->planReusable) {
+            for (auto& [name, value] : preparedStatement->parameterMap) {
+                preparedStatement->plannedParameters.emplace(name, std::make_unique<Value>(*value));
+            }
+        }
         if (transactionContext->isAutoTransaction() && requireNewTx) {
             this->transactionContext->commit();
         }
@@ -430,6 +515,7 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     std::optional<uint64_t> queryID) { // NOLINT(performance-unnecessary-value-param): It doesn't
                                        // make sense to pass the map as a const reference.
     lock_t lck{mtx};
+    finishStreamingQueryNoLock();
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
@@ -438,11 +524,80 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     } catch (std::exception& e) {
         return queryResultWithError(e.what());
     }
+    if (canReusePlanNoLock(*preparedStatement)) {
+        return executeReusedPlanNoLock(preparedStatement, queryID);
+    }
     // rebind
     KU_ASSERT(preparedStatement->parsedStatement != nullptr);
     auto rebindPreparedStatement = prepareNoLock(preparedStatement->parsedStatement, false, "",
         false, preparedStatement->parameterMap);
-    return executeAndAutoCommitIfNecessaryNoLock(rebindPreparedStatement.get(), 0u, queryID);
+    if (!rebindPreparedStatement->isSuccess()) {
+        return queryResultWithError(rebindPreparedStatement->errMsg);
+    }
+    // Keep the new plans for later executions. The parameter map is shared by both statements.
+    preparedStatement->preparedSummary = rebindPreparedStatement->preparedSummary;
+    preparedStatement->statementResult = std::move(rebindPreparedStatement->statementResult);
+    preparedStatement->logicalPlans = std::move(rebindPreparedStatement->logicalPlans);
+    preparedStatement->planReusable = rebindPreparedStatement->planReusable;
+    preparedStatement->plannedCatalog = rebindPreparedStatement->plannedCatalog;
+    preparedStatement->plannedCatalogVersion = rebindPreparedStatement->plannedCatalogVersion;
+    preparedStatement->plannedConfigVersion = rebindPreparedStatement->plannedConfigVersion;
+    preparedStatement->plannedParameters =
+        std::move(rebindPreparedStatement->plannedParameters);
+    return executeAndAutoCommitIfNecessaryNoLock(preparedStatement, 0u, queryID);
+}
+
+// Binding only depends on the types of the parameters and, for values whose type is free to
+// change (e.g. nulls and empty lists), on which of their nested values are null.
+static bool bindAlike(const Value& left, const Value& right) {
+    if (left.getDataType() != right.getDataType() || left.isNull() != right.isNull()) {
+        return false;
+    }
+    if (left.isNull() || (!left.allowTypeChange() && !right.allowTypeChange())) {
+        return true;
+    }
+    const auto numChildren = NestedVal::getChildrenSize(&left);
+    if (numChildren != NestedVal::getChildrenSize(&right)) {
+        return false;
+    }
+    for (auto i = 0u; i < numChildren; i++) {
+        if (!bindAlike(*NestedVal::getChildVal(&left, i), *NestedVal::getChildVal(&right, i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ClientContext::canReusePlanNoLock(const PreparedStatement& preparedStatement) const {
+    if (!preparedStatement.planReusable || preparedStatement.plannedCatalog != getCatalog() ||
+        preparedStatement.plannedCatalogVersion != getCatalog()->getVersion() ||
+        preparedStatement.plannedConfigVersion != configVersion) {
+        return false;
+    }
+    for (auto& [name, value] : preparedStatement.parameterMap) {
+        const auto it = preparedStatement.plannedParameters.find(name);
+        if (it == preparedStatement.plannedParameters.end() || !bindAlike(*it->second, *value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeReusedPlanNoLock(
+    PreparedStatement* preparedStatement, std::optional<uint64_t> queryID) {
+    // Preparing the statement validates it against the manual transaction it runs in, which may
+    // not be the one the statement was prepared in.
+    if (preparedStatement->parsedStatement->requireTx() &&
+        !transactionContext->isAutoTransaction()) {
+        try {
+            transactionContext->validateManualTransaction(preparedStatement->isReadOnly());
+        } catch (std::exception& e) {
+            transactionContext->rollback();
+            return queryResultWithError(e.what());
+        }
+    }
+    preparedStatement->preparedSummary.compilingTime = 0;
+    return executeAndAutoCommitIfNecessaryNoLock(preparedStatement, 0u, queryID);
 }
 
 void ClientContext::bindParametersNoLock(PreparedStatement* preparedStatement,
@@ -461,7 +616,9 @@ void ClientContext::bindParametersNoLock(PreparedStatement* preparedStatement,
 }
 
 std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLock(
-    PreparedStatement* preparedStatement, uint32_t planIdx, std::optional<uint64_t> queryID) {
+    PreparedStatement* preparedStatement, uint32_t planIdx, std::optional<uint64_t> queryID,
+    bool allowStreaming) {
+    finishStreamingQueryNoLock();
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
@@ -489,6 +646,11 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
     }
     auto executionContext = std::make_unique<ExecutionContext>(profiler.get(), this, *queryID);
     profiler->enabled = preparedStatement->isProfile();
+    if (allowStreaming && canStreamResult(*preparedStatement, *physicalPlan)) {
+        return streamResultNoLock(std::move(queryResult), std::move(physicalPlan),
+            std::move(profiler), std::move(executionContext),
+            preparedStatement->statementResult->getColumns());
+    }
     auto executingTimer = TimeMetric(true /* enable */);
     executingTimer.start();
     std::shared_ptr<FactorizedTable> resultFT;
@@ -510,15 +672,79 @@ std::unique_ptr<QueryResult> ClientContext::executeAndAutoCommitIfNecessaryNoLoc
         return queryResultWithError(e.what());
     }
     executingTimer.stop();
+    if (preparedStatement->getStatementType() == StatementType::STANDALONE_CALL) {
+        configVersion++;
+    }
     queryResult->querySummary->executionTime = executingTimer.getElapsedTimeMS();
     queryResult->initResultTableAndIterator(std::move(resultFT),
         preparedStatement->statementResult->getColumns());
     return queryResult;
 }
 
+// Only results of read-only queries run in auto transactions are streamed. Their transaction
+// stays open until the query finishes in the background, and has nothing to commit or roll back.
+bool ClientContext::canStreamResult(PreparedStatement& preparedStatement,
+    const PhysicalPlan& physicalPlan) const {
+    if (!clientConfig.enableResultStreaming ||
+        preparedStatement.getStatementType() != StatementType::QUERY ||
+        !preparedStatement.isReadOnly() || preparedStatement.isProfile() ||
+        !transactionContext->isAutoTransaction() ||
+        physicalPlan.lastOperator->getOperatorType() != PhysicalOperatorType::RESULT_COLLECTOR) {
+        return false;
+    }
+    return physicalPlan.lastOperator->ptrCast<ResultCollector>()->canStreamResult();
+}
+
+std::unique_ptr<QueryResult> ClientContext::streamResultNoLock(
+    std::unique_ptr<QueryResult> queryResult, std::unique_ptr<PhysicalPlan> physicalPlan,
+    std::unique_ptr<Profiler> profiler, std::unique_ptr<ExecutionContext> executionContext,
+    const expression_vector& columns) {
+    auto resultCollector = physicalPlan->lastOperator->ptrCast<ResultCollector>();
+    // A checkpoint waiting for the transaction of the query lets the query finish without waiting
+    // for the result to be consumed.
+    auto resultStream = std::make_shared<ResultStream>(
+        [transactionManager = getTransactionManagerUnsafe()] {
+            return transactionManager->isCheckpointWaiting();
+        });
+    resultCollector->streamResultTo(resultStream);
+    // The (empty) table of the collector holds the result until the first table is streamed.
+    queryResult->initResultTableAndIterator(resultCollector->getResultFactorizedTable(), columns);
+    queryResult->setResultStream(resultStream);
+    streamingQuery = std::make_unique<StreamingQuery>();
+    streamingQuery->physicalPlan = std::move(physicalPlan);
+    streamingQuery->profiler = std::move(profiler);
+    streamingQuery->executionContext = std::move(executionContext);
+    streamingQuery->resultStream = std::move(resultStream);
+    streamingQuery->thread = std::thread([this, query = streamingQuery.get()]() {
+        try {
+            localDatabase->queryProcessor->execute(query->physicalPlan.get(),
+                query->executionContext.get());
+            transactionContext->commit();
+            query->resultStream->finish();
+        } catch (std::exception& e) {
+            transactionContext->rollback();
+            progressBar->endProgress(query->executionContext->queryID);
+            query->resultStream->finish(std::current_exception());
+        }
+    });
+    return queryResult;
+}
+
+void ClientContext::finishStreamingQueryNoLock() {
+    if (streamingQuery == nullptr) {
+        return;
+    }
+    // The previous result can still be read up to what the query produced so far.
+    streamingQuery->resultStream->cancel();
+    streamingQuery->thread.join();
+    streamingQuery = nullptr;
+    resetActiveQuery();
+}
+
 // If there is an active transaction in the context, we execute the function in current active
 // transaction. If there is no active transaction, we start an auto commit transaction.
 void ClientContext::runFuncInTransaction(const std::function<void(void)>& fun) {
+    finishStreamingQueryNoLock();
     // check if we are on AutoCommit. In this case we should start a transaction
     bool startNewTrx = !transactionContext->hasActiveTransaction();
     if (startNewTrx) {
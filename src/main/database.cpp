@@ -17,6 +17,7 @@
 #include "processor/processor.h"
 #include "storage/storage_extension.h"
 #include "storage/storage_manager.h"
+#include "storage/storage_utils.h"
 #include "transaction/transaction_manager.h"
 
 using namespace kuzu::catalog;
@@ -28,9 +29,11 @@ namespace kuzu {
 namespace main {
 
 SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads, bool enableCompression,
-    bool readOnly, uint64_t maxDBSize, bool autoCheckpoint, uint64_t checkpointThreshold)
+    bool readOnly, uint64_t maxDBSize, bool autoCheckpoint, uint64_t checkpointThreshold,
+    EvictionPolicy evictionPolicy)
     : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly{readOnly},
-      autoCheckpoint{autoCheckpoint}, checkpointThreshold{checkpointThreshold} {
+      autoCheckpoint{autoCheckpoint}, checkpointThreshold{checkpointThreshold},
+      evictionPolicy{evictionPolicy} {
     if (bufferPoolSize_ == -1u || bufferPoolSize_ == 0) {
 #if defined(_WIN32)
         MEMORYSTATUSEX status;
@@ -77,11 +80,17 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
     auto clientContext = ClientContext(this);
     const auto dbPathStr = std::string(databasePath);
     this->databasePath = vfs->expandPath(&clientContext, dbPathStr);
-    bufferManager =
-        std::make_unique<BufferManager>(this->dbConfig.bufferPoolSize, this->dbConfig.maxDBSize);
-    memoryManager = std::make_unique<MemoryManager>(bufferManager.get(), vfs.get(), nullptr);
+    bufferManager = std::make_unique<BufferManager>(this->dbConfig.bufferPoolSize,
+        this->dbConfig.maxDBSize, this->dbConfig.evictionPolicy);
     queryProcessor = std::make_unique<processor::QueryProcessor>(dbConfig.maxNumThreads);
     initAndLockDBDir();
+    std::string spillFilePath;
+    // Read-only databases may be opened by multiple processes, which must not share a spill file.
+    if (!DBConfig::isDBPathInMemory(this->databasePath) && !dbConfig.readOnly) {
+        spillFilePath = StorageUtils::getSpillFilePath(vfs.get(), this->databasePath);
+    }
+    memoryManager = std::make_unique<MemoryManager>(bufferManager.get(), vfs.get(),
+        nullptr /* context */, spillFilePath);
     catalog = std::make_unique<Catalog>(this->databasePath, vfs.get());
     storageManager = std::make_unique<StorageManager>(dbPathStr, dbConfig.readOnly, *catalog,
         *memoryManager, dbConfig.enableCompression, vfs.get(), &clientContext);
@@ -92,6 +101,7 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig)
 }
 
 Database::~Database() {
+    transactionManager->stopBackgroundCheckpointer();
     if (!dbConfig.readOnly && dbConfig.forceCheckpointOnClose) {
         try {
             ClientContext clientContext(this);
@@ -21,14 +21,19 @@ static ConfigurationOption options[] = { // NOLINT(cert-err58-cpp):
     GET_CONFIGURATION(RecursivePatternSemanticSetting),
     GET_CONFIGURATION(RecursivePatternFactorSetting), GET_CONFIGURATION(EnableMVCCSetting),
     GET_CONFIGURATION(CheckpointThresholdSetting), GET_CONFIGURATION(AutoCheckpointSetting),
-    GET_CONFIGURATION(ForceCheckpointClosingDBSetting)};
+    GET_CONFIGURATION(ForceCheckpointClosingDBSetting),
+    GET_CONFIGURATION(MaxConcurrentPipelinesSetting), GET_CONFIGURATION(EnableInMemGraphSetting),
+    GET_CONFIGURATION(QueryCacheSizeSetting),
+    GET_CONFIGURATION(EnableResultStreamingSetting),
+    GET_CONFIGURATION(ParallelFinalizeThresholdSetting), GET_CONFIGURATION(EnableSpillingSetting)};
 
 DBConfig::DBConfig(const SystemConfig& systemConfig)
     : bufferPoolSize{systemConfig.bufferPoolSize}, maxNumThreads{systemConfig.maxNumThreads},
       enableCompression{systemConfig.enableCompression}, readOnly{systemConfig.readOnly},
       maxDBSize{systemConfig.maxDBSize}, enableMultiWrites{false},
       autoCheckpoint{systemConfig.autoCheckpoint},
-      checkpointThreshold{systemConfig.checkpointThreshold}, forceCheckpointOnClose{true} {}
+      checkpointThreshold{systemConfig.checkpointThreshold}, forceCheckpointOnClose{true},
+      evictionPolicy{systemConfig.evictionPolicy} {}
 
 ConfigurationOption* DBConfig::getOptionByName(const std::string& optionName) {
     auto lOptionName = optionName;
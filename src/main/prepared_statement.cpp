@@ -2,6 +2,7 @@
 
 #include "binder/bound_statement_result.h" // IWYU pragma: keep (used to avoid error in destructor)
 #include "common/enums/statement_type.h"
+#include "common/types/value/value.h"
 #include "planner/operator/logical_plan.h"
 
 using namespace kuzu::common;
@@ -0,0 +1,48 @@
+#include "main/query_cache.h"
+
+namespace kuzu {
+namespace main {
+
+void QueryCache::setCapacity(uint64_t capacity_) {
+    capacity = capacity_;
+    evict();
+}
+
+PreparedStatement* QueryCache::get(const std::string& query) {
+    const auto it = entryIndex.find(query);
+    if (it == entryIndex.end()) {
+        return nullptr;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    return it->second->second.get();
+}
+
+void QueryCache::put(const std::string& query,
+    std::unique_ptr<PreparedStatement> preparedStatement) {
+    erase(query);
+    if (capacity == 0) {
+        return;
+    }
+    entries.emplace_front(query, std::move(preparedStatement));
+    entryIndex.emplace(query, entries.begin());
+    evict();
+}
+
+void QueryCache::erase(const std::string& query) {
+    const auto it = entryIndex.find(query);
+    if (it == entryIndex.end()) {
+        return;
+    }
+    entries.erase(it->second);
+    entryIndex.erase(it);
+}
+
+void QueryCache::evict() {
+    while (entries.size() > capacity) {
+        entryIndex.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+} // namespace main
+} // namespace kuzu
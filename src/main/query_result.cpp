@@ -7,6 +7,7 @@
 #include "common/types/value/rel.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/flat_tuple.h"
+#include "processor/result/result_stream.h"
 
 using namespace kuzu::common;
 using namespace kuzu::processor;
@@ -23,7 +24,12 @@ QueryResult::QueryResult(const PreparedSummary& preparedSummary) {
     queryResultIterator = QueryResultIterator{this};
 }
 
-QueryResult::~QueryResult() = default;
+QueryResult::~QueryResult() {
+    if (resultStream != nullptr) {
+        // Nobody will read the rest of the result.
+        resultStream->cancel();
+    }
+}
 
 bool QueryResult::isSuccess() const {
     return success;
@@ -46,7 +52,8 @@ std::vector<LogicalType> QueryResult::getColumnDataTypes() const {
 }
 
 uint64_t QueryResult::getNumTuples() const {
-    return factorizedTable->getTotalNumFlatTuples();
+    collectRemainingTables();
+    return numFlatTuplesOfDroppedTables + factorizedTable->getTotalNumFlatTuples();
 }
 
 QuerySummary* QueryResult::getQuerySummary() const {
@@ -54,6 +61,12 @@ QuerySummary* QueryResult::getQuerySummary() const {
 }
 
 void QueryResult::resetIterator() {
+    collectRemainingTables();
+    if (numFlatTuplesOfDroppedTables > 0) {
+        throw RuntimeException(
+            "Cannot reset the iterator of a streamed query result after reading past its first "
+            "tuples.");
+    }
     iterator->resetState();
 }
 
@@ -77,9 +90,64 @@ void QueryResult::initResultTableAndIterator(
     iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, std::move(valuesToCollect));
 }
 
+void QueryResult::setResultStream(std::shared_ptr<ResultStream> resultStream_) {
+    resultStream = std::move(resultStream_);
+}
+
+bool QueryResult::fetchNextTable() const {
+    if (resultStream == nullptr) {
+        return false;
+    }
+    auto table = resultStream->pop();
+    if (table == nullptr) {
+        resultStream = nullptr;
+        return false;
+    }
+    numFlatTuplesOfDroppedTables += factorizedTable->getTotalNumFlatTuples();
+    factorizedTable = std::move(table);
+    std::vector<Value*> valuesToCollect;
+    for (auto i = 0u; i < columnDataTypes.size(); ++i) {
+        valuesToCollect.push_back(tuple->getValue(i));
+    }
+    iterator = std::make_unique<FlatTupleIterator>(*factorizedTable, std::move(valuesToCollect));
+    return true;
+}
+
+void QueryResult::collectRemainingTables() const {
+    if (resultStream == nullptr) {
+        return;
+    }
+    // The iterator of an empty table has not positioned itself on the first tuple.
+    auto iteratorNeedsReset = factorizedTable->isEmpty();
+    while (true) {
+        auto table = resultStream->pop();
+        if (table == nullptr) {
+            resultStream = nullptr;
+            break;
+        }
+        factorizedTable->merge(*table);
+    }
+    if (iteratorNeedsReset) {
+        iterator->resetState();
+    }
+}
+
 bool QueryResult::hasNext() const {
     validateQuerySucceed();
-    return iterator->hasNextFlatTuple();
+    while (!iterator->hasNextFlatTuple()) {
+        if (!fetchNextTable()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool QueryResult::canReadFlatTupleRuns() const {
+    return success && iterator->canReadFlatTupleRuns();
+}
+
+FlatTupleRun QueryResult::getNextFlatTupleRun(uint64_t maxNumFlatTuples) {
+    return iterator->getNextFlatTupleRun(maxNumFlatTuples);
 }
 
 bool QueryResult::hasNextQueryResult() const {
@@ -52,6 +52,9 @@ void ProjectionPushDownOptimizer::visitPathPropertyProbe(planner::LogicalOperato
     if (!patternInUse.contains(rel)) {
         pathPropertyProbe->setJoinType(planner::RecursiveJoinType::TRACK_NONE);
         recursiveExtend->setJoinType(planner::RecursiveJoinType::TRACK_NONE);
+    } else {
+        // Tracked paths are only computed from the bound node side.
+        recursiveExtend->setBwdRecursiveChild(nullptr);
     }
 }
 
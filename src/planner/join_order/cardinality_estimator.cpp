@@ -1,6 +1,11 @@
 #include "planner/join_order/cardinality_estimator.h"
 
+#include "binder/expression/literal_expression.h"
+#include "binder/expression/parameter_expression.h"
 #include "binder/expression/property_expression.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/type_utils.h"
 #include "main/client_context.h"
 #include "planner/join_order/join_order_util.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
@@ -9,6 +14,7 @@
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
+using namespace kuzu::storage;
 using namespace kuzu::transaction;
 
 namespace kuzu {
@@ -93,19 +99,172 @@ static bool isPrimaryKey(const Expression& expression) {
 
 uint64_t CardinalityEstimator::estimateFilter(const LogicalPlan& childPlan,
     const Expression& predicate) {
-    if (predicate.expressionType == ExpressionType::EQUALS) {
-        if (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1))) {
-            return 1;
-        } else {
-            return atLeastOne(
-                childPlan.estCardinality * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
+    if (predicate.expressionType == ExpressionType::EQUALS &&
+        (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1)))) {
+        return 1;
+    }
+    return atLeastOne(childPlan.estCardinality * getSelectivity(predicate));
+}
+
+static std::optional<double> getNumericValue(const Value& value) {
+    if (value.isNull()) {
+        return std::nullopt;
+    }
+    std::optional<double> result;
+    TypeUtils::visit(value.getDataType().getPhysicalType(), [&]<typename T>(T) {
+        if constexpr (std::is_arithmetic_v<T>) {
+            result = static_cast<double>(value.getValue<T>());
         }
-    } else {
-        return atLeastOne(
-            childPlan.estCardinality * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY);
+    });
+    return result;
+}
+
+static ExpressionType flipComparison(ExpressionType type) {
+    switch (type) {
+    case ExpressionType::GREATER_THAN:
+        return ExpressionType::LESS_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return ExpressionType::LESS_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return ExpressionType::GREATER_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return ExpressionType::GREATER_THAN_EQUALS;
+    default:
+        return type;
     }
 }
 
+static double getNonNullFraction(const ColumnStats& stats) {
+    return 1 - static_cast<double>(stats.getNumNulls()) / static_cast<double>(stats.getNumValues());
+}
+
+static double getEqualitySelectivity(const ColumnStats& stats, std::optional<double> value) {
+    const auto numDistinctValues = stats.getNumDistinctValues();
+    if (numDistinctValues == 0) {
+        return 0;
+    }
+    const auto nonNullFraction = getNonNullFraction(stats);
+    const auto uniformFraction = 1 / static_cast<double>(numDistinctValues);
+    auto& histogram = stats.getHistogram();
+    if (!value || histogram.isEmpty()) {
+        return nonNullFraction * uniformFraction;
+    }
+    if (*value < histogram.getMin() || *value > histogram.getMax()) {
+        return 0;
+    }
+    // Frequent values take up a share of the histogram larger than the uniform one.
+    const auto pointFraction =
+        histogram.getFractionLessThanOrEqual(*value) - histogram.getFractionLessThan(*value);
+    return nonNullFraction * std::max(pointFraction, uniformFraction);
+}
+
+static std::optional<double> getRangeSelectivity(const ColumnStats& stats,
+    ExpressionType comparison, double value) {
+    auto& histogram = stats.getHistogram();
+    if (histogram.isEmpty()) {
+        return std::nullopt;
+    }
+    const auto nonNullFraction = getNonNullFraction(stats);
+    switch (comparison) {
+    case ExpressionType::LESS_THAN:
+        return nonNullFraction * histogram.getFractionLessThan(value);
+    case ExpressionType::LESS_THAN_EQUALS:
+        return nonNullFraction * histogram.getFractionLessThanOrEqual(value);
+    case ExpressionType::GREATER_THAN:
+        return nonNullFraction * (1 - histogram.getFractionLessThanOrEqual(value));
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return nonNullFraction * (1 - histogram.getFractionLessThan(value));
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+double CardinalityEstimator::getSelectivity(const Expression& predicate) {
+    const auto defaultSelectivity = predicate.expressionType == ExpressionType::EQUALS ?
+                                        PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY :
+                                        PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
+    if (ExpressionTypeUtil::isNullOperator(predicate.expressionType)) {
+        if (predicate.getChild(0)->expressionType != ExpressionType::PROPERTY) {
+            return defaultSelectivity;
+        }
+        const auto isNull = predicate.expressionType == ExpressionType::IS_NULL;
+        return getSelectivity(
+            predicate.getChild(0)->constCast<PropertyExpression>(),
+            [&](const ColumnStats& stats) {
+                const auto nonNullFraction = getNonNullFraction(stats);
+                return isNull ? 1 - nonNullFraction : nonNullFraction;
+            },
+            defaultSelectivity);
+    }
+    if (!ExpressionTypeUtil::isComparison(predicate.expressionType)) {
+        return defaultSelectivity;
+    }
+    // Only comparisons between a property and a constant are estimated from stats.
+    auto comparison = predicate.expressionType;
+    auto property = predicate.getChild(0);
+    auto constant = predicate.getChild(1);
+    if (property->expressionType != ExpressionType::PROPERTY) {
+        std::swap(property, constant);
+        comparison = flipComparison(comparison);
+    }
+    if (property->expressionType != ExpressionType::PROPERTY ||
+        constant->getDataType() != property->getDataType()) {
+        return defaultSelectivity;
+    }
+    std::optional<double> value;
+    switch (constant->expressionType) {
+    case ExpressionType::LITERAL: {
+        value = getNumericValue(constant->constCast<LiteralExpression>().getValue());
+    } break;
+    case ExpressionType::PARAMETER: {
+        // The plan may be reused for other values of the parameter, so its value is not used.
+        if (comparison != ExpressionType::EQUALS && comparison != ExpressionType::NOT_EQUALS) {
+            return defaultSelectivity;
+        }
+    } break;
+    default:
+        return defaultSelectivity;
+    }
+    if (comparison != ExpressionType::EQUALS && comparison != ExpressionType::NOT_EQUALS &&
+        !value) {
+        return defaultSelectivity;
+    }
+    return getSelectivity(
+        property->constCast<PropertyExpression>(),
+        [&](const ColumnStats& stats) {
+            switch (comparison) {
+            case ExpressionType::EQUALS:
+                return getEqualitySelectivity(stats, value);
+            case ExpressionType::NOT_EQUALS:
+                return getNonNullFraction(stats) - getEqualitySelectivity(stats, value);
+            default:
+                return getRangeSelectivity(stats, comparison, *value).value_or(defaultSelectivity);
+            }
+        },
+        defaultSelectivity);
+}
+
+double CardinalityEstimator::getSelectivity(const PropertyExpression& property,
+    const std::function<double(const ColumnStats&)>& estimate, double defaultSelectivity) {
+    double numRows = 0;
+    double numSelectedRows = 0;
+    for (auto tableID : property.getTableIDs()) {
+        if (!property.hasProperty(tableID)) {
+            continue;
+        }
+        const auto tableEntry =
+            context->getCatalog()->getTableCatalogEntry(context->getTx(), tableID);
+        const auto table = context->getStorageManager()->getTable(tableID);
+        const auto stats =
+            table->getColumnStats(tableEntry->getColumnID(property.getPropertyName()));
+        const auto numTableRows = static_cast<double>(table->getNumRows());
+        numRows += numTableRows;
+        numSelectedRows +=
+            numTableRows * (stats.getNumValues() == 0 ? defaultSelectivity : estimate(stats));
+    }
+    return numRows == 0 ? defaultSelectivity : numSelectedRows / numRows;
+}
+
 uint64_t CardinalityEstimator::getNumNodes(const std::vector<table_id_t>& tableIDs) {
     auto numNodes = 1u;
     for (auto& tableID : tableIDs) {
@@ -134,7 +293,16 @@ double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     case QueryRelType::VARIABLE_LENGTH:
     case QueryRelType::SHORTEST:
     case QueryRelType::ALL_SHORTEST: {
-        auto rate = std::min<double>(oneHopExtensionRate * rel.getUpperBound(), numRels);
+        // Each hop reaches nodes of the expected degree of a reached node rather than the average
+        // degree, which grows the number of paths faster on skewed graphs.
+        const auto reachedNodeDegree = getReachedNodeDegree(rel, boundNode);
+        double rate = 0;
+        double hopExtensionRate = oneHopExtensionRate;
+        for (auto hop = 1u; hop <= rel.getUpperBound() && rate < numRels; hop++) {
+            rate += hopExtensionRate;
+            hopExtensionRate *= reachedNodeDegree == 0 ? 1 : reachedNodeDegree;
+        }
+        rate = std::min<double>(rate, numRels);
         return rate * context->getClientConfig()->recursivePatternCardinalityScaleFactor;
     }
     default:
@@ -142,5 +310,29 @@ double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     }
 }
 
+double CardinalityEstimator::getReachedNodeDegree(const RelExpression& rel,
+    const NodeExpression& boundNode) {
+    std::vector<RelDataDirection> directions;
+    if (rel.getDirectionType() == RelDirectionType::BOTH) {
+        directions = {RelDataDirection::FWD, RelDataDirection::BWD};
+    } else if (boundNode.getUniqueName() == rel.getSrcNodeName()) {
+        directions = {RelDataDirection::FWD};
+    } else {
+        directions = {RelDataDirection::BWD};
+    }
+    EquiDepthHistogram degrees;
+    for (auto tableID : rel.getTableIDs()) {
+        const auto table = context->getStorageManager()->getTable(tableID);
+        for (auto direction : directions) {
+            degrees.merge(table->getDegreeHistogram(direction));
+        }
+    }
+    if (degrees.isEmpty()) {
+        return 0;
+    }
+    // A node is reached through each of its rels, so E[d^2] / E[d] over the degrees of the nodes.
+    return degrees.getMeanOfSquares() / degrees.getMean();
+}
+
 } // namespace planner
 } // namespace kuzu
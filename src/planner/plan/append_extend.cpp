@@ -142,6 +142,17 @@ void Planner::appendNonRecursiveExtend(const std::shared_ptr<NodeExpression>& bo
     }
 }
 
+static ExtendDirection getReverseDirection(ExtendDirection direction) {
+    switch (direction) {
+    case ExtendDirection::FWD:
+        return ExtendDirection::BWD;
+    case ExtendDirection::BWD:
+        return ExtendDirection::FWD;
+    default:
+        return direction;
+    }
+}
+
 void Planner::appendRecursiveExtend(const std::shared_ptr<NodeExpression>& boundNode,
     const std::shared_ptr<NodeExpression>& nbrNode, const std::shared_ptr<RelExpression>& rel,
     ExtendDirection direction, LogicalPlan& plan) {
@@ -159,6 +170,18 @@ void Planner::appendRecursiveExtend(const std::shared_ptr<NodeExpression>& bound
     auto extend = std::make_shared<LogicalRecursiveExtend>(boundNode, nbrNode, rel, direction,
         extendFromSource, RecursiveJoinType::TRACK_PATH, plan.getLastOperator(),
         recursivePlan->getLastOperator());
+    if (rel->getRelType() != QueryRelType::VARIABLE_LENGTH &&
+        recursiveInfo->nodePredicate == nullptr) {
+        // Shortest paths to a bound nbr node can be searched from both ends, which requires
+        // extending in the opposite direction from the nbr side. Intermediate nodes met from both
+        // ends are never extended, so this is only planned if there is no node predicate to check.
+        // Whether the path has to be tracked is only known after projection push down, which
+        // removes this child again if it does.
+        auto bwdRecursivePlan = std::make_unique<LogicalPlan>();
+        createRecursivePlan(*recursiveInfo, getReverseDirection(direction), !extendFromSource,
+            *bwdRecursivePlan);
+        extend->setBwdRecursiveChild(bwdRecursivePlan->getLastOperator());
+    }
     appendFlattens(extend->getGroupsPosToFlatten(), plan);
     extend->setChild(0, plan.getLastOperator());
     extend->computeFactorizedSchema();
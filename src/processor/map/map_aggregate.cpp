@@ -1,10 +1,12 @@
 #include "binder/expression/function_expression.h"
+#include "main/db_config.h"
 #include "planner/operator/logical_aggregate.h"
 #include "processor/operator/aggregate/hash_aggregate.h"
 #include "processor/operator/aggregate/hash_aggregate_scan.h"
 #include "processor/operator/aggregate/simple_aggregate.h"
 #include "processor/operator/aggregate/simple_aggregate_scan.h"
 #include "processor/plan_mapper.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -143,6 +145,13 @@ std::unique_ptr<PhysicalOperator> PlanMapper::createHashAggregate(const expressi
     allKeys.insert(allKeys.end(), payloads.begin(), payloads.end());
     auto aggregateInputInfos = getAggregateInputInfos(allKeys, aggregates, *inSchema);
     auto sharedState = std::make_shared<HashAggregateSharedState>(aggFunctions);
+    if (clientContext->getClientConfig()->enableSpilling &&
+        clientContext->getMemoryManager()->getSpillableMemoryManager() != nullptr &&
+        HashAggregateSharedState::canSpill(aggFunctions)) {
+        // Spill once the groups take up half of the buffer pool.
+        sharedState->enableSpilling(clientContext->getDBConfig()->bufferPoolSize / 2,
+            clientContext->getClientConfig()->numThreads);
+    }
     auto flatKeys = getKeyExpressions(keys, *inSchema, true /* isFlat */);
     auto unFlatKeys = getKeyExpressions(keys, *inSchema, false /* isFlat */);
     auto tableSchema = getFactorizedTableSchema(flatKeys, unFlatKeys, payloads, aggFunctions);
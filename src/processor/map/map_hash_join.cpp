@@ -1,8 +1,11 @@
 #include "binder/expression/expression_util.h"
+#include "main/db_config.h"
 #include "planner/operator/logical_hash_join.h"
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
+#include "processor/operator/scan/scan_table.h"
 #include "processor/plan_mapper.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::planner;
@@ -11,6 +14,51 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace processor {
 
+// Finds the scan in the probe side pipeline that outputs the join key. Tuples discarded by the scan
+// must not be observed by any operator between the scan and the probe, so we only look through
+// operators that process each tuple independently.
+static ScanTable* getScanOutputtingKey(PhysicalOperator* op, const DataPos& keyPos) {
+    while (true) {
+        switch (op->getOperatorType()) {
+        case PhysicalOperatorType::SCAN_NODE_TABLE:
+        case PhysicalOperatorType::SCAN_REL_TABLE: {
+            auto scan = ku_dynamic_cast<PhysicalOperator*, ScanTable*>(op);
+            if (scan->isOutputVector(keyPos)) {
+                return scan;
+            }
+        } break;
+        case PhysicalOperatorType::FILTER:
+        case PhysicalOperatorType::FLATTEN:
+        case PhysicalOperatorType::PROJECTION:
+        case PhysicalOperatorType::HASH_JOIN_PROBE:
+        case PhysicalOperatorType::INTERSECT:
+            break;
+        default:
+            return nullptr;
+        }
+        if (op->getNumChildren() == 0) {
+            return nullptr;
+        }
+        // The first child is always in the same pipeline.
+        op = op->getChild(0);
+    }
+}
+
+static void addRuntimeJoinFilter(const LogicalHashJoin& hashJoin, PhysicalOperator* probeSideOp,
+    HashJoinSharedState& sharedState, const DataPos& probeKeyPos, const LogicalType& keyType) {
+    if (hashJoin.getJoinType() != JoinType::INNER || hashJoin.getJoinConditions().size() != 1 ||
+        hashJoin.getSIPInfo().position != SemiMaskPosition::NONE) {
+        return;
+    }
+    auto scan = getScanOutputtingKey(probeSideOp, probeKeyPos);
+    if (scan == nullptr) {
+        return;
+    }
+    auto filter = std::make_shared<RuntimeJoinFilter>(keyType.copy());
+    sharedState.setRuntimeFilter(filter);
+    scan->addRuntimeFilter(probeKeyPos, std::move(filter));
+}
+
 std::unique_ptr<HashJoinBuildInfo> PlanMapper::createHashBuildInfo(const Schema& buildSchema,
     const expression_vector& keys, const expression_vector& payloads) {
     planner::f_group_pos_set keyGroupPosSet;
@@ -108,12 +156,34 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(LogicalOperator* logic
     } else {
         probeDataInfo.markDataPos = DataPos::getInvalidPos();
     }
+    auto spillableMemoryManager = clientContext->getMemoryManager()->getSpillableMemoryManager();
+    if (clientContext->getClientConfig()->enableSpilling && spillableMemoryManager != nullptr &&
+        hashJoin->getSIPInfo().direction != SIPDirection::PROBE_TO_BUILD) {
+        // Spill once the build side takes up half of the buffer pool.
+        sharedState->enableSpilling(clientContext->getDBConfig()->bufferPoolSize / 2);
+        auto probeSchema = hashJoin->getChild(0)->getSchema();
+        auto probeSideExpressions = probeSchema->getExpressionsInScope();
+        for (auto& probeKey : probeKeys) {
+            if (!probeSchema->isExpressionInScope(*probeKey)) {
+                probeSideExpressions.push_back(probeKey);
+            }
+        }
+        for (auto& expression : probeSideExpressions) {
+            probeDataInfo.probeSideDataPos.emplace_back(outSchema->getExpressionPos(*expression));
+            probeDataInfo.probeSideFStateTypes.push_back(
+                probeSchema->getGroup(expression)->isFlat() ? FStateType::FLAT :
+                                                              FStateType::UNFLAT);
+        }
+    }
     auto probePrintInfo = std::make_unique<HashJoinProbePrintInfo>(probeKeys);
     auto hashJoinProbe = make_unique<HashJoinProbe>(sharedState, hashJoin->getJoinType(),
         hashJoin->requireFlatProbeKeys(), probeDataInfo, std::move(probeSidePrevOperator),
         std::move(hashJoinBuild), getOperatorID(), probePrintInfo->copy());
     if (hashJoin->getSIPInfo().direction == SIPDirection::PROBE_TO_BUILD) {
         mapSIPJoin(hashJoinProbe.get());
+    } else {
+        addRuntimeJoinFilter(*hashJoin, hashJoinProbe->getChild(0), *sharedState,
+            probeKeysDataPos[0], buildKeyTypes[0]);
     }
     return hashJoinProbe;
 }
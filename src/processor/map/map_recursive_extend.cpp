@@ -22,6 +22,21 @@ static std::shared_ptr<RecursiveJoinSharedState> createSharedState(const NodeExp
     return std::make_shared<RecursiveJoinSharedState>(std::move(semiMasks));
 }
 
+// Sources can be batched if the path is not tracked and all input chunks are flat, so that the
+// input tuples of a batch can be restored from flat columns.
+static bool canComputeMultiSource(const LogicalRecursiveExtend& extend, const Schema& inSchema) {
+    if (extend.getRel()->getRelType() != common::QueryRelType::SHORTEST ||
+        extend.getJoinType() != RecursiveJoinType::TRACK_NONE) {
+        return false;
+    }
+    for (auto& expression : inSchema.getExpressionsInScope()) {
+        if (!inSchema.getGroup(inSchema.getGroupPos(*expression))->isFlat()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator* logicalOperator) {
     auto extend = logicalOperator->constPtrCast<LogicalRecursiveExtend>();
     auto boundNode = extend->getBoundNode();
@@ -32,6 +47,13 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator
     auto logicalRecursiveRoot = extend->getRecursiveChild();
     auto recursiveRoot = mapOperator(logicalRecursiveRoot.get());
     auto recursivePlanSchema = logicalRecursiveRoot->getSchema();
+    // The backward recursive plan is only needed if the path is not tracked.
+    auto logicalBwdRecursiveRoot = extend->getBwdRecursiveChild();
+    std::unique_ptr<PhysicalOperator> bwdRecursiveRoot;
+    if (logicalBwdRecursiveRoot != nullptr &&
+        extend->getJoinType() == RecursiveJoinType::TRACK_NONE) {
+        bwdRecursiveRoot = mapOperator(logicalBwdRecursiveRoot.get());
+    }
     // Generate RecursiveJoin
     auto outSchema = extend->getSchema();
     auto inSchema = extend->getChild(0)->getSchema();
@@ -56,6 +78,15 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator
         dataInfo.recursiveEdgeDirectionPos =
             getDataPos(*recursiveInfo->rel->getDirectionExpr(), *recursivePlanSchema);
     }
+    if (bwdRecursiveRoot != nullptr) {
+        auto bwdRecursivePlanSchema = logicalBwdRecursiveRoot->getSchema();
+        dataInfo.bwdLocalResultSetDescriptor =
+            std::make_unique<ResultSetDescriptor>(bwdRecursivePlanSchema);
+        dataInfo.bwdRecursiveNodePredicateExecFlagPos =
+            getDataPos(*recursiveInfo->nodePredicateExecFlag, *bwdRecursivePlanSchema);
+        dataInfo.bwdRecursiveDstNodeIDPos =
+            getDataPos(*recursiveInfo->nodeCopy->getInternalID(), *bwdRecursivePlanSchema);
+    }
     if (extend->getJoinType() == RecursiveJoinType::TRACK_PATH) {
         dataInfo.pathPos = getDataPos(*rel, *outSchema);
     } else {
@@ -64,6 +95,16 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator
     for (auto& entry : clientContext->getCatalog()->getTableEntries(clientContext->getTx())) {
         dataInfo.tableIDToName.insert({entry->getTableID(), entry->getName()});
     }
+    auto multiSource = canComputeMultiSource(*extend, *inSchema);
+    if (multiSource) {
+        for (auto& expression : inSchema->getExpressionsInScope()) {
+            auto pos = getDataPos(*expression, *inSchema);
+            auto numBytes = common::LogicalTypeUtils::getRowLayoutSize(expression->dataType);
+            dataInfo.srcPayloadsTableSchema.appendColumn(
+                ColumnSchema(false /* isUnFlat */, pos.dataChunkPos, numBytes));
+            dataInfo.srcPayloadsPos.push_back(pos);
+        }
+    }
     // Info
     auto info = RecursiveJoinInfo();
     info.dataInfo = std::move(dataInfo);
@@ -73,10 +114,12 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(LogicalOperator
     info.joinType = extend->getJoinType();
     info.direction = extend->getDirection();
     info.extendFromSource = extend->extendFromSourceNode();
+    info.multiSource = multiSource;
     auto prevOperator = mapOperator(logicalOperator->getChild(0).get());
     auto printInfo = std::make_unique<OPPrintInfo>();
     return std::make_unique<RecursiveJoin>(std::move(info), sharedState, std::move(prevOperator),
-        getOperatorID(), std::move(recursiveRoot), std::move(printInfo));
+        getOperatorID(), std::move(recursiveRoot), std::move(bwdRecursiveRoot),
+        std::move(printInfo));
 }
 
 } // namespace processor
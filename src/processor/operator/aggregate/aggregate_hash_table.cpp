@@ -60,6 +60,57 @@ bool AggregateHashTable::isAggregateValueDistinctForGroupByKeys(
 }
 
 void AggregateHashTable::merge(AggregateHashTable& other) {
+    mergeEntries(other, other.getNumEntries(), [&](uint64_t idx) { return other.getEntry(idx); });
+}
+
+void AggregateHashTable::merge(AggregateHashTable& other, std::span<uint8_t* const> entries) {
+    mergeEntries(other, entries.size(), [&](uint64_t idx) { return entries[idx]; });
+}
+
+std::unique_ptr<AggregateHashTable> AggregateHashTable::createEmptyCopy(
+    MemoryManager& tableMemoryManager, uint64_t numEntriesToAllocate) const {
+    for (auto& aggregateFunction : aggregateFunctions) {
+        KU_ASSERT(!aggregateFunction->isDistinct);
+        KU_UNUSED(aggregateFunction);
+    }
+    return std::make_unique<AggregateHashTable>(tableMemoryManager, LogicalType::copy(keyTypes),
+        LogicalType::copy(payloadTypes), aggregateFunctions,
+        std::vector<LogicalType>(aggregateFunctions.size()) /* no distinct agg keys */,
+        numEntriesToAllocate, factorizedTable->getTableSchema()->copy());
+}
+
+std::vector<std::vector<uint8_t*>> AggregateHashTable::partitionEntries(
+    uint64_t numPartitionsLog2) const {
+    std::vector<std::vector<uint8_t*>> partitions((uint64_t)1 << numPartitionsLog2);
+    const auto numBytesPerTuple = factorizedTable->getTableSchema()->getNumBytesPerTuple();
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        uint8_t* tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            auto hash = *(hash_t*)(tuple + hashColOffsetInFT);
+            partitions[hash >> (64 - numPartitionsLog2)].push_back(tuple);
+            tuple += numBytesPerTuple;
+        }
+    }
+    return partitions;
+}
+
+void AggregateHashTable::pin() {
+    factorizedTable->pin();
+    for (auto& block : hashSlotsBlocks) {
+        block->pin();
+    }
+}
+
+void AggregateHashTable::unpin() {
+    factorizedTable->unpin();
+    for (auto& block : hashSlotsBlocks) {
+        block->unpin();
+    }
+}
+
+template<typename FUNC>
+void AggregateHashTable::mergeEntries(AggregateHashTable& other, uint64_t numEntries,
+    FUNC getOtherEntry) {
     std::shared_ptr<DataChunkState> vectorsToScanState = std::make_shared<DataChunkState>();
     std::vector<ValueVector*> vectorsToScan(keyTypes.size() + payloadTypes.size());
     std::vector<ValueVector*> groupByHashVectors(keyTypes.size());
@@ -88,11 +139,16 @@ void AggregateHashTable::merge(AggregateHashTable& other) {
     iota(colIdxesToScan.begin(), colIdxesToScan.end(), 0);
     // Note: we store hash values at the last column of factorizedTable.
     colIdxesToScan.push_back(factorizedTable->getTableSchema()->getNumColumns() - 1);
+    auto otherEntries = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
     uint64_t startTupleIdx = 0;
-    while (startTupleIdx < other.factorizedTable->getNumTuples()) {
-        auto numTuplesToScan = std::min(other.factorizedTable->getNumTuples() - startTupleIdx,
-            DEFAULT_VECTOR_CAPACITY);
-        other.factorizedTable->scan(vectorsToScan, startTupleIdx, numTuplesToScan, colIdxesToScan);
+    while (startTupleIdx < numEntries) {
+        auto numTuplesToScan = std::min(numEntries - startTupleIdx, DEFAULT_VECTOR_CAPACITY);
+        resizeHashTableIfNecessary(numTuplesToScan);
+        for (auto i = 0u; i < numTuplesToScan; i++) {
+            otherEntries[i] = getOtherEntry(startTupleIdx + i);
+        }
+        other.factorizedTable->lookup(vectorsToScan, colIdxesToScan, otherEntries.get(),
+            0 /* startPos */, numTuplesToScan);
         findHashSlots(std::vector<ValueVector*>(), groupByHashVectors, groupByNonHashVectors,
             vectorsToScanState.get());
         auto aggregateStateOffset = aggStateColOffsetInFT;
@@ -100,8 +156,7 @@ void AggregateHashTable::merge(AggregateHashTable& other) {
             for (auto i = 0u; i < numTuplesToScan; i++) {
                 aggregateFunction->combineState(hashSlotsToUpdateAggState[i]->entry +
                                                     aggregateStateOffset,
-                    other.factorizedTable->getTuple(startTupleIdx + i) + aggregateStateOffset,
-                    &memoryManager);
+                    otherEntries[i] + aggregateStateOffset, &memoryManager);
             }
             aggregateStateOffset += aggregateFunction->getAggregateStateSize();
         }
@@ -1,7 +1,13 @@
 #include "processor/operator/aggregate/hash_aggregate.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/exception/buffer_manager.h"
+#include "common/string_format.h"
+#include "common/task_system/parallel_for.h"
 #include "common/utils.h"
+#include "function/aggregate/count.h"
+#include "function/aggregate/count_star.h"
+#include "main/client_context.h"
 
 using namespace kuzu::common;
 using namespace kuzu::function;
@@ -25,38 +31,261 @@ void HashAggregateSharedState::appendAggregateHashTable(
     localAggregateHashTables.push_back(std::move(aggregateHashTable));
 }
 
-void HashAggregateSharedState::combineAggregateHashTable(MemoryManager& /*memoryManager*/) {
+bool HashAggregateSharedState::canSpill(
+    const std::vector<std::unique_ptr<AggregateFunction>>& aggregateFunctions) {
+    for (auto& function : aggregateFunctions) {
+        if (function->isFunctionDistinct()) {
+            return false;
+        }
+        const auto& name = function->name;
+        if (name == CountStarFunction::name || name == CountFunction::name ||
+            name == AggregateSumFunction::name || name == AggregateAvgFunction::name) {
+            continue;
+        }
+        if ((name == AggregateMinFunction::name || name == AggregateMaxFunction::name) &&
+            LogicalType::getPhysicalType(function->parameterTypeIDs[0]) != PhysicalTypeID::STRING) {
+            continue;
+        }
+        return false;
+    }
+    return true;
+}
+
+void HashAggregateSharedState::addMemoryUsage(uint64_t numBytes) {
+    if (memoryUsage.fetch_add(numBytes, std::memory_order_relaxed) + numBytes > memoryLimit) {
+        spilling.store(true, std::memory_order_relaxed);
+    }
+}
+
+void HashAggregateSharedState::spill(AggregateHashTable& aggregateHashTable,
+    SpilledPartitions<AggregateHashTable>& partitions) {
+    auto partitionEntries =
+        aggregateHashTable.partitionEntries(JoinPartitioner::NUM_PARTITIONS_LOG2);
+    for (auto partitionIdx = 0u; partitionIdx < partitionEntries.size(); partitionIdx++) {
+        if (!partitionEntries[partitionIdx].empty()) {
+            partitions.append(partitionIdx, [&](AggregateHashTable& run) {
+                run.merge(aggregateHashTable, partitionEntries[partitionIdx]);
+            });
+        }
+    }
+}
+
+void HashAggregateSharedState::mergeSpilledPartitions(
+    SpilledPartitions<AggregateHashTable>& localPartitions) {
+    std::unique_lock lck{mtx};
+    appendSpilledRunsNoLock(localPartitions);
+}
+
+void HashAggregateSharedState::appendSpilledRunsNoLock(
+    SpilledPartitions<AggregateHashTable>& localPartitions) {
+    spilledRuns.resize(JoinPartitioner::NUM_PARTITIONS);
+    for (auto partitionIdx = 0u; partitionIdx < JoinPartitioner::NUM_PARTITIONS; partitionIdx++) {
+        auto& localRuns = localPartitions.getRuns(partitionIdx);
+        auto& runs = spilledRuns[partitionIdx];
+        for (auto& run : localRuns) {
+            runs.push_back(std::move(run));
+        }
+        localRuns.clear();
+    }
+}
+
+void HashAggregateSharedState::finalizeAggregateHashTables(main::ClientContext& context) {
     std::unique_lock lck{mtx};
+    const auto numThreads = context.getClientConfig()->numThreads;
+    if (isSpilling()) {
+        mergeSpilledRuns(context, numThreads);
+        return;
+    }
+    numEntries = 0;
+    for (auto& ht : localAggregateHashTables) {
+        numEntries += ht->getNumEntries();
+    }
+    auto minNumEntriesToPartition = MIN_NUM_ENTRIES_TO_PARTITION;
+    if (context.getClientConfig()->parallelFinalizeThreshold > 0) {
+        minNumEntriesToPartition = context.getClientConfig()->parallelFinalizeThreshold;
+    }
+    // Distinct aggregates are not parallel, so there is more than one local table only if none of
+    // the aggregates is distinct.
+    if (numThreads > 1 && localAggregateHashTables.size() > 1 &&
+        numEntries >= minNumEntriesToPartition) {
+        mergePartitions(*context.getTaskScheduler(), numThreads);
+    } else {
+        mergeSerially();
+    }
+}
+
+void HashAggregateSharedState::mergeSerially() {
     if (localAggregateHashTables.size() == 1) {
-        globalAggregateHashTable = std::move(localAggregateHashTables[0]);
+        globalAggregateHashTables.push_back(std::move(localAggregateHashTables[0]));
     } else {
-        auto numEntries = 0u;
+        localAggregateHashTables[0]->resize(
+            nextPowerOfTwo((uint64_t)((double)numEntries * DEFAULT_HT_LOAD_FACTOR)));
+        globalAggregateHashTables.push_back(std::move(localAggregateHashTables[0]));
+        for (auto i = 1u; i < localAggregateHashTables.size(); i++) {
+            globalAggregateHashTables[0]->merge(*localAggregateHashTables[i]);
+        }
+    }
+    globalAggregateHashTables[0]->finalizeAggregateStates();
+}
+
+void HashAggregateSharedState::mergePartitions(TaskScheduler& taskScheduler,
+    uint64_t numThreads) {
+    // Phase 1: each thread radix partitions the entries of the local tables it grabs.
+    // partitionEntries[tableIdx][partitionIdx] holds the entries of a table in a partition.
+    std::vector<std::vector<std::vector<uint8_t*>>> partitionEntries(
+        localAggregateHashTables.size());
+    parallelFor(taskScheduler, numThreads, localAggregateHashTables.size(),
+        [&](uint64_t, uint64_t tableIdx) {
+            partitionEntries[tableIdx] =
+                localAggregateHashTables[tableIdx]->partitionEntries(NUM_PARTITIONS_LOG2);
+        });
+    // The same group can be in several local tables, so the merged table of a partition is sized
+    // for the largest number of entries a local table has in the partition, and grows from there.
+    auto& firstTable = *localAggregateHashTables[0];
+    globalAggregateHashTables.resize(NUM_PARTITIONS);
+    for (auto partitionIdx = 0u; partitionIdx < NUM_PARTITIONS; partitionIdx++) {
+        uint64_t maxNumPartitionEntries = 0;
+        for (auto& entries : partitionEntries) {
+            maxNumPartitionEntries =
+                std::max<uint64_t>(maxNumPartitionEntries, entries[partitionIdx].size());
+        }
+        globalAggregateHashTables[partitionIdx] =
+            firstTable.createEmptyCopy(firstTable.getMemoryManager(),
+                nextPowerOfTwo((uint64_t)((double)maxNumPartitionEntries * DEFAULT_HT_LOAD_FACTOR)));
+    }
+    // Phase 2: the local tables are merged one after another, and each of them is freed as soon as
+    // its entries are copied, so that the local and merged tables together don't take up much more
+    // memory than the local ones did. For each local table, threads grab partitions and merge the
+    // table's entries of the partition into the partition's hash table. Partitions share no
+    // groups, so no synchronization is needed.
+    for (auto tableIdx = 0u; tableIdx < localAggregateHashTables.size(); tableIdx++) {
+        parallelFor(taskScheduler, numThreads, NUM_PARTITIONS,
+            [&](uint64_t, uint64_t partitionIdx) {
+                globalAggregateHashTables[partitionIdx]->merge(*localAggregateHashTables[tableIdx],
+                    partitionEntries[tableIdx][partitionIdx]);
+            });
+        partitionEntries[tableIdx].clear();
+        localAggregateHashTables[tableIdx].reset();
+    }
+    localAggregateHashTables.clear();
+    parallelFor(taskScheduler, numThreads, NUM_PARTITIONS, [&](uint64_t, uint64_t partitionIdx) {
+        globalAggregateHashTables[partitionIdx]->finalizeAggregateStates();
+    });
+}
+
+void HashAggregateSharedState::mergeSpilledRuns(main::ClientContext& context,
+    uint64_t numThreads) {
+    auto spillableMemoryManager = context.getMemoryManager()->getSpillableMemoryManager();
+    KU_ASSERT(spillableMemoryManager != nullptr);
+    // Groups of threads that finished before spilling started are flushed to the spilled
+    // partitions as well, so that each partition holds all runs its groups may be in.
+    if (!localAggregateHashTables.empty()) {
+        SpilledPartitions<AggregateHashTable> partitions{[&]() {
+            return localAggregateHashTables[0]->createEmptyCopy(*spillableMemoryManager,
+                0 /* numEntriesToAllocate */);
+        }};
         for (auto& ht : localAggregateHashTables) {
-            numEntries += ht->getNumEntries();
+            spill(*ht, partitions);
         }
-        localAggregateHashTables[0]->resize(nextPowerOfTwo(numEntries));
-        globalAggregateHashTable = std::move(localAggregateHashTables[0]);
-        for (auto i = 1u; i < localAggregateHashTables.size(); i++) {
-            globalAggregateHashTable->merge(*localAggregateHashTables[i]);
+        appendSpilledRunsNoLock(partitions);
+        localAggregateHashTables.clear();
+    }
+    // Each thread grabs a partition, and merges its runs into the first one, one run at a time.
+    spilledRuns.resize(JoinPartitioner::NUM_PARTITIONS);
+    globalAggregateHashTables.resize(JoinPartitioner::NUM_PARTITIONS);
+    parallelFor(*context.getTaskScheduler(), numThreads, JoinPartitioner::NUM_PARTITIONS,
+        [&](uint64_t, uint64_t partitionIdx) {
+            auto& runs = spilledRuns[partitionIdx];
+            if (runs.empty()) {
+                return;
+            }
+            uint64_t numPartitionEntries = 0;
+            for (auto& run : runs) {
+                numPartitionEntries += run->getNumEntries();
+            }
+            auto& ht = *runs[0];
+            try {
+                ht.pin();
+                ht.resize(nextPowerOfTwo(
+                    (uint64_t)((double)numPartitionEntries * DEFAULT_HT_LOAD_FACTOR)));
+                for (auto i = 1u; i < runs.size(); i++) {
+                    runs[i]->pin();
+                    ht.merge(*runs[i]);
+                    runs[i].reset();
+                }
+            } catch (BufferManagerException& e) {
+                throw BufferManagerException(stringFormat(
+                    "The groups of a spilled hash aggregate partition don't fit in the buffer "
+                    "pool: {}",
+                    e.what()));
+            }
+            ht.finalizeAggregateStates();
+            ht.unpin();
+            globalAggregateHashTables[partitionIdx] = std::move(runs[0]);
+            runs.clear();
+        });
+    numEntries = 0;
+    for (auto& ht : globalAggregateHashTables) {
+        if (ht != nullptr) {
+            numEntries += ht->getNumEntries();
         }
     }
+    numPins.resize(globalAggregateHashTables.size(), 0);
+    spilled = true;
 }
 
-void HashAggregateSharedState::finalizeAggregateHashTable() {
+std::pair<uint64_t, uint64_t> HashAggregateSharedState::getNextRangeToRead() {
     std::unique_lock lck{mtx};
-    globalAggregateHashTable->finalizeAggregateStates();
+    auto startOffset = currentOffset;
+    auto range = getNextPartitionRangeToReadNoLock();
+    releasePartitionRangeNoLock(range);
+    return std::make_pair(startOffset, startOffset + range.endOffset - range.startOffset);
 }
 
-std::pair<uint64_t, uint64_t> HashAggregateSharedState::getNextRangeToRead() {
+HashAggregatePartitionRange HashAggregateSharedState::getNextPartitionRangeToRead() {
     std::unique_lock lck{mtx};
-    if (currentOffset >= globalAggregateHashTable->getNumEntries()) {
-        return std::make_pair(currentOffset, currentOffset);
+    return getNextPartitionRangeToReadNoLock();
+}
+
+void HashAggregateSharedState::releasePartitionRange(const HashAggregatePartitionRange& range) {
+    if (!spilled) {
+        return;
     }
-    auto startOffset = currentOffset;
-    auto range = std::min(DEFAULT_VECTOR_CAPACITY,
-        globalAggregateHashTable->getNumEntries() - currentOffset);
+    std::unique_lock lck{mtx};
+    releasePartitionRangeNoLock(range);
+}
+
+HashAggregatePartitionRange HashAggregateSharedState::getNextPartitionRangeToReadNoLock() {
+    while (currentPartitionIdx < globalAggregateHashTables.size() &&
+           (globalAggregateHashTables[currentPartitionIdx] == nullptr ||
+               currentOffsetInPartition >=
+                   globalAggregateHashTables[currentPartitionIdx]->getNumEntries())) {
+        currentPartitionIdx++;
+        currentOffsetInPartition = 0;
+    }
+    if (currentPartitionIdx >= globalAggregateHashTables.size()) {
+        return HashAggregatePartitionRange{};
+    }
+    auto ht = globalAggregateHashTables[currentPartitionIdx].get();
+    if (spilled && numPins[currentPartitionIdx]++ == 0) {
+        ht->pin();
+    }
+    auto startOffset = currentOffsetInPartition;
+    auto range = std::min(DEFAULT_VECTOR_CAPACITY, ht->getNumEntries() - startOffset);
+    currentOffsetInPartition += range;
     currentOffset += range;
-    return std::make_pair(startOffset, startOffset + range);
+    return HashAggregatePartitionRange{currentPartitionIdx, ht, startOffset, startOffset + range};
+}
+
+void HashAggregateSharedState::releasePartitionRangeNoLock(
+    const HashAggregatePartitionRange& range) {
+    if (!spilled || range.table == nullptr) {
+        return;
+    }
+    KU_ASSERT(numPins[range.partitionIdx] > 0);
+    if (--numPins[range.partitionIdx] == 0) {
+        range.table->unpin();
+    }
 }
 
 HashAggregateInfo::HashAggregateInfo(std::vector<DataPos> flatKeysPos,
@@ -116,14 +345,42 @@ void HashAggregate::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
 
 void HashAggregate::executeInternal(ExecutionContext* context) {
     while (children[0]->getNextTuple(context)) {
+        const auto memoryUsageBefore = localState.aggregateHashTable->getMemoryUsage();
         localState.append(aggInputs, resultSet->multiplicity);
+        const auto memoryUsage = localState.aggregateHashTable->getMemoryUsage();
+        if (!sharedState->isSpilling()) {
+            sharedState->addMemoryUsage(memoryUsage - memoryUsageBefore);
+        } else if (memoryUsage > sharedState->getLocalMemoryLimit()) {
+            spillLocalHashTable(context);
+        }
+    }
+    if (sharedState->isSpilling()) {
+        spillLocalHashTable(context);
+        sharedState->mergeSpilledPartitions(*localState.spilledPartitions);
+    } else {
+        sharedState->appendAggregateHashTable(std::move(localState.aggregateHashTable));
+    }
+}
+
+void HashAggregate::spillLocalHashTable(ExecutionContext* context) {
+    auto memoryManager = context->clientContext->getMemoryManager();
+    if (localState.spilledPartitions == nullptr) {
+        auto spillableMemoryManager = memoryManager->getSpillableMemoryManager();
+        KU_ASSERT(spillableMemoryManager != nullptr);
+        localState.spilledPartitions = std::make_unique<SpilledPartitions<AggregateHashTable>>(
+            [this, spillableMemoryManager]() {
+                return localState.aggregateHashTable->createEmptyCopy(*spillableMemoryManager,
+                    0 /* numEntriesToAllocate */);
+            });
     }
-    sharedState->appendAggregateHashTable(std::move(localState.aggregateHashTable));
+    auto& aggregateHashTable = *localState.aggregateHashTable;
+    HashAggregateSharedState::spill(aggregateHashTable, *localState.spilledPartitions);
+    localState.aggregateHashTable =
+        aggregateHashTable.createEmptyCopy(*memoryManager, 0 /* numEntriesToAllocate */);
 }
 
 void HashAggregate::finalize(ExecutionContext* context) {
-    sharedState->combineAggregateHashTable(*context->clientContext->getMemoryManager());
-    sharedState->finalizeAggregateHashTable();
+    sharedState->finalizeAggregateHashTables(*context->clientContext);
 }
 
 } // namespace processor
@@ -16,29 +16,32 @@ void HashAggregateScan::initLocalStateInternal(ResultSet* resultSet, ExecutionCo
 }
 
 bool HashAggregateScan::getNextTuplesInternal(ExecutionContext* /*context*/) {
-    auto [startOffset, endOffset] = sharedState->getNextRangeToRead();
-    if (startOffset >= endOffset) {
+    auto range = sharedState->getNextPartitionRangeToRead();
+    if (range.startOffset >= range.endOffset) {
         return false;
     }
-    auto numRowsToScan = endOffset - startOffset;
-    sharedState->getFactorizedTable()->scan(groupByKeyVectors, startOffset, numRowsToScan,
+    auto numRowsToScan = range.endOffset - range.startOffset;
+    auto factorizedTable = range.table->getFactorizedTable();
+    factorizedTable->scan(groupByKeyVectors, range.startOffset, numRowsToScan,
         groupByKeyVectorsColIdxes);
+    auto aggStatesOffset =
+        factorizedTable->getTableSchema()->getColOffset(groupByKeyVectors.size());
     for (auto pos = 0u; pos < numRowsToScan; ++pos) {
-        auto entry = sharedState->getRow(startOffset + pos);
-        auto offset = sharedState->getFactorizedTable()->getTableSchema()->getColOffset(
-            groupByKeyVectors.size());
+        auto entry = range.table->getEntry(range.startOffset + pos);
+        auto offset = aggStatesOffset;
         for (auto& vector : aggregateVectors) {
             auto aggState = (AggregateState*)(entry + offset);
             writeAggregateResultToVector(*vector, pos, aggState);
             offset += aggState->getStateSize();
         }
     }
+    sharedState->releasePartitionRange(range);
     metrics->numOutputTuple.increase(numRowsToScan);
     return true;
 }
 
 double HashAggregateScan::getProgress(ExecutionContext* /*context*/) const {
-    uint64_t totalNumTuples = sharedState->getFactorizedTable()->getNumTuples();
+    uint64_t totalNumTuples = sharedState->getNumEntries();
     if (totalNumTuples == 0) {
         return 0.0;
     } else if (sharedState->getCurrentOffset() == totalNumTuples) {
@@ -1,5 +1,8 @@
 #include "processor/operator/gds_call.h"
 
+#include "graph/in_mem_graph.h"
+#include "main/client_context.h"
+
 using namespace kuzu::binder;
 using namespace kuzu::graph;
 
@@ -23,6 +26,15 @@ void GDSCall::initLocalStateInternal(ResultSet*, ExecutionContext* context) {
 }
 
 void GDSCall::executeInternal(ExecutionContext* executionContext) {
+    auto clientContext = executionContext->clientContext;
+    if (clientContext->getClientConfig()->enableInMemGraph &&
+        info.gds->getNumGraphScansEstimate() >= MIN_NUM_GRAPH_SCANS_TO_PROJECT) {
+        // Projecting the graph costs about as much as scanning it, so it only pays off for
+        // algorithms that scan the graph many times, e.g., once per iteration. Backward adjLists
+        // are only projected once the algorithm pulls.
+        sharedState->graph = InMemGraph::project(clientContext, *sharedState->graph,
+            std::nullopt /* edgePropertyName */, false /* projectBwd */);
+    }
     info.gds->exec(executionContext);
 }
 
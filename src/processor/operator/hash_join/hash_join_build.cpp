@@ -1,6 +1,7 @@
 #include "processor/operator/hash_join/hash_join_build.h"
 
 #include "binder/expression/expression_util.h"
+#include "main/client_context.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -23,8 +24,86 @@ void HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
     hashTable->merge(localHashTable);
 }
 
+void HashJoinSharedState::addMemoryUsage(uint64_t numBytes) {
+    if (memoryUsage.fetch_add(numBytes, std::memory_order_relaxed) + numBytes > memoryLimit) {
+        spilling.store(true, std::memory_order_relaxed);
+    }
+}
+
+void HashJoinSharedState::mergeSpilledPartitions(
+    SpilledPartitions<JoinHashTable>& localPartitions) {
+    std::unique_lock lck(mtx);
+    spilledPartitions.resize(JoinPartitioner::NUM_PARTITIONS);
+    for (auto partitionIdx = 0u; partitionIdx < JoinPartitioner::NUM_PARTITIONS; partitionIdx++) {
+        auto& localRuns = localPartitions.getRuns(partitionIdx);
+        auto& runs = spilledPartitions[partitionIdx].runs;
+        for (auto& run : localRuns) {
+            runs.push_back(std::move(run));
+        }
+        localRuns.clear();
+    }
+}
+
+JoinHashTable* HashJoinSharedState::acquireSpilledPartition(uint64_t partitionIdx) {
+    std::unique_lock lck(mtx);
+    if (spilledPartitions.empty() || spilledPartitions[partitionIdx].runs.empty()) {
+        // All build side tuples have been moved into the spilled partitions, so the in-memory hash
+        // table is empty.
+        return hashTable.get();
+    }
+    auto& partition = spilledPartitions[partitionIdx];
+    auto& partitionTable = *partition.runs[0];
+    if (!partition.built) {
+        partitionTable.pin();
+        for (auto i = 1u; i < partition.runs.size(); i++) {
+            partition.runs[i]->pin();
+            partitionTable.merge(*partition.runs[i]);
+        }
+        partition.runs.resize(1);
+        partitionTable.allocateHashSlots(partitionTable.getNumTuples());
+        partitionTable.buildHashSlots();
+        partition.built = true;
+    } else if (partition.numPins == 0) {
+        partitionTable.pin();
+    }
+    partition.numPins++;
+    return &partitionTable;
+}
+
+void HashJoinSharedState::releaseSpilledPartition(uint64_t partitionIdx) {
+    std::unique_lock lck(mtx);
+    if (spilledPartitions.empty() || spilledPartitions[partitionIdx].runs.empty()) {
+        return;
+    }
+    auto& partition = spilledPartitions[partitionIdx];
+    KU_ASSERT(partition.numPins > 0);
+    if (--partition.numPins == 0) {
+        partition.runs[0]->unpin();
+    }
+}
+
+uint64_t HashJoinSharedState::getNumSpilledTuples() const {
+    uint64_t numTuples = 0;
+    for (auto& partition : spilledPartitions) {
+        for (auto& run : partition.runs) {
+            numTuples += run->getNumTuples();
+        }
+    }
+    return numTuples;
+}
+
+void HashJoinSharedState::scanSpilledRuns(const std::function<void(JoinHashTable&)>& func) {
+    for (auto& partition : spilledPartitions) {
+        for (auto& run : partition.runs) {
+            run->pin();
+            func(*run);
+            run->unpin();
+        }
+    }
+}
+
 void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
-    std::vector<LogicalType> keyTypes;
+    keyTypes.clear();
     for (auto i = 0u; i < info->keysPos.size(); ++i) {
         auto vector = resultSet->getValueVector(info->keysPos[i]).get();
         keyTypes.push_back(vector->dataType.copy());
@@ -40,7 +119,7 @@ void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
         payloadVectors.push_back(resultSet->getValueVector(pos).get());
     }
     hashTable = std::make_unique<JoinHashTable>(*context->clientContext->getMemoryManager(),
-        std::move(keyTypes), info->tableSchema.copy());
+        LogicalType::copy(keyTypes), info->tableSchema.copy());
 }
 
 void HashJoinBuild::setKeyState(common::DataChunkState* state) {
@@ -51,21 +130,108 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
     }
 }
 
-void HashJoinBuild::finalize(ExecutionContext* /*context*/) {
+void HashJoinBuild::finalize(ExecutionContext* context) {
+    if (sharedState->isSpilling()) {
+        finalizeSpilledPartitions(context);
+        return;
+    }
     auto numTuples = sharedState->getHashTable()->getNumTuples();
     sharedState->getHashTable()->allocateHashSlots(numTuples);
-    sharedState->getHashTable()->buildHashSlots();
+    sharedState->getHashTable()->buildHashSlots(context->clientContext);
+    if (const auto runtimeFilter = sharedState->getRuntimeFilter()) {
+        runtimeFilter->build(*sharedState->getHashTable());
+    }
+}
+
+void HashJoinBuild::finalizeSpilledPartitions(ExecutionContext* context) {
+    // Tuples appended before spilling started are in the in-memory hash table. They are read back
+    // into the key and payload vectors, and appended to the spilled partitions like any other
+    // tuple, so that each partition holds all build side tuples whose keys fall into it.
+    auto table = sharedState->getHashTable()->getFactorizedTable();
+    std::vector<ValueVector*> vectors = keyVectors;
+    vectors.insert(vectors.end(), payloadVectors.begin(), payloadVectors.end());
+    std::vector<ft_col_idx_t> colIdxes(vectors.size());
+    iota(colIdxes.begin(), colIdxes.end(), 0);
+    std::vector<DataChunkState*> states;
+    for (auto& vector : vectors) {
+        if (std::find(states.begin(), states.end(), vector->state.get()) == states.end()) {
+            states.push_back(vector->state.get());
+        }
+    }
+    // Flat columns can be read in batches only into a single unflat state.
+    auto numTuplesPerRead = 1u;
+    if (!table->hasUnflatCol() && states.size() == 1 && !states[0]->isFlat()) {
+        numTuplesPerRead = DEFAULT_VECTOR_CAPACITY;
+    }
+    for (auto tupleIdx = 0u; tupleIdx < table->getNumTuples(); tupleIdx += numTuplesPerRead) {
+        auto numTuplesToRead =
+            std::min<uint64_t>(numTuplesPerRead, table->getNumTuples() - tupleIdx);
+        for (auto& state : states) {
+            if (state->isFlat()) {
+                state->getSelVectorUnsafe().setToUnfiltered(1);
+            } else {
+                state->getSelVectorUnsafe().setToUnfiltered();
+            }
+        }
+        table->scan(vectors, tupleIdx, numTuplesToRead, colIdxes);
+        appendVectorsToSpilledPartitions(context);
+    }
+    table->clear();
+    if (spilledPartitions != nullptr) {
+        sharedState->mergeSpilledPartitions(*spilledPartitions);
+    }
+    if (const auto runtimeFilter = sharedState->getRuntimeFilter()) {
+        runtimeFilter->init(sharedState->getNumSpilledTuples());
+        sharedState->scanSpilledRuns([&](JoinHashTable& run) { runtimeFilter->insert(run); });
+    }
+}
+
+void HashJoinBuild::appendVectorsToSpilledPartitions(ExecutionContext* context) {
+    if (spilledPartitions == nullptr) {
+        auto memoryManager = context->clientContext->getMemoryManager();
+        partitioner = std::make_unique<JoinPartitioner>(memoryManager);
+        auto spillableMemoryManager = memoryManager->getSpillableMemoryManager();
+        KU_ASSERT(spillableMemoryManager != nullptr);
+        spilledPartitions = std::make_unique<SpilledPartitions<JoinHashTable>>(
+            [this, spillableMemoryManager]() {
+                return std::make_unique<JoinHashTable>(*spillableMemoryManager,
+                    LogicalType::copy(keyTypes), info->tableSchema.copy());
+            });
+    }
+    // Tuples with equal keys have equal first keys, so partitioning by the first key suffices.
+    partitioner->partition(*keyVectors[0], [&](uint64_t partitionIdx) {
+        spilledPartitions->append(partitionIdx, [&](JoinHashTable& run) {
+            run.appendVectors(keyVectors, payloadVectors, keyState);
+        });
+    });
 }
 
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
+    auto factorizedTable = hashTable->getFactorizedTable();
     // Append thread-local tuples
     while (children[0]->getNextTuple(context)) {
+        if (sharedState->isSpilling()) {
+            for (auto i = 0u; i < resultSet->multiplicity; ++i) {
+                appendVectorsToSpilledPartitions(context);
+            }
+            continue;
+        }
+        const auto numTuplesBefore = hashTable->getNumTuples();
+        const auto memoryUsageBefore = factorizedTable->getMemoryUsage();
         for (auto i = 0u; i < resultSet->multiplicity; ++i) {
             appendVectors();
         }
+        // The hash slots are only allocated once the build side finishes, with up to 4 slots per
+        // tuple (see JoinHashTable::allocateHashSlots()), so they are accounted for upfront.
+        sharedState->addMemoryUsage(factorizedTable->getMemoryUsage() - memoryUsageBefore +
+                                    (hashTable->getNumTuples() - numTuplesBefore) *
+                                        MAX_NUM_HASH_SLOTS_PER_TUPLE * sizeof(uint8_t*));
     }
     // Merge with global hash table once local tuples are all appended.
     sharedState->mergeLocalHashTable(*hashTable);
+    if (spilledPartitions != nullptr) {
+        sharedState->mergeSpilledPartitions(*spilledPartitions);
+    }
 }
 
 } // namespace processor
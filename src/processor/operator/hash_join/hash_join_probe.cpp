@@ -1,6 +1,9 @@
 #include "processor/operator/hash_join/hash_join_probe.h"
 
+#include <algorithm>
+
 #include "binder/expression/expression_util.h"
+#include "main/client_context.h"
 
 using namespace kuzu::common;
 
@@ -39,6 +42,122 @@ void HashJoinProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
         tmpHashVector = std::make_unique<ValueVector>(LogicalType::HASH(),
             context->clientContext->getMemoryManager());
     }
+    hashTable = sharedState->getHashTable();
+    for (auto i = 0u; i < probeDataInfo.probeSideDataPos.size(); i++) {
+        auto vector = resultSet->getValueVector(probeDataInfo.probeSideDataPos[i]).get();
+        probeSideVectors.push_back(vector);
+        probeSideColIdxes.push_back(i);
+    }
+}
+
+bool HashJoinProbe::getNextInput(ExecutionContext* context) {
+    if (!sharedState->isSpilling()) {
+        return children[0]->getNextTuple(context);
+    }
+    if (spilledPartitions == nullptr) {
+        spillProbeSide(context);
+    }
+    return getNextSpilledTuple();
+}
+
+void HashJoinProbe::spillProbeSide(ExecutionContext* context) {
+    auto memoryManager = context->clientContext->getMemoryManager();
+    auto spillableMemoryManager = memoryManager->getSpillableMemoryManager();
+    KU_ASSERT(spillableMemoryManager != nullptr);
+    // If all probe side vectors are in the unflat chunk of the key, the probe side tuples are
+    // spilled as flat rows and read back a vector at a time. Otherwise, the unflat vectors are
+    // spilled as unflat columns, and the tuples are read back one at a time.
+    spillFlatRows = true;
+    for (auto i = 0u; i < probeSideVectors.size(); i++) {
+        if (probeDataInfo.probeSideFStateTypes[i] != FStateType::UNFLAT ||
+            probeDataInfo.probeSideDataPos[i].dataChunkPos !=
+                probeDataInfo.keysDataPos[0].dataChunkPos) {
+            spillFlatRows = false;
+        }
+    }
+    std::vector<DataChunkState*> unflatStates;
+    for (auto i = 0u; i < probeSideVectors.size(); i++) {
+        auto& pos = probeDataInfo.probeSideDataPos[i];
+        auto vector = probeSideVectors[i];
+        if (probeDataInfo.probeSideFStateTypes[i] == FStateType::UNFLAT && !spillFlatRows) {
+            spilledTableSchema.appendColumn(ColumnSchema(true /* isUnFlat */, pos.dataChunkPos,
+                (uint32_t)sizeof(overflow_value_t)));
+        } else {
+            spilledTableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, pos.dataChunkPos,
+                LogicalTypeUtils::getRowLayoutSize(vector->dataType)));
+        }
+    }
+    partitioner = std::make_unique<JoinPartitioner>(memoryManager);
+    spilledPartitions = std::make_unique<SpilledPartitions<FactorizedTable>>(
+        [this, spillableMemoryManager]() {
+            return std::make_unique<FactorizedTable>(spillableMemoryManager,
+                spilledTableSchema.copy());
+        });
+    while (children[0]->getNextTuple(context)) {
+        if (std::any_of(probeSideVectors.begin(), probeSideVectors.end(),
+                [](auto vector) { return vector->state->getSelVector().getSelSize() == 0; })) {
+            continue;
+        }
+        for (auto i = 0u; i < resultSet->multiplicity; i++) {
+            // The build side is partitioned by the first key as well.
+            partitioner->partition(*keyVectors[0], [&](uint64_t partitionIdx_) {
+                spilledPartitions->append(partitionIdx_,
+                    [&](FactorizedTable& run) { run.append(probeSideVectors); });
+            });
+        }
+    }
+    // Duplicated tuples have been materialized multiple times.
+    resultSet->multiplicity = 1;
+}
+
+bool HashJoinProbe::getNextSpilledTuple() {
+    while (partitionIdx < JoinPartitioner::NUM_PARTITIONS) {
+        auto& runs = spilledPartitions->getRuns(partitionIdx);
+        if (runIdx < runs.size()) {
+            auto& run = *runs[runIdx];
+            if (tupleIdx == 0) {
+                if (runIdx == 0) {
+                    hashTable = sharedState->acquireSpilledPartition(partitionIdx);
+                }
+                run.pin();
+            }
+            if (tupleIdx == run.getNumTuples()) {
+                runs[runIdx].reset();
+                runIdx++;
+                tupleIdx = 0;
+                continue;
+            }
+            if (spillFlatRows) {
+                auto numTuplesToScan =
+                    std::min(DEFAULT_VECTOR_CAPACITY, run.getNumTuples() - tupleIdx);
+                auto state = keyVectors[0]->state.get();
+                state->setToUnflat();
+                state->getSelVectorUnsafe().setToUnfiltered(numTuplesToScan);
+                run.scan(probeSideVectors, tupleIdx, numTuplesToScan, probeSideColIdxes);
+                tupleIdx += numTuplesToScan;
+                return true;
+            }
+            for (auto i = 0u; i < probeSideVectors.size(); i++) {
+                auto state = probeSideVectors[i]->state.get();
+                if (probeDataInfo.probeSideFStateTypes[i] == FStateType::FLAT) {
+                    state->setToFlat();
+                    state->getSelVectorUnsafe().setToUnfiltered(1);
+                } else {
+                    state->setToUnflat();
+                    state->getSelVectorUnsafe().setToUnfiltered();
+                }
+            }
+            run.scan(probeSideVectors, tupleIdx++, 1 /* numTuplesToScan */, probeSideColIdxes);
+            return true;
+        }
+        if (!runs.empty()) {
+            sharedState->releaseSpilledPartition(partitionIdx);
+            runs.clear();
+        }
+        partitionIdx++;
+        runIdx = 0;
+    }
+    return false;
 }
 
 bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
@@ -51,15 +170,15 @@ bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
         // which changes the selected position.
         // TODO(Guodong): we have potential bugs here because all keys' states should be restored.
         restoreSelVector(*keyVectors[0]->state);
-        if (!children[0]->getNextTuple(context)) {
+        if (!getNextInput(context)) {
             return false;
         }
         saveSelVector(*keyVectors[0]->state);
-        sharedState->getHashTable()->probe(keyVectors, *hashVector, hashSelVec, *tmpHashVector,
+        hashTable->probe(keyVectors, *hashVector, hashSelVec, *tmpHashVector,
             probeState->probedTuples.get());
     }
-    auto numMatchedTuples = sharedState->getHashTable()->matchFlatKeys(keyVectors,
-        probeState->probedTuples.get(), probeState->matchedTuples.get());
+    auto numMatchedTuples = hashTable->matchFlatKeys(keyVectors, probeState->probedTuples.get(),
+        probeState->matchedTuples.get());
     probeState->matchedSelVector.setSelSize(numMatchedTuples);
     probeState->nextMatchedTupleIdx = 0;
     return true;
@@ -69,15 +188,14 @@ bool HashJoinProbe::getMatchedTuplesForUnFlatKey(ExecutionContext* context) {
     KU_ASSERT(keyVectors.size() == 1);
     auto keyVector = keyVectors[0];
     restoreSelVector(*keyVector->state);
-    if (!children[0]->getNextTuple(context)) {
+    if (!getNextInput(context)) {
         return false;
     }
     saveSelVector(*keyVector->state);
-    sharedState->getHashTable()->probe(keyVectors, *hashVector, hashSelVec, *tmpHashVector,
+    hashTable->probe(keyVectors, *hashVector, hashSelVec, *tmpHashVector,
         probeState->probedTuples.get());
-    auto numMatchedTuples =
-        sharedState->getHashTable()->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
-            probeState->matchedTuples.get(), probeState->matchedSelVector);
+    auto numMatchedTuples = hashTable->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
+        probeState->matchedTuples.get(), probeState->matchedSelVector);
     probeState->matchedSelVector.setSelSize(numMatchedTuples);
     probeState->nextMatchedTupleIdx = 0;
     return true;
@@ -88,7 +206,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForFlatKey() {
         return 0;
     }
     auto numTuplesToRead = 1;
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
@@ -108,7 +226,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForUnFlatKey() {
         }
         keySelVector.setToFiltered(numTuplesToRead);
     }
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    hashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
@@ -1,7 +1,11 @@
 #include "processor/operator/hash_join/join_hash_table.h"
 
+#include <bit>
+
+#include "common/task_system/parallel_for.h"
 #include "common/utils.h"
 #include "function/hash/vector_hash_functions.h"
+#include "main/client_context.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -105,6 +109,7 @@ void JoinHashTable::appendVectorWithSorting(ValueVector* keyVector,
 
 void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
     setMaxNumHashSlots(nextPowerOfTwo(numTuples * 2));
+    numHashSlotsLog2 = maxNumHashSlots == 0 ? 0 : std::countr_zero(maxNumHashSlots);
     auto numSlotsPerBlock = (uint64_t)1 << numSlotsPerBlockLog2;
     auto numBlocksNeeded = (maxNumHashSlots + numSlotsPerBlock - 1) / numSlotsPerBlock;
     while (hashSlotsBlocks.size() < numBlocksNeeded) {
@@ -112,17 +117,61 @@ void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
     }
 }
 
-void JoinHashTable::buildHashSlots() {
-    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
-        uint8_t* tuple = tupleBlock->getData();
-        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
-            auto lastSlotEntryInHT = insertEntry(tuple);
-            auto prevPtr = getPrevTuple(tuple);
-            memcpy(reinterpret_cast<void*>(prevPtr), reinterpret_cast<void*>(&lastSlotEntryInHT),
-                sizeof(uint8_t*));
-            tuple += factorizedTable->getTableSchema()->getNumBytesPerTuple();
+void JoinHashTable::buildHashSlots(main::ClientContext* context) {
+    auto& tupleBlocks = factorizedTable->getTupleDataBlocks();
+    const auto numBytesPerTuple = factorizedTable->getTableSchema()->getNumBytesPerTuple();
+    uint64_t numThreads = 1;
+    auto minNumTuplesToBuildInParallel = MIN_NUM_TUPLES_TO_BUILD_IN_PARALLEL;
+    if (context != nullptr) {
+        // Threads grab whole tuple blocks in the first phase.
+        numThreads = std::min<uint64_t>(context->getClientConfig()->numThreads, tupleBlocks.size());
+        if (context->getClientConfig()->parallelFinalizeThreshold > 0) {
+            minNumTuplesToBuildInParallel = context->getClientConfig()->parallelFinalizeThreshold;
+        }
+    }
+    // Partitions only own disjoint slot ranges if there are at least as many slots as partitions.
+    if (numThreads <= 1 || getNumTuples() < minNumTuplesToBuildInParallel ||
+        maxNumHashSlots < NUM_PARTITIONS) {
+        for (auto& tupleBlock : tupleBlocks) {
+            uint8_t* tuple = tupleBlock->getData();
+            for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+                insertTuple(tuple);
+                tuple += numBytesPerTuple;
+            }
         }
+        return;
+    }
+    // Phase 1: each thread radix-partitions the tuples of the blocks it grabs, chaining the tuples
+    // of each partition into a list through their prev pointer column.
+    std::vector<std::vector<uint8_t*>> partitionHeads(numThreads);
+    for (auto& heads : partitionHeads) {
+        heads.resize(NUM_PARTITIONS, nullptr);
     }
+    const auto hashColOffset = getHashValueColOffset();
+    auto& taskScheduler = *context->getTaskScheduler();
+    parallelFor(taskScheduler, numThreads, tupleBlocks.size(),
+        [&](uint64_t threadIdx, uint64_t blockIdx) {
+            auto& heads = partitionHeads[threadIdx];
+            uint8_t* tuple = tupleBlocks[blockIdx]->getData();
+            for (auto i = 0u; i < tupleBlocks[blockIdx]->numTuples; i++) {
+                auto partitionIdx = getPartitionIdx(*(hash_t*)(tuple + hashColOffset));
+                *getPrevTuple(tuple) = heads[partitionIdx];
+                heads[partitionIdx] = tuple;
+                tuple += numBytesPerTuple;
+            }
+        });
+    // Phase 2: each thread grabs a partition and inserts its tuples into the slots of the
+    // partition. These are disjoint across partitions, so no synchronization is needed.
+    parallelFor(taskScheduler, numThreads, NUM_PARTITIONS, [&](uint64_t, uint64_t partitionIdx) {
+        for (auto& heads : partitionHeads) {
+            auto tuple = heads[partitionIdx];
+            while (tuple != nullptr) {
+                auto nextTuple = *getPrevTuple(tuple);
+                insertTuple(tuple);
+                tuple = nextTuple;
+            }
+        }
+    });
 }
 
 void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVector& hashVector,
@@ -185,18 +234,31 @@ sel_t JoinHashTable::matchUnFlatKey(ValueVector* keyVector, uint8_t** probedTupl
     return numMatchedTuples;
 }
 
+void JoinHashTable::pin() {
+    factorizedTable->pin();
+    for (auto& block : hashSlotsBlocks) {
+        block->pin();
+    }
+}
+
+void JoinHashTable::unpin() {
+    factorizedTable->unpin();
+    for (auto& block : hashSlotsBlocks) {
+        block->unpin();
+    }
+}
+
 uint8_t** JoinHashTable::findHashSlot(const uint8_t* tuple) const {
     auto hash = *(hash_t*)(tuple + getHashValueColOffset());
-    auto slotIdx = getSlotIdxForHash(hash);
+    auto slotIdx = getSlotIdx(hash);
     return (uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData() +
                        (slotIdx & slotIdxInBlockMask) * sizeof(uint8_t*));
 }
 
-uint8_t* JoinHashTable::insertEntry(uint8_t* tuple) const {
+void JoinHashTable::insertTuple(uint8_t* tuple) const {
     auto slot = findHashSlot(tuple);
-    auto prevPtr = *slot;
+    *getPrevTuple(tuple) = *slot;
     *slot = tuple;
-    return prevPtr;
 }
 
 void JoinHashTable::computeVectorHashes(std::vector<common::ValueVector*> keyVectors) {
@@ -0,0 +1,127 @@
+#include "processor/operator/hash_join/runtime_join_filter.h"
+
+#include <concepts>
+#include <limits>
+
+#include "common/type_utils.h"
+#include "common/utils.h"
+#include "function/hash/vector_hash_functions.h"
+#include "processor/operator/hash_join/join_hash_table.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void RuntimeJoinFilter::build(JoinHashTable& hashTable) {
+    init(hashTable.getNumTuples());
+    insert(hashTable);
+}
+
+void RuntimeJoinFilter::init(uint64_t numTuples) {
+    const auto numWords = std::min(MAX_NUM_WORDS,
+        nextPowerOfTwo(std::max<uint64_t>(numTuples * NUM_BITS_PER_KEY / 64, 1)));
+    words.assign(numWords, 0);
+    wordIdxMask = numWords - 1;
+    hasRange = false;
+    min = std::numeric_limits<int64_t>::max();
+    max = std::numeric_limits<int64_t>::min();
+    built = true;
+}
+
+void RuntimeJoinFilter::insert(JoinHashTable& hashTable) {
+    KU_ASSERT(built);
+    const auto hashColOffset = hashTable.getHashValueColOffset();
+    const auto numBytesPerTuple = hashTable.getTableSchema()->getNumBytesPerTuple();
+    for (auto& tupleBlock : hashTable.getFactorizedTable()->getTupleDataBlocks()) {
+        const uint8_t* tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            insertHash(*(hash_t*)(tuple + hashColOffset));
+            tuple += numBytesPerTuple;
+        }
+    }
+    extendRange(hashTable);
+}
+
+void RuntimeJoinFilter::extendRange(JoinHashTable& hashTable) {
+    if (hashTable.getNumTuples() == 0) {
+        return;
+    }
+    // Keys are always stored in the first column of the hash table.
+    const auto keyColOffset = hashTable.getTableSchema()->getColOffset(0);
+    const auto numBytesPerTuple = hashTable.getTableSchema()->getNumBytesPerTuple();
+    TypeUtils::visit(
+        keyType.getPhysicalType(),
+        [&]<std::signed_integral T>(T) {
+            for (auto& tupleBlock : hashTable.getFactorizedTable()->getTupleDataBlocks()) {
+                const uint8_t* tuple = tupleBlock->getData();
+                for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+                    const int64_t key = *(T*)(tuple + keyColOffset);
+                    min = std::min(min, key);
+                    max = std::max(max, key);
+                    tuple += numBytesPerTuple;
+                }
+            }
+            hasRange = true;
+        },
+        [](auto) {});
+}
+
+void RuntimeJoinFilter::select(ValueVector& keyVector, ValueVector& hashVector) const {
+    KU_ASSERT(built);
+    auto& selVector = keyVector.state->getSelVectorUnsafe();
+    const auto numKeys = selVector.getSelSize();
+    // Hashes are written at the same positions as their keys.
+    function::VectorHashFunction::computeHash(keyVector, selVector, hashVector, selVector);
+    auto buffer = selVector.getMultableBuffer();
+    sel_t numSelectedKeys = 0;
+    for (auto i = 0u; i < numKeys; i++) {
+        const auto pos = selVector[i];
+        // Null keys never match in an inner join.
+        if (!keyVector.isNull(pos) && mayContain(hashVector.getValue<hash_t>(pos))) {
+            buffer[numSelectedKeys++] = pos;
+        }
+    }
+    if (hasRange) {
+        TypeUtils::visit(
+            keyType.getPhysicalType(),
+            [&]<std::signed_integral T>(T) {
+                sel_t numKeysInRange = 0;
+                for (auto i = 0u; i < numSelectedKeys; i++) {
+                    const auto pos = buffer[i];
+                    const int64_t key = keyVector.getValue<T>(pos);
+                    if (key >= min && key <= max) {
+                        buffer[numKeysInRange++] = pos;
+                    }
+                }
+                numSelectedKeys = numKeysInRange;
+            },
+            [](auto) { KU_UNREACHABLE; });
+    }
+    selVector.setToFiltered(numSelectedKeys);
+}
+
+void RuntimeJoinFilterApplier::init(const ResultSet& resultSet,
+    storage::MemoryManager* memoryManager) {
+    keyVector = resultSet.getValueVector(keyPos).get();
+    hashVector = std::make_unique<ValueVector>(LogicalType::HASH(), memoryManager);
+}
+
+sel_t RuntimeJoinFilterApplier::apply() {
+    auto& selVector = keyVector->state->getSelVector();
+    if (!enabled) {
+        return selVector.getSelSize();
+    }
+    numInputTuples += selVector.getSelSize();
+    filter->select(*keyVector, *hashVector);
+    numOutputTuples += selVector.getSelSize();
+    if (numInputTuples >= MIN_NUM_TUPLES_TO_SAMPLE &&
+        (double)numOutputTuples > MAX_SELECTIVITY * (double)numInputTuples) {
+        // Most tuples pass the filter, so it is not worth paying for hashing the keys twice.
+        enabled = false;
+    }
+    return selVector.getSelSize();
+}
+
+} // namespace processor
+} // namespace kuzu
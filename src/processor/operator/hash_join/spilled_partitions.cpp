@@ -0,0 +1,62 @@
+#include "processor/operator/hash_join/spilled_partitions.h"
+
+#include "function/hash/vector_hash_functions.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+JoinPartitioner::JoinPartitioner(storage::MemoryManager* memoryManager)
+    : partitionIdxes(DEFAULT_VECTOR_CAPACITY), partitionOffsets(NUM_PARTITIONS + 1),
+      sortedPositions(DEFAULT_VECTOR_CAPACITY) {
+    hashVector = std::make_unique<ValueVector>(LogicalType::HASH(), memoryManager);
+    partitionSelVector = std::make_shared<SelectionVector>(DEFAULT_VECTOR_CAPACITY);
+}
+
+void JoinPartitioner::partition(ValueVector& keyVector, const std::function<void(uint64_t)>& func) {
+    auto state = keyVector.state;
+    auto& selVector = state->getSelVector();
+    const auto numTuples = selVector.getSelSize();
+    if (numTuples == 0) {
+        return;
+    }
+    // Hashes are written at the same positions as their keys.
+    function::VectorHashFunction::computeHash(keyVector, selVector, *hashVector, selVector);
+    if (state->isFlat()) {
+        func(getPartitionIdx(hashVector->getValue<hash_t>(selVector[0])));
+        return;
+    }
+    // Counting sort of the selected positions by partition.
+    std::fill(partitionOffsets.begin(), partitionOffsets.end(), 0);
+    for (auto i = 0u; i < numTuples; i++) {
+        partitionIdxes[i] = getPartitionIdx(hashVector->getValue<hash_t>(selVector[i]));
+        partitionOffsets[partitionIdxes[i] + 1]++;
+    }
+    for (auto partitionIdx = 0u; partitionIdx < NUM_PARTITIONS; partitionIdx++) {
+        partitionOffsets[partitionIdx + 1] += partitionOffsets[partitionIdx];
+    }
+    for (auto i = 0u; i < numTuples; i++) {
+        // Offsets are shifted by one partition until all positions are placed.
+        sortedPositions[partitionOffsets[partitionIdxes[i]]++] = selVector[i];
+    }
+    auto originalSelVector = state->getSelVectorShared();
+    state->setSelVector(partitionSelVector);
+    sel_t startOffset = 0;
+    for (auto partitionIdx = 0u; partitionIdx < NUM_PARTITIONS; partitionIdx++) {
+        const auto endOffset = partitionOffsets[partitionIdx];
+        if (endOffset == startOffset) {
+            continue;
+        }
+        auto buffer = partitionSelVector->getMultableBuffer();
+        std::copy(sortedPositions.begin() + startOffset, sortedPositions.begin() + endOffset,
+            buffer.begin());
+        partitionSelVector->setToFiltered(endOffset - startOffset);
+        func(partitionIdx);
+        startOffset = endOffset;
+    }
+    state->setSelVector(std::move(originalSelVector));
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -70,30 +70,14 @@ void IndexLookup::checkNullKeys(ValueVector* keyVector) {
     }
 }
 
-void stringPKFillOffsetArraysFromVector(transaction::Transaction* transaction,
-    const IndexLookupInfo& info, ValueVector* keyVector, offset_t* offsets) {
-    auto numKeys = keyVector->state->getSelVector().getSelSize();
-    for (auto i = 0u; i < numKeys; i++) {
-        if (!info.nodeTable->lookupPK(transaction, keyVector, keyVector->state->getSelVector()[i],
-                offsets[i])) {
-            auto key = keyVector->getValue<ku_string_t>(keyVector->state->getSelVector()[i]);
-            throw RuntimeException(ExceptionMessage::nonExistentPKException(key.getAsString()));
-        }
-    }
-}
-
-template<HashablePrimitive T>
-void primitivePKFillOffsetArraysFromVector(transaction::Transaction* transaction,
-    const IndexLookupInfo& info, ValueVector* keyVector, offset_t* offsets) {
-    auto numKeys = keyVector->state->getSelVector().getSelSize();
-    for (auto i = 0u; i < numKeys; i++) {
-        auto pos = keyVector->state->getSelVector()[i];
-        if (!info.nodeTable->lookupPK(transaction, keyVector, pos, offsets[i])) {
-            auto key = keyVector->getValue<T>(pos);
-            throw RuntimeException(
-                ExceptionMessage::nonExistentPKException(TypeUtils::toString(key)));
-        }
-    }
+static void throwNonExistentPKException(const ValueVector* keyVector, sel_t pos) {
+    std::string key;
+    TypeUtils::visit(
+        keyVector->dataType.getPhysicalType(),
+        [&](ku_string_t) { key = keyVector->getValue<ku_string_t>(pos).getAsString(); },
+        [&]<HashablePrimitive T>(T) { key = TypeUtils::toString(keyVector->getValue<T>(pos)); },
+        [&](auto) { KU_UNREACHABLE; });
+    throw RuntimeException(ExceptionMessage::nonExistentPKException(key));
 }
 
 // TODO(Guodong): Add short path for unfiltered case.
@@ -101,14 +85,13 @@ void IndexLookup::fillOffsetArraysFromVector(transaction::Transaction* transacti
     const IndexLookupInfo& info, ValueVector* keyVector, ValueVector* resultVector) {
     KU_ASSERT(resultVector->dataType.getPhysicalType() == PhysicalTypeID::INT64);
     auto offsets = (offset_t*)resultVector->getData();
-    TypeUtils::visit(
-        keyVector->dataType.getPhysicalType(),
-        [&](ku_string_t) {
-            stringPKFillOffsetArraysFromVector(transaction, info, keyVector, offsets);
-        },
-        [&]<HashablePrimitive T>(
-            T) { primitivePKFillOffsetArraysFromVector<T>(transaction, info, keyVector, offsets); },
-        [&](auto) { KU_UNREACHABLE; });
+    info.nodeTable->lookupPKs(transaction, *keyVector, offsets);
+    const auto& selVector = keyVector->state->getSelVector();
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        if (offsets[i] == INVALID_OFFSET) {
+            throwNonExistentPKException(keyVector, selVector[i]);
+        }
+    }
 }
 
 } // namespace processor
@@ -35,7 +35,7 @@ void NodeBatchInsertSharedState::initPKIndex(const ExecutionContext* context) {
         numRows = scanSharedState->getNumRows();
     } else {
         KU_ASSERT(distinctSharedState);
-        numRows = distinctSharedState->getFactorizedTable()->getNumTuples();
+        numRows = distinctSharedState->getNumEntries();
     }
     auto* nodeTable = ku_dynamic_cast<Table*, NodeTable*>(table);
     nodeTable->getPKIndex()->bulkReserve(numRows);
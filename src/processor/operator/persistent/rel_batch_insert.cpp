@@ -65,6 +65,21 @@ void RelBatchInsert::executeInternal(ExecutionContext* context) {
     }
 }
 
+// Maps the columns of the partitioned rels to the rel table columns they are copied into, skipping
+// the bound node offset column. Only property columns are mapped.
+static std::vector<column_id_t> getStatsColumnIDs(const RelBatchInsertInfo& relInfo,
+    column_id_t numColumns) {
+    std::vector<column_id_t> columnIDs;
+    for (auto i = 0u; i < numColumns; i++) {
+        const auto columnID = i > relInfo.boundNodeOffsetColumnID ? i - 1 : i;
+        columnIDs.push_back(
+            i == relInfo.boundNodeOffsetColumnID || columnID <= REL_ID_COLUMN_ID ?
+                INVALID_COLUMN_ID :
+                columnID);
+    }
+    return columnIDs;
+}
+
 void RelBatchInsert::appendNodeGroup(transaction::Transaction* transaction, CSRNodeGroup& nodeGroup,
     const RelBatchInsertInfo& relInfo, const RelBatchInsertLocalState& localState,
     BatchInsertSharedState& sharedState, const PartitionerSharedState& partitionerSharedState) {
@@ -89,6 +104,17 @@ void RelBatchInsert::appendNodeGroup(transaction::Transaction* transaction, CSRN
         leaveGaps);
     const auto& csrHeader = localState.chunkedGroup->cast<ChunkedCSRNodeGroup>().getCSRHeader();
     const auto maxSize = csrHeader.getEndCSROffset(numNodes - 1);
+    // Properties are copied into both directions, so their stats are only collected once.
+    TableStats stats;
+    stats.setDegreeHistogram(relInfo.direction,
+        TableStats::computeDegreeHistogram(csrHeader.length->getData(), numNodes));
+    if (relInfo.direction == RelDataDirection::FWD) {
+        for (auto& chunkedGroup : partitioningBuffer.getChunkedGroups()) {
+            stats.update(getStatsColumnIDs(relInfo, chunkedGroup->getNumColumns()), *chunkedGroup,
+                0 /* startRow */, chunkedGroup->getNumRows());
+        }
+    }
+    sharedState.table->mergeStats(transaction, stats);
     for (auto& chunkedGroup : partitioningBuffer.getChunkedGroups()) {
         sharedState.incrementNumRows(chunkedGroup->getNumRows());
         localState.chunkedGroup->write(*chunkedGroup, relInfo.boundNodeOffsetColumnID);
@@ -1,26 +1,81 @@
 #include "processor/operator/recursive_extend/frontier.h"
 
+#include <algorithm>
+#include <numeric>
+
 using namespace kuzu::common;
 
 namespace kuzu {
 namespace processor {
 
-void Frontier::addEdge(nodeID_t boundNodeID, nodeID_t nbrNodeID, nodeID_t relID) {
-    if (!bwdEdges.contains(nbrNodeID)) {
+void Frontier::addSrcNode(nodeID_t nodeID) {
+    KU_ASSERT(nodeIDs.empty());
+    nodeIDs.push_back(nodeID);
+    multiplicities.push_back(1);
+}
+
+void Frontier::addEdge(nodeID_t boundNodeID, nodeID_t nbrNodeID, nodeID_t relID,
+    node_idx_map_t& nodeIdxes) {
+    auto& nodeIdx = nodeIdxes.getOrInsert(nbrNodeID);
+    if (nodeIdx == 0) {
         nodeIDs.push_back(nbrNodeID);
-        bwdEdges.insert({nbrNodeID, std::vector<node_rel_id_t>{}});
+        bwdEdges.emplace_back();
+        nodeIdx = nodeIDs.size();
     }
-    bwdEdges.at(nbrNodeID).emplace_back(boundNodeID, relID);
+    bwdEdges[nodeIdx - 1].emplace_back(boundNodeID, relID);
 }
 
-void Frontier::addNodeWithMultiplicity(nodeID_t nodeID, uint64_t multiplicity) {
-    if (nodeIDToMultiplicity.contains(nodeID)) {
-        nodeIDToMultiplicity.at(nodeID) += multiplicity;
-    } else {
-        nodeIDToMultiplicity.insert({nodeID, multiplicity});
+void Frontier::addNodeWithMultiplicity(nodeID_t nodeID, uint64_t multiplicity,
+    node_idx_map_t& nodeIdxes) {
+    auto& nodeIdx = nodeIdxes.getOrInsert(nodeID);
+    if (nodeIdx == 0) {
         nodeIDs.push_back(nodeID);
+        multiplicities.push_back(multiplicity);
+        nodeIdx = nodeIDs.size();
+    } else {
+        multiplicities[nodeIdx - 1] += multiplicity;
     }
 }
 
+void Frontier::clearNodeIdxes(node_idx_map_t& nodeIdxes) const {
+    for (auto& nodeID : nodeIDs) {
+        nodeIdxes.erase(nodeID);
+    }
+}
+
+template<typename T>
+static void permute(std::vector<T>& values, const std::vector<idx_t>& order) {
+    if (values.empty()) {
+        return;
+    }
+    std::vector<T> result;
+    result.reserve(values.size());
+    for (auto idx : order) {
+        result.push_back(std::move(values[idx]));
+    }
+    values = std::move(result);
+}
+
+void Frontier::sortNodes() {
+    if (bwdEdges.empty() && multiplicities.empty()) {
+        std::sort(nodeIDs.begin(), nodeIDs.end());
+        return;
+    }
+    std::vector<idx_t> order(nodeIDs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+        [&](idx_t left, idx_t right) { return nodeIDs[left] < nodeIDs[right]; });
+    permute(nodeIDs, order);
+    permute(bwdEdges, order);
+    permute(multiplicities, order);
+}
+
+const std::vector<node_rel_id_t>& Frontier::getBwdEdges(nodeID_t nodeID) const {
+    KU_ASSERT(std::is_sorted(nodeIDs.begin(), nodeIDs.end()));
+    auto iter = std::lower_bound(nodeIDs.begin(), nodeIDs.end(), nodeID);
+    KU_ASSERT(iter != nodeIDs.end() && *iter == nodeID);
+    return bwdEdges[iter - nodeIDs.begin()];
+}
+
 } // namespace processor
 } // namespace kuzu
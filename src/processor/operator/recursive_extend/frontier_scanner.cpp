@@ -96,7 +96,7 @@ void PathScanner::scanFromDstOffset(RecursiveJoinVectors& vectors, sel_t& vector
             }
             // Push new stack.
             cursorStack.push(-1);
-            nbrsStack.push(&frontiers[level]->bwdEdges.at(nbr.first));
+            nbrsStack.push(&frontiers[level]->getBwdEdges(nbr.first));
             level--;
         } else { // Failed to find a nbr. Pop stack.
             cursorStack.pop();
@@ -106,20 +106,27 @@ void PathScanner::scanFromDstOffset(RecursiveJoinVectors& vectors, sel_t& vector
     }
 }
 
-void PathScanner::initDfs(const node_rel_id_t& nodeAndRelID, size_t currentDepth) {
-    nodeIDs[currentDepth] = nodeAndRelID.first;
-    relIDs[currentDepth] = nodeAndRelID.second;
+void PathScanner::initScanFromDstOffset() {
+    nodeIDs[k] = currentDstNodeID;
+    relIDs[k] = relID_t{INVALID_OFFSET, INVALID_TABLE_ID};
     if (k == 0) {
         return;
     }
-    if (currentDepth == 0) {
+    // The last frontier may not be sorted, so its bwd edges are looked up by position.
+    initDfs(&frontiers[k]->bwdEdges[lastFrontierCursor - 1], k);
+}
+
+void PathScanner::initDfs(nbrs_t nbrs, size_t currentDepth) {
+    nbrsStack.push(nbrs);
+    cursorStack.push(0);
+    auto& [nbrNodeID, relID] = nbrs->at(0);
+    nodeIDs[currentDepth - 1] = nbrNodeID;
+    relIDs[currentDepth - 1] = relID;
+    if (currentDepth == 1) {
         cursorStack.top() = -1;
         return;
     }
-    auto nbrs = &frontiers[currentDepth]->bwdEdges.at(nodeAndRelID.first);
-    nbrsStack.push(nbrs);
-    cursorStack.push(0);
-    initDfs(nbrs->at(0), currentDepth - 1);
+    initDfs(&frontiers[currentDepth - 1]->getBwdEdges(nbrNodeID), currentDepth - 1);
 }
 
 void PathScanner::writePathNode(idx_t idx, RecursiveJoinVectors& vectors, sel_t vectorPos) {
@@ -235,7 +242,6 @@ void PathScanner::writePathToVector(RecursiveJoinVectors& vectors, sel_t& vector
 
 void DstNodeWithMultiplicityScanner::scanFromDstOffset(RecursiveJoinVectors& vectors,
     sel_t& vectorPos, sel_t&, sel_t&) {
-    auto& multiplicity = frontiers[k]->nodeIDToMultiplicity.at(currentDstNodeID);
     while (multiplicity > 0 && vectorPos < DEFAULT_VECTOR_CAPACITY) {
         writeDstNodeOffsetAndLength(vectors.dstNodeIDVector, vectors.pathLengthVector, vectorPos);
         vectorPos++;
@@ -4,6 +4,8 @@
 #include "processor/operator/recursive_extend/shortest_path_state.h"
 #include "processor/operator/recursive_extend/variable_length_state.h"
 #include "processor/operator/scan/offset_scan_node_table.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
 
 using namespace kuzu::common;
 using namespace kuzu::planner;
@@ -32,6 +34,15 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
     auto joinType = info.joinType;
     auto lowerBound = info.lowerBound;
     auto upperBound = info.upperBound;
+    // Sizes of the node tables that can be visited, to move BFS states into dense arrays once
+    // they hold many nodes of a table.
+    DenseNodeMapInfo denseNodeMapInfo;
+    denseNodeMapInfo.memoryManager = context->clientContext->getMemoryManager();
+    for (auto tableID : dataInfo.recursiveDstNodeTableIDs) {
+        auto table = context->clientContext->getStorageManager()->getTable(tableID);
+        denseNodeMapInfo.numNodesPerTable.insert(
+            {tableID, table->ptrCast<storage::NodeTable>()->getNumRows()});
+    }
     switch (info.queryRelType) {
     case QueryRelType::VARIABLE_LENGTH: {
         switch (info.joinType) {
@@ -48,7 +59,7 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
             }
             vectors->pathVector = resultSet->getValueVector(dataInfo.pathPos).get();
             bfsState = std::make_unique<VariableLengthState<true /* TRACK_PATH */>>(upperBound,
-                targetDstNodes.get());
+                targetDstNodes.get(), denseNodeMapInfo);
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(std::make_unique<PathScanner>(targetDstNodes.get(), i,
                     dataInfo.tableIDToName, semanticCheck, info.direction, info.extendFromSource));
@@ -60,7 +71,7 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
                                        "implemented. Try WALK semantic.");
             }
             bfsState = std::make_unique<VariableLengthState<false /* TRACK_PATH */>>(upperBound,
-                targetDstNodes.get());
+                targetDstNodes.get(), denseNodeMapInfo);
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(
                     std::make_unique<DstNodeWithMultiplicityScanner>(targetDstNodes.get(), i));
@@ -79,15 +90,28 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
         case planner::RecursiveJoinType::TRACK_PATH: {
             vectors->pathVector = resultSet->getValueVector(dataInfo.pathPos).get();
             bfsState = std::make_unique<ShortestPathState<true /* TRACK_PATH */>>(upperBound,
-                targetDstNodes.get());
+                targetDstNodes.get(), denseNodeMapInfo);
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(std::make_unique<PathScanner>(targetDstNodes.get(), i,
                     dataInfo.tableIDToName, nullptr, info.direction, info.extendFromSource));
             }
         } break;
         case planner::RecursiveJoinType::TRACK_NONE: {
+            if (info.multiSource) {
+                msBFSState = std::make_unique<MultiSourceShortestPathState>(lowerBound,
+                    upperBound, targetDstNodes.get(), denseNodeMapInfo);
+                srcPayloads = std::make_unique<FactorizedTable>(
+                    context->clientContext->getMemoryManager(),
+                    dataInfo.srcPayloadsTableSchema.copy());
+                for (auto i = 0u; i < dataInfo.srcPayloadsPos.size(); ++i) {
+                    srcPayloadVectors.push_back(
+                        resultSet->getValueVector(dataInfo.srcPayloadsPos[i]).get());
+                    srcPayloadColIdxes.push_back(i);
+                }
+                break;
+            }
             bfsState = std::make_unique<ShortestPathState<false /* TRACK_PATH */>>(upperBound,
-                targetDstNodes.get());
+                targetDstNodes.get(), denseNodeMapInfo);
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(
                     std::make_unique<DstNodeWithMultiplicityScanner>(targetDstNodes.get(), i));
@@ -106,7 +130,7 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
         case planner::RecursiveJoinType::TRACK_PATH: {
             vectors->pathVector = resultSet->getValueVector(dataInfo.pathPos).get();
             bfsState = std::make_unique<AllShortestPathState<true /* TRACK_PATH */>>(upperBound,
-                targetDstNodes.get());
+                targetDstNodes.get(), denseNodeMapInfo);
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(std::make_unique<PathScanner>(targetDstNodes.get(), i,
                     dataInfo.tableIDToName, nullptr, info.direction, info.extendFromSource));
@@ -114,7 +138,7 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
         } break;
         case planner::RecursiveJoinType::TRACK_NONE: {
             bfsState = std::make_unique<AllShortestPathState<false /* TRACK_PATH */>>(upperBound,
-                targetDstNodes.get());
+                targetDstNodes.get(), denseNodeMapInfo);
             for (auto i = lowerBound; i <= upperBound; ++i) {
                 scanners.push_back(
                     std::make_unique<DstNodeWithMultiplicityScanner>(targetDstNodes.get(), i));
@@ -165,12 +189,27 @@ void RecursiveJoin::initLocalStateInternal(ResultSet*, ExecutionContext* context
     }
     frontiersScanner = std::make_unique<FrontiersScanner>(std::move(scanners));
     initLocalRecursivePlan(context);
+    // If there is a single target dst node, search the shortest paths from both ends.
+    auto& targetNodeIDs = targetDstNodes->getNodeIDs();
+    if (bwdRecursiveRoot != nullptr && targetNodeIDs.size() == 1 &&
+        dataInfo.recursiveDstNodeTableIDs.contains(targetNodeIDs.begin()->tableID)) {
+        targetDstNodeID = *targetNodeIDs.begin();
+        biBFSState = std::make_unique<BidirectionalBFSState>(upperBound);
+        msBFSState = nullptr;
+        initLocalBwdRecursivePlan(context);
+    }
 }
 
 bool RecursiveJoin::getNextTuplesInternal(ExecutionContext* context) {
     if (targetDstNodes->getNumNodes() == 0) {
         return false;
     }
+    if (biBFSState != nullptr) {
+        return getNextTuplesBidirectional(context);
+    }
+    if (msBFSState != nullptr) {
+        return getNextTuplesMultiSource(context);
+    }
     // There are two high level steps.
     //
     // (1) BFS Computation phase: Grab a new source to do a BFS and compute an entire BFS starting
@@ -232,7 +271,7 @@ void RecursiveJoin::computeBFS(ExecutionContext* context) {
 }
 
 void RecursiveJoin::updateVisitedNodes(nodeID_t boundNodeID) {
-    auto boundNodeMultiplicity = bfsState->getMultiplicity(boundNodeID);
+    auto boundNodeMultiplicity = bfsState->getBoundNodeMultiplicity();
     auto& selVector = vectors->recursiveDstNodeIDVector->state->getSelVector();
     for (auto i = 0u; i < selVector.getSelSize(); ++i) {
         auto pos = selVector[i];
@@ -247,6 +286,164 @@ void RecursiveJoin::updateVisitedNodes(nodeID_t boundNodeID) {
     }
 }
 
+bool RecursiveJoin::getNextTuplesMultiSource(ExecutionContext* context) {
+    // Same as above, except that a batch of sources is pulled from the child and their BFSs are
+    // computed together. The input tuple of each source is restored when its output is scanned.
+    while (true) {
+        if (scanMultiSourceOutput()) {
+            return true;
+        }
+        if (!hasMoreSources) {
+            // The child is exhausted. If this operator is pulled again (e.g. when its pipeline is
+            // re-executed for the next input batch of a subquery), pull from the child again.
+            hasMoreSources = true;
+            msBFSState->resetState();
+            restoredSrcIdx = INVALID_IDX;
+            return false;
+        }
+        const auto numSources = msBFSState->getNumSources();
+        if (numSources > 0) {
+            // Leave the child's vectors as the child left them before pulling from it again.
+            restoreSrcPayloads(numSources - 1);
+        }
+        msBFSState->resetState();
+        srcPayloads->clear();
+        srcMultiplicities.clear();
+        while (!msBFSState->isFull()) {
+            if (!children[0]->getNextTuple(context)) {
+                hasMoreSources = false;
+                break;
+            }
+            msBFSState->addSrc(vectors->srcNodeIDVector->getValue<nodeID_t>(
+                vectors->srcNodeIDVector->state->getSelVector()[0]));
+            srcPayloads->append(srcPayloadVectors);
+            srcMultiplicities.push_back(resultSet->multiplicity);
+        }
+        if (msBFSState->getNumSources() == 0) {
+            hasMoreSources = true;
+            restoredSrcIdx = INVALID_IDX;
+            return false;
+        }
+        restoredSrcIdx = msBFSState->getNumSources() - 1;
+        computeMultiSourceBFS(context);
+        nextSrcIdxToScan = 0;
+        nextDstIdxToScan = 0;
+    }
+}
+
+bool RecursiveJoin::scanMultiSourceOutput() {
+    while (nextSrcIdxToScan < msBFSState->getNumSources()) {
+        auto& dstNodes = msBFSState->getDstNodes(nextSrcIdxToScan);
+        if (nextDstIdxToScan == dstNodes.size()) {
+            nextSrcIdxToScan++;
+            nextDstIdxToScan = 0;
+            continue;
+        }
+        restoreSrcPayloads(nextSrcIdxToScan);
+        sel_t vectorPos = 0;
+        while (vectorPos < DEFAULT_VECTOR_CAPACITY && nextDstIdxToScan < dstNodes.size()) {
+            auto& dstNode = dstNodes[nextDstIdxToScan++];
+            vectors->dstNodeIDVector->setValue<nodeID_t>(vectorPos, dstNode.nodeID);
+            vectors->pathLengthVector->setValue<int64_t>(vectorPos, (int64_t)dstNode.length);
+            vectorPos++;
+        }
+        vectors->dstNodeIDVector->state->initOriginalAndSelectedSize(vectorPos);
+        return true;
+    }
+    return false;
+}
+
+void RecursiveJoin::computeMultiSourceBFS(ExecutionContext* context) {
+    vectors->recursiveNodePredicateExecFlagVector->setValue<bool>(0, true);
+    while (!msBFSState->isComplete()) {
+        auto boundNodeID = msBFSState->getNextNodeID();
+        if (boundNodeID.offset != INVALID_OFFSET) {
+            // Extend the node once for all sources it has been reached from.
+            recursiveSource->init(boundNodeID);
+            while (recursiveRoot->getNextTuple(context)) {
+                auto& selVector = vectors->recursiveDstNodeIDVector->state->getSelVector();
+                for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+                    msBFSState->markVisited(
+                        vectors->recursiveDstNodeIDVector->getValue<nodeID_t>(selVector[i]));
+                }
+            }
+        } else {
+            msBFSState->finalizeCurrentLevel();
+            vectors->recursiveNodePredicateExecFlagVector->setValue<bool>(0, false);
+        }
+    }
+}
+
+void RecursiveJoin::restoreSrcPayloads(idx_t srcIdx) {
+    if (srcIdx == restoredSrcIdx) {
+        return;
+    }
+    // All payloads are flat, so they are written at the current position of their vectors. Note
+    // that we don't reset auxiliary buffers here since they still hold the child's unflat data.
+    srcPayloads->lookup(srcPayloadVectors, nullptr /* selVector */, srcPayloadColIdxes,
+        srcPayloads->getTuple(srcIdx));
+    resultSet->multiplicity = srcMultiplicities[srcIdx];
+    restoredSrcIdx = srcIdx;
+}
+
+bool RecursiveJoin::getNextTuplesBidirectional(ExecutionContext* context) {
+    while (true) {
+        if (numDstRowsToScan > 0) {
+            // Each shortest path is output as a row of the target dst node.
+            const auto numRows = std::min<uint64_t>(numDstRowsToScan, DEFAULT_VECTOR_CAPACITY);
+            const auto length = (int64_t)biBFSState->getShortestPathLength();
+            for (auto i = 0u; i < numRows; ++i) {
+                vectors->dstNodeIDVector->setValue<nodeID_t>(i, targetDstNodeID);
+                vectors->pathLengthVector->setValue<int64_t>(i, length);
+            }
+            vectors->dstNodeIDVector->state->initOriginalAndSelectedSize(numRows);
+            numDstRowsToScan -= numRows;
+            return true;
+        }
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        computeBidirectionalBFS(context);
+    }
+}
+
+void RecursiveJoin::computeBidirectionalBFS(ExecutionContext* context) {
+    auto nodeID = vectors->srcNodeIDVector->getValue<nodeID_t>(
+        vectors->srcNodeIDVector->state->getSelVector()[0]);
+    biBFSState->resetState(nodeID, targetDstNodeID);
+    while (!biBFSState->isComplete()) {
+        auto boundNodeID = biBFSState->getNextNodeID();
+        if (boundNodeID.offset == INVALID_OFFSET) {
+            biBFSState->finalizeCurrentLevel();
+            continue;
+        }
+        const auto extendingFwd = biBFSState->isExtendingFwd();
+        auto source = extendingFwd ? recursiveSource : bwdRecursiveSource;
+        auto root = extendingFwd ? recursiveRoot.get() : bwdRecursiveRoot.get();
+        auto nbrNodeIDVector =
+            extendingFwd ? vectors->recursiveDstNodeIDVector : vectors->bwdRecursiveDstNodeIDVector;
+        auto execFlagVector = extendingFwd ? vectors->recursiveNodePredicateExecFlagVector :
+                                             vectors->bwdRecursiveNodePredicateExecFlagVector;
+        execFlagVector->setValue<bool>(0, biBFSState->isFirstLevelOfSide());
+        source->init(boundNodeID);
+        while (root->getNextTuple(context)) {
+            auto& selVector = nbrNodeIDVector->state->getSelVector();
+            for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+                biBFSState->markVisited(boundNodeID,
+                    nbrNodeIDVector->getValue<nodeID_t>(selVector[i]));
+            }
+        }
+    }
+    numDstRowsToScan = 0;
+    const auto length = biBFSState->getShortestPathLength();
+    if (biBFSState->getNumShortestPaths() == 0 || length < info.lowerBound ||
+        length > info.upperBound) {
+        return;
+    }
+    numDstRowsToScan =
+        info.queryRelType == QueryRelType::SHORTEST ? 1 : biBFSState->getNumShortestPaths();
+}
+
 static PhysicalOperator* getSource(PhysicalOperator* op) {
     while (op->getNumChildren() != 0) {
         KU_ASSERT(op->getNumChildren() == 1);
@@ -273,6 +470,18 @@ void RecursiveJoin::initLocalRecursivePlan(ExecutionContext* context) {
     recursiveSource = getSource(recursiveRoot.get())->ptrCast<OffsetScanNodeTable>();
 }
 
+void RecursiveJoin::initLocalBwdRecursivePlan(ExecutionContext* context) {
+    auto& dataInfo = info.dataInfo;
+    bwdLocalResultSet = std::make_unique<ResultSet>(dataInfo.bwdLocalResultSetDescriptor.get(),
+        context->clientContext->getMemoryManager());
+    vectors->bwdRecursiveDstNodeIDVector =
+        bwdLocalResultSet->getValueVector(dataInfo.bwdRecursiveDstNodeIDPos).get();
+    vectors->bwdRecursiveNodePredicateExecFlagVector =
+        bwdLocalResultSet->getValueVector(dataInfo.bwdRecursiveNodePredicateExecFlagPos).get();
+    bwdRecursiveRoot->initLocalState(bwdLocalResultSet.get(), context);
+    bwdRecursiveSource = getSource(bwdRecursiveRoot.get())->ptrCast<OffsetScanNodeTable>();
+}
+
 void RecursiveJoin::populateTargetDstNodes(ExecutionContext*) {
     node_id_set_t targetNodeIDs;
     uint64_t numTargetNodes = 0;
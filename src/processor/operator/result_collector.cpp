@@ -1,6 +1,7 @@
 #include "processor/operator/result_collector.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/exception/interrupt.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -37,18 +38,55 @@ void ResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
 }
 
 void ResultCollector::executeInternal(ExecutionContext* context) {
+    const auto stream = sharedState->getStream();
     while (children[0]->getNextTuple(context)) {
         if (!payloadVectors.empty()) {
             for (auto i = 0u; i < resultSet->multiplicity; i++) {
                 localTable->append(payloadAndMarkVectors);
             }
+            if (stream != nullptr) {
+                numFlatTuplesInLocalTable += getNumFlatTuplesOfPayloads() * resultSet->multiplicity;
+                if (numFlatTuplesInLocalTable >= NUM_FLAT_TUPLES_PER_STREAMED_TABLE) {
+                    pushLocalTableToStream(context);
+                }
+            }
         }
     }
-    if (!payloadVectors.empty()) {
+    if (payloadVectors.empty()) {
+        return;
+    }
+    if (stream != nullptr) {
+        if (!localTable->isEmpty()) {
+            pushLocalTableToStream(context);
+        }
+    } else {
         sharedState->mergeLocalTable(*localTable);
     }
 }
 
+uint64_t ResultCollector::getNumFlatTuplesOfPayloads() const {
+    std::unordered_set<DataChunkState*> unflatStates;
+    uint64_t numFlatTuples = 1;
+    for (auto& vector : payloadVectors) {
+        auto state = vector->state.get();
+        if (!state->isFlat() && unflatStates.insert(state).second) {
+            numFlatTuples *= state->getSelVector().getSelSize();
+        }
+    }
+    return numFlatTuples;
+}
+
+void ResultCollector::pushLocalTableToStream(ExecutionContext* context) {
+    numFlatTuplesInLocalTable = 0;
+    auto table = std::move(localTable);
+    localTable = std::make_unique<FactorizedTable>(context->clientContext->getMemoryManager(),
+        info.tableSchema.copy());
+    if (!sharedState->getStream()->push(std::move(table))) {
+        // Nobody consumes the result anymore.
+        throw InterruptException();
+    }
+}
+
 void ResultCollector::finalize(ExecutionContext* /*context*/) {
     switch (info.accumulateType) {
     case AccumulateType::OPTIONAL_: {
@@ -80,6 +80,9 @@ bool ScanMultiRelTable::getNextTuplesInternal(ExecutionContext* context) {
     while (true) {
         if (currentScanner != nullptr &&
             currentScanner->scan(outState->getSelVector(), context->clientContext->getTx())) {
+            if (!applyRuntimeFilters()) {
+                continue;
+            }
             metrics->numOutputTuple.increase(outState->getSelVector().getSelSize());
             return true;
         }
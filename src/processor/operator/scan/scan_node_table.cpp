@@ -1,6 +1,7 @@
 #include "processor/operator/scan/scan_node_table.h"
 
 #include "binder/expression/expression_util.h"
+#include "main/db_config.h"
 #include "storage/local_storage/local_node_table.h"
 
 using namespace kuzu::common;
@@ -80,11 +81,26 @@ std::vector<NodeSemiMask*> ScanNodeTable::getSemiMasks() const {
     return result;
 }
 
+// A full scan of the given columns of a table is estimated to read 8 bytes per value. Scans that
+// read more than a quarter of the buffer pool are unlikely to find their pages cached again, so
+// they read them with PageAccessHint::USE_ONCE and don't evict pages that are used more often.
+static bool isLargeScan(NodeTable& table, const std::vector<column_id_t>& columnIDs,
+    uint64_t bufferPoolSize) {
+    const auto numColumns = std::count_if(columnIDs.begin(), columnIDs.end(),
+        [](column_id_t columnID) { return columnID != INVALID_COLUMN_ID; });
+    return table.getNumRows() * numColumns * sizeof(uint64_t) > bufferPoolSize / 4;
+}
+
 void ScanNodeTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     ScanTable::initLocalStateInternal(resultSet, context);
+    const auto bufferPoolSize = context->clientContext->getDBConfig()->bufferPoolSize;
     for (auto i = 0u; i < nodeInfos.size(); ++i) {
         auto& nodeInfo = nodeInfos[i];
         nodeInfo.initScanState(sharedStates[i]->getSemiMask());
+        nodeInfo.localScanState->readAhead = true;
+        if (isLargeScan(*nodeInfo.table, nodeInfo.columnIDs, bufferPoolSize)) {
+            nodeInfo.localScanState->accessHint = PageAccessHint::USE_ONCE;
+        }
         initVectors(*nodeInfo.localScanState, *resultSet);
     }
 }
@@ -107,7 +123,8 @@ bool ScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
         if (!skipScan) {
             while (scanState.source != TableScanSource::NONE &&
                    info.table->scan(transaction, scanState)) {
-                if (scanState.IDVector->state->getSelVector().getSelSize() > 0) {
+                if (scanState.IDVector->state->getSelVector().getSelSize() > 0 &&
+                    applyRuntimeFilters()) {
                     return true;
                 }
             }
@@ -93,7 +93,8 @@ bool ScanRelTable::getNextTuplesInternal(ExecutionContext* context) {
         if (!skipScan) {
             while (scanState.source != TableScanSource::NONE &&
                    relInfo.table->scan(transaction, scanState)) {
-                if (scanState.IDVector->state->getSelVector().getSelSize() > 0) {
+                if (scanState.IDVector->state->getSelVector().getSelSize() > 0 &&
+                    applyRuntimeFilters()) {
                     return true;
                 }
             }
@@ -1,15 +1,37 @@
 #include "processor/operator/scan/scan_table.h"
 
+#include <algorithm>
+
+#include "main/client_context.h"
+
 namespace kuzu {
 namespace processor {
 
-void ScanTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext*) {
+bool ScanTable::isOutputVector(const DataPos& pos) const {
+    return pos == info.IDPos ||
+           std::find(info.outVectorsPos.begin(), info.outVectorsPos.end(), pos) !=
+               info.outVectorsPos.end();
+}
+
+void ScanTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     IDVector = resultSet->getValueVector(info.IDPos).get();
     if (info.outVectorsPos.empty()) {
         outState = IDVector->state.get();
     } else {
         outState = resultSet->getValueVector(info.outVectorsPos[0])->state.get();
     }
+    for (auto& runtimeFilter : info.runtimeFilters) {
+        runtimeFilter.init(*resultSet, context->clientContext->getMemoryManager());
+    }
+}
+
+bool ScanTable::applyRuntimeFilters() {
+    for (auto& runtimeFilter : info.runtimeFilters) {
+        if (runtimeFilter.apply() == 0) {
+            return false;
+        }
+    }
+    return true;
 }
 
 void ScanTable::initVectors(storage::TableScanState& state, const ResultSet& resultSet) const {
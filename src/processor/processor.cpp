@@ -1,5 +1,6 @@
 #include "processor/processor.h"
 
+#include "main/client_context.h"
 #include "processor/operator/result_collector.h"
 #include "processor/operator/sink.h"
 #include "processor/processor_task.h"
@@ -24,9 +25,19 @@ std::shared_ptr<FactorizedTable> QueryProcessor::execute(PhysicalPlan* physicalP
     // one.
     auto task = std::make_shared<ProcessorTask>(resultCollector, context);
     decomposePlanIntoTask(lastOperator->getChild(0), task.get(), context);
-    initTask(task.get());
+    uint64_t maxNumConcurrentPipelines = 1;
+    if (canExecutePipelinesConcurrently(lastOperator)) {
+        maxNumConcurrentPipelines =
+            context->clientContext->getClientConfig()->maxNumConcurrentPipelines;
+    }
+    initTask(task.get(), maxNumConcurrentPipelines);
     context->clientContext->getProgressBar()->startProgress(context->queryID);
-    taskScheduler->scheduleTaskAndWaitOrError(task, context);
+    if (resultCollector->isStreamingResult()) {
+        // The root pipeline blocks whenever the consumer of the streamed result falls behind.
+        taskScheduler->scheduleTaskOnCallingThreadAndWaitOrError(task, context);
+    } else {
+        taskScheduler->scheduleTaskAndWaitOrError(task, context);
+    }
     context->clientContext->getProgressBar()->endProgress(context->queryID);
     return resultCollector->getResultFactorizedTable();
 }
@@ -51,7 +62,57 @@ void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
     }
 }
 
-void QueryProcessor::initTask(Task* task) {
+// Pipelines that are children of the same task only depend on their own children through the
+// task tree. Some operators, however, communicate across pipelines outside of the task tree (e.g.,
+// semi maskers fill masks consumed by scans of another pipeline) or have side effects on storage.
+// We only run sibling pipelines concurrently if the plan consists of operators known to be free of
+// such dependencies.
+static bool canExecuteOperatorConcurrently(PhysicalOperatorType operatorType) {
+    switch (operatorType) {
+    case PhysicalOperatorType::AGGREGATE:
+    case PhysicalOperatorType::AGGREGATE_SCAN:
+    case PhysicalOperatorType::CROSS_PRODUCT:
+    case PhysicalOperatorType::EMPTY_RESULT:
+    case PhysicalOperatorType::FILTER:
+    case PhysicalOperatorType::FLATTEN:
+    case PhysicalOperatorType::HASH_JOIN_BUILD:
+    case PhysicalOperatorType::HASH_JOIN_PROBE:
+    case PhysicalOperatorType::INTERSECT_BUILD:
+    case PhysicalOperatorType::INTERSECT:
+    case PhysicalOperatorType::LIMIT:
+    case PhysicalOperatorType::MULTIPLICITY_REDUCER:
+    case PhysicalOperatorType::PRIMARY_KEY_SCAN_NODE_TABLE:
+    case PhysicalOperatorType::PROJECTION:
+    case PhysicalOperatorType::RESULT_COLLECTOR:
+    case PhysicalOperatorType::SCAN_NODE_TABLE:
+    case PhysicalOperatorType::SCAN_REL_TABLE:
+    case PhysicalOperatorType::SKIP:
+    case PhysicalOperatorType::TOP_K:
+    case PhysicalOperatorType::TOP_K_SCAN:
+    case PhysicalOperatorType::ORDER_BY:
+    case PhysicalOperatorType::ORDER_BY_MERGE:
+    case PhysicalOperatorType::ORDER_BY_SCAN:
+    case PhysicalOperatorType::UNION_ALL_SCAN:
+    case PhysicalOperatorType::UNWIND:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool QueryProcessor::canExecutePipelinesConcurrently(const PhysicalOperator* op) {
+    if (!canExecuteOperatorConcurrently(op->getOperatorType())) {
+        return false;
+    }
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        if (!canExecutePipelinesConcurrently(op->getChild(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void QueryProcessor::initTask(Task* task, uint64_t maxNumConcurrentPipelines) {
     auto processorTask = ku_dynamic_cast<Task*, ProcessorTask*>(task);
     PhysicalOperator* op = processorTask->sink;
     while (!op->isSource()) {
@@ -63,8 +124,9 @@ void QueryProcessor::initTask(Task* task) {
     if (!op->isParallel()) {
         task->setSingleThreadedTask();
     }
+    task->setMaxNumConcurrentChildren(maxNumConcurrentPipelines);
     for (auto& child : task->children) {
-        initTask(child.get());
+        initTask(child.get(), maxNumConcurrentPipelines);
     }
 }
 
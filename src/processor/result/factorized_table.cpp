@@ -184,6 +184,14 @@ bool FactorizedTable::hasUnflatCol() const {
     return hasUnflatCol(colIdxes);
 }
 
+uint64_t FactorizedTable::getMemoryUsage() const {
+    if (tableSchema.isEmpty()) {
+        return 0;
+    }
+    return flatTupleBlockCollection->getMemoryUsage() +
+           unFlatTupleBlockCollection->getMemoryUsage() + inMemOverflowBuffer->getMemoryUsage();
+}
+
 uint64_t FactorizedTable::getTotalNumFlatTuples() const {
     auto totalNumFlatTuples = 0ul;
     for (auto i = 0u; i < getNumTuples(); i++) {
@@ -257,6 +265,18 @@ void FactorizedTable::clear() {
     inMemOverflowBuffer->resetBuffer();
 }
 
+void FactorizedTable::pin() {
+    flatTupleBlockCollection->pin();
+    unFlatTupleBlockCollection->pin();
+    inMemOverflowBuffer->pin();
+}
+
+void FactorizedTable::unpin() {
+    flatTupleBlockCollection->unpin();
+    unFlatTupleBlockCollection->unpin();
+    inMemOverflowBuffer->unpin();
+}
+
 void FactorizedTable::setOverflowColNull(uint8_t* nullBuffer, ft_col_idx_t colIdx,
     ft_tuple_idx_t tupleIdx) {
     NullBuffer::setNull(nullBuffer, tupleIdx);
@@ -571,11 +591,7 @@ FlatTupleIterator::FlatTupleIterator(FactorizedTable& factorizedTable, std::vect
 void FlatTupleIterator::getNextFlatTuple() {
     // Go to the next tuple if we have iterated all the flat tuples of the current tuple.
     if (nextFlatTupleIdx >= numFlatTuples) {
-        currentTupleBuffer = factorizedTable.getTuple(nextTupleIdx);
-        numFlatTuples = factorizedTable.getNumFlatTuples(nextTupleIdx);
-        nextFlatTupleIdx = 0;
-        updateNumElementsInDataChunk();
-        nextTupleIdx++;
+        moveToNextTuple();
     }
     for (auto i = 0ul; i < factorizedTable.getTableSchema()->getNumColumns(); i++) {
         auto column = factorizedTable.getTableSchema()->getColumn(i);
@@ -589,6 +605,52 @@ void FlatTupleIterator::getNextFlatTuple() {
     nextFlatTupleIdx++;
 }
 
+bool FlatTupleIterator::canReadFlatTupleRuns() const {
+    auto unflatGroupID = INVALID_IDX;
+    auto tableSchema = factorizedTable.getTableSchema();
+    for (auto i = 0u; i < tableSchema->getNumColumns(); i++) {
+        auto column = tableSchema->getColumn(i);
+        if (column->isFlat()) {
+            continue;
+        }
+        if (unflatGroupID != INVALID_IDX && unflatGroupID != column->getGroupID()) {
+            return false;
+        }
+        unflatGroupID = column->getGroupID();
+    }
+    return true;
+}
+
+FlatTupleRun FlatTupleIterator::getNextFlatTupleRun(uint64_t maxNumFlatTuples) {
+    KU_ASSERT(canReadFlatTupleRuns());
+    if (nextFlatTupleIdx >= numFlatTuples) {
+        moveToNextTuple();
+    }
+    FlatTupleRun run;
+    run.table = &factorizedTable;
+    run.tuple = currentTupleBuffer;
+    run.startIdx = nextFlatTupleIdx;
+    run.numFlatTuples = std::min(maxNumFlatTuples, numFlatTuples - nextFlatTupleIdx);
+    nextFlatTupleIdx += run.numFlatTuples;
+    // With a single unflat group, the position in that group is the index of the next flat tuple.
+    for (auto i = 0u; i < flatTuplePositionsInDataChunk.size(); i++) {
+        if (!isValidDataChunkPos(i)) {
+            continue;
+        }
+        auto& [nextIdxToRead, numElements] = flatTuplePositionsInDataChunk[i];
+        nextIdxToRead = nextFlatTupleIdx >= numElements ? 0 : nextFlatTupleIdx;
+    }
+    return run;
+}
+
+void FlatTupleIterator::moveToNextTuple() {
+    currentTupleBuffer = factorizedTable.getTuple(nextTupleIdx);
+    numFlatTuples = factorizedTable.getNumFlatTuples(nextTupleIdx);
+    nextFlatTupleIdx = 0;
+    updateNumElementsInDataChunk();
+    nextTupleIdx++;
+}
+
 void FlatTupleIterator::resetState() {
     numFlatTuples = 0;
     nextFlatTupleIdx = 0;
@@ -0,0 +1,71 @@
+#include "processor/result/result_stream.h"
+
+#include "common/exception/runtime.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+bool ResultStream::push(std::unique_ptr<FactorizedTable> table) {
+    std::unique_lock lck{mtx};
+    while (tables.size() >= capacity && !draining && !cancelled) {
+        if (shouldDrain == nullptr) {
+            cv.wait(lck);
+            continue;
+        }
+        if (shouldDrain()) {
+            draining = true;
+            break;
+        }
+        cv.wait_for(lck, std::chrono::milliseconds(DRAIN_CHECK_INTERVAL_IN_MS));
+    }
+    if (cancelled) {
+        return false;
+    }
+    tables.push_back(std::move(table));
+    cv.notify_all();
+    return true;
+}
+
+void ResultStream::finish(std::exception_ptr exception_) {
+    std::unique_lock lck{mtx};
+    finished = true;
+    // The exception raised by producers that stopped because the stream was cancelled is not the
+    // reason the stream ended.
+    if (!cancelled) {
+        exception = std::move(exception_);
+    }
+    cv.notify_all();
+}
+
+std::unique_ptr<FactorizedTable> ResultStream::pop() {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return !tables.empty() || finished; });
+    if (!tables.empty()) {
+        auto table = std::move(tables.front());
+        tables.pop_front();
+        cv.notify_all();
+        return table;
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    if (cancelled) {
+        throw RuntimeException("The query was stopped before producing all of its result because "
+                               "another statement was run on the connection.");
+    }
+    return nullptr;
+}
+
+void ResultStream::cancel() {
+    std::unique_lock lck{mtx};
+    if (finished) {
+        return;
+    }
+    cancelled = true;
+    cv.notify_all();
+}
+
+} // namespace processor
+} // namespace kuzu
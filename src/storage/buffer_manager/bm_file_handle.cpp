@@ -27,14 +27,14 @@ uint8_t* BMFileHandle::pinPage(page_idx_t pageIdx, PageReadPolicy readPolicy) {
 }
 
 void BMFileHandle::optimisticReadPage(page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& readOp) {
+    const std::function<void(uint8_t*)>& readOp, PageAccessHint accessHint) {
     if (isInMemoryMode()) {
         KU_ASSERT(
             PageState::getState(getPageState(pageIdx)->getStateAndVersion()) == PageState::LOCKED);
         const auto frame = bm->getFrame(*this, pageIdx);
         readOp(frame);
     } else {
-        bm->optimisticRead(*this, pageIdx, readOp);
+        bm->optimisticRead(*this, pageIdx, readOp, accessHint);
     }
 }
 
@@ -42,6 +42,13 @@ void BMFileHandle::unpinPage(page_idx_t pageIdx) {
     bm->unpin(*this, pageIdx);
 }
 
+void BMFileHandle::prefetchPages(page_idx_t startPageIdx, page_idx_t numPages) {
+    if (isInMemoryMode()) {
+        return;
+    }
+    bm->prefetch(*this, startPageIdx, numPages);
+}
+
 page_idx_t BMFileHandle::addNewPageWithoutLock() {
     if (numPages == pageCapacity) {
         addNewPageGroupWithoutLock();
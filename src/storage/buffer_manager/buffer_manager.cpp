@@ -1,5 +1,6 @@
 #include "storage/buffer_manager/buffer_manager.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstring>
 
@@ -72,14 +73,32 @@ void EvictionQueue::clear(std::atomic<EvictionCandidate>& candidate) {
     KU_UNREACHABLE;
 }
 
-BufferManager::BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize)
-    : bufferPoolSize{bufferPoolSize},
+bool EvictionQueue::tryClear(std::atomic<EvictionCandidate>& candidate,
+    EvictionCandidate expected) {
+    if (expected != EMPTY && candidate.compare_exchange_strong(expected, EMPTY)) {
+        size--;
+        return true;
+    }
+    return false;
+}
+
+BufferManager::BufferManager(uint64_t bufferPoolSize, uint64_t maxDBSize,
+    EvictionPolicy evictionPolicy)
+    : bufferPoolSize{bufferPoolSize}, evictionPolicy{evictionPolicy},
       evictionQueue{bufferPoolSize / BufferPoolConstants::PAGE_4KB_SIZE},
-      usedMemory{evictionQueue.getCapacity() * sizeof(EvictionCandidate)} {
+      usedMemory{evictionQueue.getCapacity() * sizeof(EvictionCandidate)}, numPrefetchedPages{0} {
     verifySizeParams(bufferPoolSize, maxDBSize);
+    if (evictionPolicy == EvictionPolicy::TWO_QUEUE) {
+        protectedQueue = std::make_unique<EvictionQueue>(evictionQueue.getCapacity());
+        reserveUsedMemory(protectedQueue->getCapacity() * sizeof(EvictionCandidate));
+    }
     vmRegions.resize(2);
     vmRegions[0] = std::make_unique<VMRegion>(PAGE_4KB, maxDBSize);
-    vmRegions[1] = std::make_unique<VMRegion>(PAGE_256KB, bufferPoolSize);
+    // Memory buffers spilled to disk keep their frames, so there can be more 256KB frames in use
+    // than fit in the buffer pool.
+    vmRegions[1] = std::make_unique<VMRegion>(PAGE_256KB,
+        std::max(bufferPoolSize * BufferPoolConstants::MAX_SPILLED_TO_BUFFER_POOL_SIZE_RATIO,
+            2 * BufferPoolConstants::PAGE_256KB_SIZE * StorageConstants::PAGE_GROUP_SIZE));
 }
 
 void BufferManager::verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize) {
@@ -198,7 +217,7 @@ inline bool try_func(const std::function<void(uint8_t*)>& func, uint8_t* frame,
 }
 
 void BufferManager::optimisticRead(BMFileHandle& fileHandle, page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& func) {
+    const std::function<void(uint8_t*)>& func, PageAccessHint accessHint) {
     auto pageState = fileHandle.getPageState(pageIdx);
 #if defined(_WIN32)
     // Change the Structured Exception handling just for the scope of this function
@@ -217,14 +236,30 @@ void BufferManager::optimisticRead(BMFileHandle& fileHandle, page_idx_t pageIdx,
             }
         } break;
         case PageState::MARKED: {
+            if (accessHint == PageAccessHint::USE_ONCE) {
+                // Read the page without clearing the mark, so that the read doesn't count as a
+                // reference. Same as reading an UNLOCKED page, the read is only valid if the page
+                // was not evicted or modified in the meantime.
+                if (!try_func(func, getFrame(fileHandle, pageIdx), vmRegions,
+                        fileHandle.getPageSizeClass())) {
+                    continue;
+                }
+                if (pageState->getStateAndVersion() == currStateAndVersion) {
+                    return;
+                }
+                continue;
+            }
             // If the page is marked, we try to switch to unlocked.
             pageState->tryClearMark(currStateAndVersion);
             continue;
         } break;
         case PageState::EVICTED: {
-            pin(fileHandle, pageIdx, PageReadPolicy::READ_PAGE);
+            // Read the page while it is still pinned. Otherwise, the page would have to be read
+            // again after unpinning, which counts as a second reference to it.
+            func(pin(fileHandle, pageIdx, PageReadPolicy::READ_PAGE));
             unpin(fileHandle, pageIdx);
-        } break;
+            return;
+        }
         default: {
             // When locked, continue the spinning.
             continue;
@@ -235,11 +270,65 @@ void BufferManager::optimisticRead(BMFileHandle& fileHandle, page_idx_t pageIdx,
 
 void BufferManager::unpin(BMFileHandle& fileHandle, page_idx_t pageIdx) {
     auto pageState = fileHandle.getPageState(pageIdx);
+    if (evictionPolicy == EvictionPolicy::TWO_QUEUE && pageState->isUnpinnedForTheFirstTime()) {
+        // Newly cached pages are evictable right away unless they are referenced again.
+        pageState->unlockAndMark();
+        return;
+    }
     pageState->unlock();
 }
 
-// evicts up to 64 pages and returns the space reclaimed
+// Prefetching doesn't claim any frames. Instead, runs of consecutive evicted pages are handed to
+// the file system as read-ahead hints, so the reads happen in the background (e.g., into the OS
+// page cache) and the later `pin` of each page only has to copy the page into its frame.
+void BufferManager::prefetch(BMFileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages) {
+    const auto endPageIdx = std::min(static_cast<uint64_t>(startPageIdx) + numPages,
+        static_cast<uint64_t>(fileHandle.getNumPages()));
+    const auto pageSize = fileHandle.getPageSize();
+    auto pageIdx = static_cast<uint64_t>(startPageIdx);
+    while (pageIdx < endPageIdx) {
+        if (fileHandle.getPageState(pageIdx)->getState() != PageState::EVICTED) {
+            pageIdx++;
+            continue;
+        }
+        const auto runStartPageIdx = pageIdx;
+        while (pageIdx < endPageIdx &&
+               fileHandle.getPageState(pageIdx)->getState() == PageState::EVICTED) {
+            pageIdx++;
+        }
+        fileHandle.getFileInfo()->prefetch(runStartPageIdx * pageSize,
+            (pageIdx - runStartPageIdx) * pageSize);
+        numPrefetchedPages.fetch_add(pageIdx - runStartPageIdx, std::memory_order_relaxed);
+    }
+}
+
+bool BufferManager::shouldEvictFromProtectedQueueFirst() const {
+    return protectedQueue->getSize() >
+           static_cast<uint64_t>(static_cast<double>(protectedQueue->getCapacity()) *
+                                 BufferPoolConstants::PROTECTED_QUEUE_RATIO);
+}
+
 uint64_t BufferManager::evictPages() {
+    if (evictionPolicy == EvictionPolicy::FIFO_SECOND_CHANCE) {
+        return evictPagesFromQueue(evictionQueue, nullptr /* promotionQueue */);
+    }
+    KU_ASSERT(protectedQueue);
+    uint64_t claimedMemory = 0;
+    if (shouldEvictFromProtectedQueueFirst()) {
+        claimedMemory = evictPagesFromQueue(*protectedQueue, nullptr /* promotionQueue */);
+    }
+    if (claimedMemory == 0) {
+        claimedMemory = evictPagesFromQueue(evictionQueue, protectedQueue.get());
+    }
+    if (claimedMemory == 0) {
+        claimedMemory = evictPagesFromQueue(*protectedQueue, nullptr /* promotionQueue */);
+    }
+    return claimedMemory;
+}
+
+// evicts up to 64 pages and returns the space reclaimed
+uint64_t BufferManager::evictPagesFromQueue(EvictionQueue& queue, EvictionQueue* promotionQueue) {
     constexpr size_t BATCH_SIZE = 64;
     std::array<std::atomic<EvictionCandidate>*, BATCH_SIZE> evictionCandidates;
     size_t evictablePages = 0;
@@ -250,9 +339,10 @@ uint64_t BufferManager::evictPages() {
     // E.g. if the vast majority of pages are unmarked and unlocked,
     // the first pass will mark them and the second pass, if insufficient marked pages
     // are found, will evict the first batch.
-    auto failureLimit = evictionQueue.getSize() * 2;
-    while (evictablePages < BATCH_SIZE && pagesTried < failureLimit) {
-        evictionCandidates[evictablePages] = evictionQueue.next();
+    auto failureLimit = queue.getSize() * 2;
+    // Candidates promoted to another queue are removed from this one, so stop once it is empty.
+    while (evictablePages < BATCH_SIZE && pagesTried < failureLimit && queue.getSize() > 0) {
+        evictionCandidates[evictablePages] = queue.next();
         pagesTried++;
         auto evictionCandidate = evictionCandidates[evictablePages]->load();
         if (evictionCandidate == EvictionQueue::EMPTY) {
@@ -263,7 +353,19 @@ uint64_t BufferManager::evictPages() {
         auto pageStateAndVersion = pageState->getStateAndVersion();
         if (!evictionCandidate.isEvictable(pageStateAndVersion)) {
             if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
-                pageState->tryMark(pageStateAndVersion);
+                if (promotionQueue != nullptr) {
+                    // The page was referenced after its first use. Move it to the protected queue.
+                    // If another thread evicted or moved the candidate first, there is nothing to
+                    // promote.
+                    if (queue.tryClear(*evictionCandidates[evictablePages], evictionCandidate) &&
+                        !promotionQueue->insert(evictionCandidate.fileIdx,
+                            evictionCandidate.pageIdx)) {
+                        throw BufferManagerException(
+                            "Eviction queue is full! This should be impossible.");
+                    }
+                } else {
+                    pageState->tryMark(pageStateAndVersion);
+                }
             }
             continue;
         }
@@ -271,7 +373,7 @@ uint64_t BufferManager::evictPages() {
     }
 
     for (size_t i = 0; i < evictablePages; i++) {
-        claimedMemory += tryEvictPage(*evictionCandidates[i]);
+        claimedMemory += tryEvictPage(queue, *evictionCandidates[i]);
     }
     return claimedMemory;
 }
@@ -331,7 +433,8 @@ bool BufferManager::reserve(uint64_t sizeToReserve) {
     return true;
 }
 
-uint64_t BufferManager::tryEvictPage(std::atomic<EvictionCandidate>& _candidate) {
+uint64_t BufferManager::tryEvictPage(EvictionQueue& queue,
+    std::atomic<EvictionCandidate>& _candidate) {
     auto candidate = _candidate.load();
     // Page must have been evicted by another thread already
     if (candidate.pageIdx == INVALID_PAGE_IDX) {
@@ -362,7 +465,7 @@ uint64_t BufferManager::tryEvictPage(std::atomic<EvictionCandidate>& _candidate)
     auto numBytesFreed = fileHandle.getPageSize();
     releaseFrameForPage(fileHandle, candidate.pageIdx);
     pageState.resetToEvicted();
-    evictionQueue.clear(_candidate);
+    queue.clear(_candidate);
     return numBytesFreed;
 }
 
@@ -378,6 +481,9 @@ void BufferManager::cachePageIntoFrame(BMFileHandle& fileHandle, page_idx_t page
 
 void BufferManager::removeFilePagesFromFrames(BMFileHandle& fileHandle) {
     evictionQueue.removeCandidatesForFile(fileHandle.getFileIndex());
+    if (protectedQueue) {
+        protectedQueue->removeCandidatesForFile(fileHandle.getFileIndex());
+    }
     for (auto pageIdx = 0u; pageIdx < fileHandle.getNumPages(); ++pageIdx) {
         removePageFromFrame(fileHandle, pageIdx, false /* do not flush */);
     }
@@ -2,6 +2,7 @@
 
 #include <cstring>
 
+#include "common/file_system/virtual_file_system.h"
 #include "storage/buffer_manager/buffer_manager.h"
 
 using namespace kuzu::common;
@@ -11,22 +12,52 @@ namespace storage {
 
 MemoryBuffer::MemoryBuffer(MemoryAllocator* allocator, page_idx_t pageIdx, uint8_t* buffer,
     uint64_t size)
-    : buffer{buffer, size}, pageIdx{pageIdx}, allocator{allocator} {}
+    : buffer{buffer, size}, pageIdx{pageIdx}, allocator{allocator}, pinned{true} {}
 
 MemoryBuffer::~MemoryBuffer() {
     if (buffer.data() != nullptr) {
-        allocator->freeBlock(pageIdx, buffer);
+        allocator->freeBlock(pageIdx, buffer, pinned);
     }
 }
 
+void MemoryBuffer::pin() {
+    if (pinned) {
+        return;
+    }
+    allocator->pinBlock(pageIdx);
+    pinned = true;
+}
+
+void MemoryBuffer::unpin() {
+    if (!pinned || !allocator->isSpillable() || pageIdx == INVALID_PAGE_IDX) {
+        return;
+    }
+    allocator->unpinBlock(pageIdx);
+    pinned = false;
+}
+
 MemoryAllocator::MemoryAllocator(BufferManager* bm, VirtualFileSystem* vfs,
-    main::ClientContext* context)
-    : bm{bm} {
+    main::ClientContext* context, const std::string& spillFilePath)
+    : spillable{!spillFilePath.empty()}, bm{bm} {
     pageSize = BufferPoolConstants::PAGE_256KB_SIZE;
-    fh = bm->getBMFileHandle("mm-256KB", FileHandle::O_IN_MEM_TEMP_FILE, vfs, context, PAGE_256KB);
+    if (spillable) {
+        // Whatever is left in the spill file (e.g., after a crash) is garbage.
+        vfs->removeFileIfExists(spillFilePath);
+        fh = bm->getBMFileHandle(spillFilePath,
+            FileHandle::O_PERSISTENT_FILE_CREATE_NOT_EXISTS | FileHandle::isLargePagedMask, vfs,
+            context, PAGE_256KB);
+    } else {
+        fh = bm->getBMFileHandle("mm-256KB", FileHandle::O_IN_MEM_TEMP_FILE, vfs, context,
+            PAGE_256KB);
+    }
 }
 
-MemoryAllocator::~MemoryAllocator() = default;
+MemoryAllocator::~MemoryAllocator() {
+    if (spillable) {
+        // Give the disk space back. The file itself is removed when the database is opened again.
+        fh->getFileInfo()->truncate(0);
+    }
+}
 
 std::unique_ptr<MemoryBuffer> MemoryAllocator::allocateBuffer(bool initializeToZero,
     uint64_t size) {
@@ -57,17 +88,35 @@ std::unique_ptr<MemoryBuffer> MemoryAllocator::allocateBuffer(bool initializeToZ
     return memoryBuffer;
 }
 
-void MemoryAllocator::freeBlock(page_idx_t pageIdx, std::span<uint8_t> buffer) {
+void MemoryAllocator::freeBlock(page_idx_t pageIdx, std::span<uint8_t> buffer, bool pinned) {
     if (pageIdx == INVALID_PAGE_IDX) {
         bm->freeUsedMemory(buffer.size());
         std::free(buffer.data());
         return;
     } else {
-        bm->unpin(*fh, pageIdx);
+        // An unpinned page is not locked, so there is nothing to unpin. If it is still in its frame,
+        // it may be written to the spill file once more before it is evicted or reused.
+        if (pinned) {
+            if (spillable) {
+                // The content is garbage now, so it doesn't need to be written if evicted.
+                fh->getPageState(pageIdx)->clearDirty();
+            }
+            bm->unpin(*fh, pageIdx);
+        }
         std::unique_lock<std::mutex> lock(allocatorLock);
         freePages.push(pageIdx);
     }
 }
 
+void MemoryAllocator::pinBlock(page_idx_t pageIdx) {
+    bm->pin(*fh, pageIdx, PageReadPolicy::READ_PAGE);
+}
+
+void MemoryAllocator::unpinBlock(page_idx_t pageIdx) {
+    // The buffer manager only writes dirty pages to the file when evicting them.
+    fh->getPageState(pageIdx)->setDirty();
+    bm->unpin(*fh, pageIdx);
+}
+
 } // namespace storage
 } // namespace kuzu
@@ -1,6 +1,8 @@
 #include "storage/compression/compression.h"
 
 #include <algorithm>
+#include <bit>
+#include <cmath>
 #include <cstdint>
 #include <limits>
 #include <string>
@@ -72,6 +74,49 @@ uint32_t getDataTypeSizeInChunk(const common::PhysicalTypeID& dataType) {
     }
 }
 
+static bool isAllNull(const NullMask* nullMask, offset_t offset, offset_t numValues) {
+    if (!nullMask) {
+        return false;
+    }
+    for (auto i = offset; i < offset + numValues; i++) {
+        if (!nullMask->isNull(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Calls func with the delta, run-length or ALP encoding algorithm for the physical type
+template<typename Func>
+static void visitEncodingAlg(CompressionType compression, PhysicalTypeID physicalType,
+    Func&& func) {
+    const auto throwNotImplemented = [&]() {
+        throw NotImplementedException(
+            stringFormat("Compression type {} is not implemented for type {}",
+                static_cast<uint8_t>(compression), PhysicalTypeUtils::toString(physicalType)));
+    };
+    const auto visitIntegerAlg = [&]<EncodedIntegerType T>(T) {
+        if (compression == CompressionType::DELTA_BITPACKING) {
+            func(DeltaBitpacking<T>());
+        } else if (compression == CompressionType::RUN_LENGTH_ENCODING) {
+            func(RunLengthEncoding<T>());
+        } else {
+            throwNotImplemented();
+        }
+    };
+    TypeUtils::visit(
+        physicalType, [&](internalID_t) { visitIntegerAlg(uint64_t()); },
+        [&]<EncodedIntegerType T>(T value) { visitIntegerAlg(value); },
+        [&]<std::floating_point T>(T) {
+            if (compression == CompressionType::ALP) {
+                func(FloatCompression<T>());
+            } else {
+                throwNotImplemented();
+            }
+        },
+        [&](auto) { throwNotImplemented(); });
+}
+
 bool CompressionMetadata::canAlwaysUpdateInPlace() const {
     switch (compression) {
     case CompressionType::BOOLEAN_BITPACKING:
@@ -79,7 +124,10 @@ bool CompressionMetadata::canAlwaysUpdateInPlace() const {
         return true;
     }
     case CompressionType::CONSTANT:
-    case CompressionType::INTEGER_BITPACKING: {
+    case CompressionType::INTEGER_BITPACKING:
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::RUN_LENGTH_ENCODING:
+    case CompressionType::ALP: {
         return false;
     }
     default: {
@@ -150,6 +198,13 @@ bool CompressionMetadata::canUpdateInPlace(const uint8_t* data, uint32_t pos, ui
                 return false;
             });
     }
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::RUN_LENGTH_ENCODING:
+    case CompressionType::ALP: {
+        // Updating a value changes the deltas or runs around it, which would require re-encoding
+        // the page. Nulls can be written in place since the values stored for them don't matter.
+        return nullMask && isAllNull(&*nullMask, pos, numValues);
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -197,6 +252,14 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, const LogicalType& da
     case CompressionType::BOOLEAN_BITPACKING: {
         return BooleanBitpacking::numValues(pageSize);
     }
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::RUN_LENGTH_ENCODING:
+    case CompressionType::ALP: {
+        uint64_t result = 0;
+        visitEncodingAlg(compression, dataType.getPhysicalType(),
+            [&](const auto& alg) { result = alg.numValues(pageSize, *this); });
+        return result;
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -282,6 +345,15 @@ std::string CompressionMetadata::toString(const PhysicalTypeID physicalType) con
     case CompressionType::CONSTANT: {
         return "CONSTANT";
     }
+    case CompressionType::DELTA_BITPACKING: {
+        return stringFormat("DELTA_BITPACKING[{}]", param);
+    }
+    case CompressionType::RUN_LENGTH_ENCODING: {
+        return stringFormat("RUN_LENGTH_ENCODING[{}]", uint64_t{1} << param);
+    }
+    case CompressionType::ALP: {
+        return stringFormat("ALP[{}]", uint64_t{1} << param);
+    }
     default: {
         KU_UNREACHABLE;
     }
@@ -553,6 +625,16 @@ uint64_t IntegerBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
         return Uncompressed(sizeof(T)).compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
             dstBufferSize, metadata);
     }
+    if constexpr (EncodedIntegerType<T>) {
+        if (metadata.compression == CompressionType::DELTA_BITPACKING) {
+            return DeltaBitpacking<T>().compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
+                dstBufferSize, metadata);
+        }
+        if (metadata.compression == CompressionType::RUN_LENGTH_ENCODING) {
+            return RunLengthEncoding<T>().compressNextPage(srcBuffer, numValuesRemaining,
+                dstBuffer, dstBufferSize, metadata);
+        }
+    }
     KU_ASSERT(metadata.compression == CompressionType::INTEGER_BITPACKING);
     auto info = getPackingInfo(metadata);
     auto bitWidth = info.bitWidth;
@@ -655,6 +737,482 @@ template class IntegerBitpacking<uint16_t>;
 template class IntegerBitpacking<uint32_t>;
 template class IntegerBitpacking<uint64_t>;
 
+template<EncodedIntegerType T>
+std::optional<CompressionMetadata> DeltaBitpacking<T>::analyze(std::span<const T> values,
+    StorageValue min, StorageValue max) {
+    U maxDelta = 0;
+    for (auto i = 1u; i < values.size(); i++) {
+        if (values[i] < values[i - 1]) {
+            return std::nullopt;
+        }
+        maxDelta = std::max(maxDelta, static_cast<U>(static_cast<U>(values[i]) -
+                                                      static_cast<U>(values[i - 1])));
+    }
+    // Values which are all the same use constant compression instead
+    if (maxDelta == 0) {
+        return std::nullopt;
+    }
+    return CompressionMetadata(min, max, CompressionType::DELTA_BITPACKING,
+        static_cast<uint8_t>(numeric_utils::bitWidth(maxDelta)));
+}
+
+template<EncodedIntegerType T>
+void DeltaBitpacking<T>::setValuesFromUncompressed(const uint8_t* /*srcBuffer*/,
+    offset_t srcOffset, uint8_t* /*dstBuffer*/, offset_t /*dstOffset*/, offset_t numValues,
+    const CompressionMetadata& /*metadata*/, const NullMask* nullMask) const {
+    // Only nulls are written in place (see CompressionMetadata::canUpdateInPlace), and the values
+    // stored for nulls don't matter.
+    KU_ASSERT(isAllNull(nullMask, srcOffset, numValues));
+    KU_UNUSED(srcOffset);
+    KU_UNUSED(numValues);
+    KU_UNUSED(nullMask);
+}
+
+template<EncodedIntegerType T>
+uint64_t DeltaBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const CompressionMetadata& metadata) const {
+    KU_ASSERT(metadata.compression == CompressionType::DELTA_BITPACKING);
+    static constexpr auto CHUNK_SIZE = IntegerBitpacking<T>::CHUNK_SIZE;
+    const auto bitWidth = metadata.param;
+    const auto numValuesToCompress =
+        std::min(numValuesRemaining, numValues(dstBufferSize, metadata));
+    const auto* src = reinterpret_cast<const U*>(srcBuffer);
+    auto* blockStart = dstBuffer;
+    U deltas[BLOCK_SIZE];
+    for (uint64_t blockStartIdx = 0; blockStartIdx < numValuesToCompress;
+         blockStartIdx += BLOCK_SIZE) {
+        const auto numValuesInBlock = std::min(BLOCK_SIZE, numValuesToCompress - blockStartIdx);
+        const uint64_t firstValue = src[blockStartIdx];
+        memcpy(blockStart, &firstValue, sizeof(firstValue));
+        deltas[0] = 0;
+        for (auto i = 1u; i < numValuesInBlock; i++) {
+            deltas[i] = static_cast<U>(src[blockStartIdx + i] - src[blockStartIdx + i - 1]);
+        }
+        // Pad the last block so that it can be packed in full chunks
+        std::fill(deltas + numValuesInBlock, deltas + BLOCK_SIZE, 0);
+        for (auto i = 0u; i < BLOCK_SIZE; i += CHUNK_SIZE) {
+            fastpack(deltas + i, blockStart + sizeof(uint64_t) + i * bitWidth / 8, bitWidth);
+        }
+        blockStart += getBlockSize(bitWidth);
+    }
+    srcBuffer += numValuesToCompress * sizeof(U);
+    return blockStart - dstBuffer;
+}
+
+template<EncodedIntegerType T>
+void DeltaBitpacking<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    static constexpr auto CHUNK_SIZE = IntegerBitpacking<T>::CHUNK_SIZE;
+    const auto bitWidth = metadata.param;
+    auto* dst = reinterpret_cast<U*>(dstBuffer) + dstOffset;
+    U block[BLOCK_SIZE];
+    for (auto pos = srcOffset; pos < srcOffset + numValues;) {
+        const auto posInBlock = pos % BLOCK_SIZE;
+        const auto numValuesToRead = std::min(BLOCK_SIZE - posInBlock, srcOffset + numValues - pos);
+        const auto endInBlock = posInBlock + numValuesToRead;
+        const auto* blockStart = srcBuffer + pos / BLOCK_SIZE * getBlockSize(bitWidth);
+        // Only the chunks up to the last value to read are needed for the prefix sum
+        for (auto i = 0u; i < endInBlock; i += CHUNK_SIZE) {
+            fastunpack(blockStart + sizeof(uint64_t) + i * bitWidth / 8, block + i, bitWidth);
+        }
+        uint64_t firstValue = 0;
+        memcpy(&firstValue, blockStart, sizeof(firstValue));
+        block[0] = static_cast<U>(firstValue);
+        for (auto i = 1u; i < endInBlock; i++) {
+            block[i] = static_cast<U>(block[i] + block[i - 1]);
+        }
+        memcpy(dst, block + posInBlock, numValuesToRead * sizeof(U));
+        dst += numValuesToRead;
+        pos += numValuesToRead;
+    }
+}
+
+template class DeltaBitpacking<int8_t>;
+template class DeltaBitpacking<int16_t>;
+template class DeltaBitpacking<int32_t>;
+template class DeltaBitpacking<int64_t>;
+template class DeltaBitpacking<uint8_t>;
+template class DeltaBitpacking<uint16_t>;
+template class DeltaBitpacking<uint32_t>;
+template class DeltaBitpacking<uint64_t>;
+
+template<EncodedIntegerType T>
+std::optional<CompressionMetadata> RunLengthEncoding<T>::analyze(std::span<const T> values,
+    StorageValue min, StorageValue max, uint64_t pageSize) {
+    std::vector<uint64_t> runStarts;
+    for (auto i = 1u; i < values.size(); i++) {
+        if (values[i] != values[i - 1]) {
+            runStarts.push_back(i);
+        }
+    }
+    // Use the largest page which fits all of its runs. Pages holding no more values than the
+    // maximum number of runs would be larger than uncompressed.
+    const auto maxNumRuns = getMaxNumRuns(pageSize);
+    for (auto log2 = MAX_LOG2_NUM_VALUES_PER_PAGE; (uint64_t{1} << log2) > maxNumRuns; log2--) {
+        const auto numValuesPerPage = uint64_t{1} << log2;
+        auto runStartIdx = 0u;
+        bool runsFit = true;
+        for (auto pageStart = 0ull; pageStart < values.size() && runsFit;
+             pageStart += numValuesPerPage) {
+            // The first run of a page starts at the start of the page
+            auto numRuns = 1u;
+            for (; runStartIdx < runStarts.size() &&
+                   runStarts[runStartIdx] < pageStart + numValuesPerPage;
+                 runStartIdx++) {
+                numRuns += runStarts[runStartIdx] > pageStart;
+            }
+            runsFit = numRuns <= maxNumRuns;
+        }
+        if (runsFit) {
+            return CompressionMetadata(min, max, CompressionType::RUN_LENGTH_ENCODING, log2);
+        }
+    }
+    return std::nullopt;
+}
+
+template<EncodedIntegerType T>
+void RunLengthEncoding<T>::setValuesFromUncompressed(const uint8_t* /*srcBuffer*/,
+    offset_t srcOffset, uint8_t* /*dstBuffer*/, offset_t /*dstOffset*/, offset_t numValues,
+    const CompressionMetadata& /*metadata*/, const NullMask* nullMask) const {
+    // Only nulls are written in place (see CompressionMetadata::canUpdateInPlace), and the values
+    // stored for nulls don't matter.
+    KU_ASSERT(isAllNull(nullMask, srcOffset, numValues));
+    KU_UNUSED(srcOffset);
+    KU_UNUSED(numValues);
+    KU_UNUSED(nullMask);
+}
+
+template<EncodedIntegerType T>
+uint64_t RunLengthEncoding<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const CompressionMetadata& metadata) const {
+    KU_ASSERT(metadata.compression == CompressionType::RUN_LENGTH_ENCODING);
+    const auto numValuesToCompress =
+        std::min(numValuesRemaining, numValues(dstBufferSize, metadata));
+    const auto* src = reinterpret_cast<const T*>(srcBuffer);
+    // The values are stored after the run ends, so the runs are counted first
+    uint64_t numRuns = 0;
+    for (auto i = 0u; i < numValuesToCompress; i++) {
+        numRuns += i + 1 == numValuesToCompress || src[i + 1] != src[i];
+    }
+    KU_ASSERT(numRuns <= getMaxNumRuns(dstBufferSize));
+    auto* runEnds = reinterpret_cast<run_end_t*>(dstBuffer);
+    runEnds[0] = static_cast<run_end_t>(numRuns);
+    runEnds++;
+    auto* runValues = reinterpret_cast<T*>(dstBuffer + getValuesStart(numRuns));
+    auto runIdx = 0u;
+    for (auto i = 0u; i < numValuesToCompress; i++) {
+        if (i + 1 == numValuesToCompress || src[i + 1] != src[i]) {
+            runEnds[runIdx] = static_cast<run_end_t>(i + 1);
+            runValues[runIdx] = src[i];
+            runIdx++;
+        }
+    }
+    srcBuffer += numValuesToCompress * sizeof(T);
+    return getValuesStart(numRuns) + numRuns * sizeof(T);
+}
+
+template<EncodedIntegerType T>
+void RunLengthEncoding<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& /*metadata*/) const {
+    const auto numRuns = reinterpret_cast<const run_end_t*>(srcBuffer)[0];
+    const auto* runEnds = reinterpret_cast<const run_end_t*>(srcBuffer) + 1;
+    const auto* runValues = reinterpret_cast<const T*>(srcBuffer + getValuesStart(numRuns));
+    auto runIdx = std::upper_bound(runEnds, runEnds + numRuns, srcOffset) - runEnds;
+    auto* dst = reinterpret_cast<T*>(dstBuffer) + dstOffset;
+    for (auto pos = srcOffset; pos < srcOffset + numValues; runIdx++) {
+        KU_ASSERT(runIdx < numRuns);
+        const auto end = std::min<uint64_t>(runEnds[runIdx], srcOffset + numValues);
+        std::fill(dst, dst + (end - pos), runValues[runIdx]);
+        dst += end - pos;
+        pos = end;
+    }
+}
+
+template class RunLengthEncoding<int8_t>;
+template class RunLengthEncoding<int16_t>;
+template class RunLengthEncoding<int32_t>;
+template class RunLengthEncoding<int64_t>;
+template class RunLengthEncoding<uint8_t>;
+template class RunLengthEncoding<uint16_t>;
+template class RunLengthEncoding<uint32_t>;
+template class RunLengthEncoding<uint64_t>;
+
+namespace {
+
+template<std::floating_point T>
+struct ALPConstants;
+
+template<>
+struct ALPConstants<double> {
+    static constexpr uint8_t MAX_EXPONENT = 18;
+    static constexpr double EXP10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+        1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+    static constexpr double FRAC10[] = {1e0, 1e-1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 1e-8, 1e-9,
+        1e-10, 1e-11, 1e-12, 1e-13, 1e-14, 1e-15, 1e-16, 1e-17, 1e-18};
+};
+
+template<>
+struct ALPConstants<float> {
+    static constexpr uint8_t MAX_EXPONENT = 10;
+    static constexpr float EXP10[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f,
+        1e10f};
+    static constexpr float FRAC10[] = {1e0f, 1e-1f, 1e-2f, 1e-3f, 1e-4f, 1e-5f, 1e-6f, 1e-7f, 1e-8f,
+        1e-9f, 1e-10f};
+};
+
+template<std::floating_point T>
+struct ALPEncoding {
+    // Larger values are stored as exceptions so that the conversion to int64_t can't overflow
+    static constexpr T MAX_ENCODED_VALUE = static_cast<T>(uint64_t{1} << 62);
+    using C = ALPConstants<T>;
+    using bits_t = std::conditional_t<sizeof(T) == sizeof(uint64_t), uint64_t, uint32_t>;
+
+    uint8_t exponent;
+    uint8_t factor;
+
+    // Returns false if the value can't be encoded losslessly
+    bool encode(T value, int64_t& encoded) const {
+        const T scaled = value * C::EXP10[exponent] * C::FRAC10[factor];
+        // Also false for NaN
+        if (!(std::abs(scaled) < MAX_ENCODED_VALUE)) {
+            return false;
+        }
+        encoded = static_cast<int64_t>(std::nearbyint(scaled));
+        return std::bit_cast<bits_t>(decode(encoded)) == std::bit_cast<bits_t>(value);
+    }
+
+    T decode(int64_t encoded) const {
+        return static_cast<T>(encoded) * C::EXP10[factor] * C::FRAC10[exponent];
+    }
+};
+
+struct ALPPageHeader {
+    int64_t frameOfReference;
+    uint16_t numExceptions;
+    uint8_t exponent;
+    uint8_t factor;
+    uint8_t bitWidth;
+    uint8_t _padding[3]{};
+};
+static_assert(sizeof(ALPPageHeader) == 16);
+
+// Pages are laid out as the header, the packed integers, the exception positions and the exception
+// values (aligned to their size)
+uint64_t getALPExceptionPositionsStart(uint64_t numValuesPerPage, uint8_t bitWidth) {
+    return sizeof(ALPPageHeader) + numValuesPerPage * bitWidth / 8;
+}
+
+template<std::floating_point T>
+uint64_t getALPExceptionValuesStart(uint64_t numValuesPerPage, const ALPPageHeader& header) {
+    const auto positionsEnd = getALPExceptionPositionsStart(numValuesPerPage, header.bitWidth) +
+                              header.numExceptions * sizeof(uint16_t);
+    return (positionsEnd + sizeof(T) - 1) / sizeof(T) * sizeof(T);
+}
+
+// Picks the exponent and factor which minimize the size of a sample of the values
+template<std::floating_point T>
+ALPEncoding<T> findBestALPEncoding(std::span<const T> values) {
+    static constexpr uint64_t NUM_SAMPLES = 32;
+    // An odd step keeps the samples from all falling on positions with the same parity, which
+    // would make periodic data look more compressible than it is
+    const auto step = (values.size() / NUM_SAMPLES) | 1;
+    ALPEncoding<T> bestEncoding{0, 0};
+    auto bestSize = std::numeric_limits<uint64_t>::max();
+    for (uint8_t exponent = 0; exponent <= ALPConstants<T>::MAX_EXPONENT; exponent++) {
+        for (uint8_t factor = 0; factor <= exponent; factor++) {
+            const ALPEncoding<T> encoding{exponent, factor};
+            uint64_t numSamples = 0, numExceptions = 0;
+            auto min = std::numeric_limits<int64_t>::max();
+            auto max = std::numeric_limits<int64_t>::min();
+            for (auto i = 0u; i < values.size(); i += step) {
+                numSamples++;
+                int64_t encoded = 0;
+                if (!encoding.encode(values[i], encoded)) {
+                    numExceptions++;
+                    continue;
+                }
+                min = std::min(min, encoded);
+                max = std::max(max, encoded);
+            }
+            const auto bitWidth = numExceptions == numSamples ?
+                                      0 :
+                                      std::bit_width(static_cast<uint64_t>(max) -
+                                                     static_cast<uint64_t>(min));
+            const auto size = numSamples * bitWidth +
+                              numExceptions * (sizeof(T) + sizeof(uint16_t)) * 8;
+            if (size < bestSize) {
+                bestSize = size;
+                bestEncoding = encoding;
+            }
+        }
+    }
+    return bestEncoding;
+}
+
+template<std::floating_point T>
+struct ALPPage {
+    ALPPageHeader header;
+    // Encoded values minus the frame of reference, padded to a multiple of the bitpacking chunk
+    std::vector<uint64_t> packedValues;
+    std::vector<uint16_t> exceptionPositions;
+    std::vector<T> exceptions;
+
+    void encode(std::span<const T> values) {
+        static constexpr auto CHUNK_SIZE = IntegerBitpacking<uint64_t>::CHUNK_SIZE;
+        const auto encoding = findBestALPEncoding(values);
+        packedValues.assign((values.size() + CHUNK_SIZE - 1) / CHUNK_SIZE * CHUNK_SIZE, 0);
+        exceptionPositions.clear();
+        exceptions.clear();
+        auto min = std::numeric_limits<int64_t>::max();
+        auto max = std::numeric_limits<int64_t>::min();
+        for (auto i = 0u; i < values.size(); i++) {
+            int64_t encoded = 0;
+            if (!encoding.encode(values[i], encoded)) {
+                exceptionPositions.push_back(static_cast<uint16_t>(i));
+                exceptions.push_back(values[i]);
+                continue;
+            }
+            packedValues[i] = static_cast<uint64_t>(encoded);
+            min = std::min(min, encoded);
+            max = std::max(max, encoded);
+        }
+        if (exceptions.size() == values.size()) {
+            min = max = 0;
+        }
+        // Exceptions (and the padding) are stored as zero deltas so that they don't widen the
+        // packed values
+        for (const auto pos : exceptionPositions) {
+            packedValues[pos] = static_cast<uint64_t>(min);
+        }
+        for (auto i = 0u; i < values.size(); i++) {
+            packedValues[i] -= static_cast<uint64_t>(min);
+        }
+        header = ALPPageHeader{min, static_cast<uint16_t>(exceptions.size()), encoding.exponent,
+            encoding.factor,
+            static_cast<uint8_t>(
+                std::bit_width(static_cast<uint64_t>(max) - static_cast<uint64_t>(min)))};
+    }
+
+    uint64_t getSize(uint64_t numValuesPerPage) const {
+        return getALPExceptionValuesStart<T>(numValuesPerPage, header) +
+               exceptions.size() * sizeof(T);
+    }
+
+    void write(uint8_t* dst, uint64_t numValuesPerPage) const {
+        static constexpr auto CHUNK_SIZE = IntegerBitpacking<uint64_t>::CHUNK_SIZE;
+        KU_ASSERT(packedValues.size() <= numValuesPerPage);
+        memcpy(dst, &header, sizeof(header));
+        for (auto i = 0u; i < packedValues.size(); i += CHUNK_SIZE) {
+            fastpack(packedValues.data() + i, dst + sizeof(header) + i * header.bitWidth / 8,
+                header.bitWidth);
+        }
+        memcpy(dst + getALPExceptionPositionsStart(numValuesPerPage, header.bitWidth),
+            exceptionPositions.data(), exceptionPositions.size() * sizeof(uint16_t));
+        memcpy(dst + getALPExceptionValuesStart<T>(numValuesPerPage, header), exceptions.data(),
+            exceptions.size() * sizeof(T));
+    }
+};
+
+} // namespace
+
+template<std::floating_point T>
+std::optional<CompressionMetadata> FloatCompression<T>::analyze(std::span<const T> values,
+    StorageValue min, StorageValue max, uint64_t pageSize) {
+    ALPPage<T> page;
+    // Use the largest page size for which every page fits. Pages holding no more values than an
+    // uncompressed page would be no smaller than uncompressed.
+    for (auto log2 = MAX_LOG2_NUM_VALUES_PER_PAGE; (uint64_t{1} << log2) > pageSize / sizeof(T);
+         log2--) {
+        const auto numValuesPerPage = uint64_t{1} << log2;
+        bool pagesFit = true;
+        for (auto pageStart = 0ull; pageStart < values.size() && pagesFit;
+             pageStart += numValuesPerPage) {
+            page.encode(values.subspan(pageStart,
+                std::min<uint64_t>(numValuesPerPage, values.size() - pageStart)));
+            pagesFit = page.getSize(numValuesPerPage) <= pageSize;
+        }
+        if (pagesFit) {
+            return CompressionMetadata(min, max, CompressionType::ALP, log2);
+        }
+    }
+    return std::nullopt;
+}
+
+template<std::floating_point T>
+void FloatCompression<T>::setValuesFromUncompressed(const uint8_t* /*srcBuffer*/,
+    offset_t srcOffset, uint8_t* /*dstBuffer*/, offset_t /*dstOffset*/, offset_t numValues,
+    const CompressionMetadata& /*metadata*/, const NullMask* nullMask) const {
+    // Only nulls are written in place (see CompressionMetadata::canUpdateInPlace), and the values
+    // stored for nulls don't matter.
+    KU_ASSERT(isAllNull(nullMask, srcOffset, numValues));
+    KU_UNUSED(srcOffset);
+    KU_UNUSED(numValues);
+    KU_UNUSED(nullMask);
+}
+
+template<std::floating_point T>
+uint64_t FloatCompression<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const CompressionMetadata& metadata) const {
+    // Chunks whose values don't compress well are stored uncompressed
+    if (metadata.compression == CompressionType::UNCOMPRESSED) {
+        return Uncompressed(sizeof(T)).compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
+            dstBufferSize, metadata);
+    }
+    KU_ASSERT(metadata.compression == CompressionType::ALP);
+    const auto numValuesPerPage = numValues(dstBufferSize, metadata);
+    const auto numValuesToCompress = std::min(numValuesRemaining, numValuesPerPage);
+    ALPPage<T> page;
+    page.encode(std::span(reinterpret_cast<const T*>(srcBuffer), numValuesToCompress));
+    KU_ASSERT(page.getSize(numValuesPerPage) <= dstBufferSize);
+    page.write(dstBuffer, numValuesPerPage);
+    srcBuffer += numValuesToCompress * sizeof(T);
+    return page.getSize(numValuesPerPage);
+}
+
+template<std::floating_point T>
+void FloatCompression<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    static constexpr auto CHUNK_SIZE = IntegerBitpacking<uint64_t>::CHUNK_SIZE;
+    ALPPageHeader header;
+    memcpy(&header, srcBuffer, sizeof(header));
+    const ALPEncoding<T> encoding{header.exponent, header.factor};
+    const auto frameOfReference = static_cast<uint64_t>(header.frameOfReference);
+    auto* dst = reinterpret_cast<T*>(dstBuffer) + dstOffset;
+    const auto end = srcOffset + numValues;
+    uint64_t chunk[CHUNK_SIZE];
+    for (auto chunkStart = srcOffset / CHUNK_SIZE * CHUNK_SIZE; chunkStart < end;
+         chunkStart += CHUNK_SIZE) {
+        fastunpack(srcBuffer + sizeof(header) + chunkStart * header.bitWidth / 8, chunk,
+            header.bitWidth);
+        const auto startInChunk = std::max(chunkStart, srcOffset) - chunkStart;
+        const auto endInChunk = std::min(chunkStart + CHUNK_SIZE, end) - chunkStart;
+        // Branch-free so that the compiler can vectorize it; exceptions are patched afterwards
+        for (auto i = startInChunk; i < endInChunk; i++) {
+            dst[chunkStart + i - srcOffset] =
+                encoding.decode(static_cast<int64_t>(chunk[i] + frameOfReference));
+        }
+    }
+    const auto numValuesPerPage = uint64_t{1} << metadata.param;
+    const auto* positions = reinterpret_cast<const uint16_t*>(
+        srcBuffer + getALPExceptionPositionsStart(numValuesPerPage, header.bitWidth));
+    const auto* exceptions = reinterpret_cast<const T*>(
+        srcBuffer + getALPExceptionValuesStart<T>(numValuesPerPage, header));
+    for (auto idx = std::lower_bound(positions, positions + header.numExceptions, srcOffset) -
+                    positions;
+         idx < header.numExceptions && positions[idx] < end; idx++) {
+        dst[positions[idx] - srcOffset] = exceptions[idx];
+    }
+}
+
+template class FloatCompression<float>;
+template class FloatCompression<double>;
+
 void BooleanBitpacking::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
     uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues,
     const CompressionMetadata& /*metadata*/, const NullMask* /*nullMask*/) const {
@@ -749,6 +1307,13 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::RUN_LENGTH_ENCODING:
+    case CompressionType::ALP:
+        return visitEncodingAlg(metadata.compression, physicalType, [&](const auto& alg) {
+            alg.decompressFromPage(frame, pageCursor.elemPosInPage, resultVector->getData(),
+                posInVector, numValuesToRead, metadata);
+        });
     default:
         KU_UNREACHABLE;
     }
@@ -813,6 +1378,13 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         // Reading into ColumnChunks should be done without decompressing for booleans
         return booleanBitpacking.copyFromPage(frame, pageCursor.elemPosInPage, result,
             startPosInResult, numValuesToRead, metadata);
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::RUN_LENGTH_ENCODING:
+    case CompressionType::ALP:
+        return visitEncodingAlg(metadata.compression, physicalType, [&](const auto& alg) {
+            alg.decompressFromPage(frame, pageCursor.elemPosInPage, result, startPosInResult,
+                numValuesToRead, metadata);
+        });
     default:
         KU_UNREACHABLE;
     }
@@ -848,6 +1420,13 @@ void WriteCompressedValuesToPage::operator()(uint8_t* frame, uint16_t posInFrame
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.copyFromPage(data, dataOffset, frame, posInFrame, numValues,
             metadata);
+    case CompressionType::DELTA_BITPACKING:
+    case CompressionType::RUN_LENGTH_ENCODING:
+    case CompressionType::ALP:
+        return visitEncodingAlg(metadata.compression, physicalType, [&](const auto& alg) {
+            alg.setValuesFromUncompressed(data, dataOffset, frame, posInFrame, numValues,
+                metadata, nullMask);
+        });
 
     default:
         KU_UNREACHABLE;
@@ -911,23 +1490,29 @@ std::pair<std::optional<StorageValue>, std::optional<StorageValue>> getMinMaxSto
         [&](bool) {
             if (numValues > 0) {
                 auto boolData = reinterpret_cast<const uint64_t*>(data);
-                if (!nullMask || nullMask->hasNoNullsGuarantee()) {
-                    auto [minRaw, maxRaw] = NullMask::getMinMax(boolData, numValues);
+                const auto noNulls = !nullMask || nullMask->hasNoNullsGuarantee();
+                if (noNulls && offset % NullMask::NUM_BITS_PER_NULL_ENTRY == 0) {
+                    auto [minRaw, maxRaw] = NullMask::getMinMax(
+                        boolData + (offset >> NullMask::NUM_BITS_PER_NULL_ENTRY_LOG2), numValues);
                     returnValue = std::make_pair(std::optional(StorageValue(minRaw)),
                         std::optional(StorageValue(maxRaw)));
                 } else {
-                    std::optional<StorageValue> min, max;
-                    for (size_t i = 0; i < numValues; i++) {
-                        if (!nullMask || !nullMask->isNull(i)) {
+                    std::optional<bool> min, max;
+                    for (size_t i = offset; i < offset + numValues; i++) {
+                        if (noNulls || !nullMask->isNull(i)) {
                             auto boolValue = NullMask::isNull(boolData, i);
-                            if (!max || boolValue > max->get<bool>()) {
-                                returnValue.first = boolValue;
+                            if (!min || boolValue < *min) {
+                                min = boolValue;
                             }
-                            if (!min || boolValue < min->get<bool>()) {
-                                returnValue.second = boolValue;
+                            if (!max || boolValue > *max) {
+                                max = boolValue;
                             }
                         }
                     }
+                    if (min) {
+                        returnValue = std::make_pair(std::optional(StorageValue(*min)),
+                            std::optional(StorageValue(*max)));
+                    }
                 }
             }
         },
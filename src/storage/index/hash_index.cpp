@@ -508,6 +508,43 @@ bool PrimaryKeyIndex::lookup(const Transaction* trx, common::ValueVector* keyVec
     return retVal;
 }
 
+void PrimaryKeyIndex::lookup(const Transaction* trx, const common::ValueVector& keyVector,
+    common::offset_t* offsets, visible_func isVisible) {
+    const auto& selVector = keyVector.state->getSelVector();
+    TypeUtils::visit(
+        keyDataTypeID,
+        [&]<IndexHashable T>(T) {
+            using HashIndexT = HashIndex<HashIndexType<T>>;
+            using Key = typename HashIndexT::Key;
+            std::array<std::vector<Key>, NUM_HASH_INDEXES> keys;
+            std::array<std::vector<sel_t>, NUM_HASH_INDEXES> keyPositions;
+            for (auto i = 0u; i < selVector.getSelSize(); i++) {
+                Key key;
+                if constexpr (std::same_as<T, ku_string_t>) {
+                    key = keyVector.getValue<ku_string_t>(selVector[i]).getAsStringView();
+                } else {
+                    key = keyVector.getValue<T>(selVector[i]);
+                }
+                const auto indexPos = HashIndexUtils::getHashIndexPosition(key);
+                keys[indexPos].push_back(key);
+                keyPositions[indexPos].push_back(i);
+            }
+            std::vector<offset_t> results;
+            for (auto indexPos = 0u; indexPos < NUM_HASH_INDEXES; indexPos++) {
+                if (keys[indexPos].empty()) {
+                    continue;
+                }
+                results.resize(keys[indexPos].size());
+                getTypedHashIndexByPos<HashIndexType<T>>(indexPos)->lookupInternal(trx,
+                    keys[indexPos], results, isVisible);
+                for (auto i = 0u; i < results.size(); i++) {
+                    offsets[keyPositions[indexPos][i]] = results[i];
+                }
+            }
+        },
+        [](auto) { KU_UNREACHABLE; });
+}
+
 bool PrimaryKeyIndex::insert(const Transaction* transaction, common::ValueVector* keyVector,
     uint64_t vectorPos, common::offset_t value, visible_func isVisible) {
     bool result = false;
@@ -97,7 +97,7 @@ bool LocalNodeTable::delete_(Transaction* transaction, TableDeleteState& deleteS
 }
 
 bool LocalNodeTable::addColumn(Transaction* transaction, TableAddColumnState& addColumnState) {
-    nodeGroups.addColumn(transaction, addColumnState);
+    nodeGroups.addColumn(transaction, addColumnState, nullptr /* newColumnStats */);
     return true;
 }
 
@@ -114,8 +114,8 @@ void LocalNodeTable::clear() {
 }
 
 bool LocalNodeTable::lookupPK(const Transaction* transaction, const ValueVector* keyVector,
-    offset_t& result) {
-    result = hashIndex->lookup(*keyVector,
+    sel_t pos, offset_t& result) {
+    result = hashIndex->lookup(*keyVector, pos,
         [&](offset_t offset) { return isVisible(transaction, offset); });
     return result != INVALID_OFFSET;
 }
@@ -121,7 +121,8 @@ bool LocalRelTable::delete_(Transaction*, TableDeleteState& state) {
 }
 
 bool LocalRelTable::addColumn(Transaction* transaction, TableAddColumnState& addColumnState) {
-    localNodeGroup->addColumn(transaction, addColumnState, nullptr /* BMFileHandle */);
+    localNodeGroup->addColumn(transaction, addColumnState, nullptr /* BMFileHandle */,
+        nullptr /* newColumnStats */);
     return true;
 }
 
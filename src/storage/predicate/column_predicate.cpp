@@ -1,7 +1,12 @@
 #include "storage/predicate/column_predicate.h"
 
+#include "binder/expression/function_expression.h"
 #include "binder/expression/literal_expression.h"
+#include "common/types/value/nested.h"
+#include "function/list/vector_list_functions.h"
 #include "storage/predicate/constant_predicate.h"
+#include "storage/predicate/in_list_predicate.h"
+#include "storage/predicate/null_predicate.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::common;
@@ -9,9 +14,9 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace storage {
 
-ZoneMapCheckResult ColumnPredicateSet::checkZoneMap(const CompressionMetadata& metadata) {
+ZoneMapCheckResult ColumnPredicateSet::checkZoneMap(const ZoneMap& zoneMap) const {
     for (auto& predicate : predicates) {
-        if (predicate->checkZoneMap(metadata) == ZoneMapCheckResult::SKIP_SCAN) {
+        if (predicate->checkZoneMap(zoneMap) == ZoneMapCheckResult::SKIP_SCAN) {
             return ZoneMapCheckResult::SKIP_SCAN;
         }
     }
@@ -31,6 +36,10 @@ static bool isPropertyConstantPair(const Expression& left, const Expression& rig
 
 static std::unique_ptr<ColumnPredicate> tryConvertToConstColumnPredicate(const Expression& property,
     const Expression& predicate) {
+    // Zone maps hold values of the column's physical type, so the constant must share its type.
+    if (predicate.getChild(0)->getDataType() != predicate.getChild(1)->getDataType()) {
+        return nullptr;
+    }
     if (isPropertyConstantPair(*predicate.getChild(0), *predicate.getChild(1))) {
         if (property != *predicate.getChild(0)) {
             return nullptr;
@@ -50,12 +59,52 @@ static std::unique_ptr<ColumnPredicate> tryConvertToConstColumnPredicate(const E
     return nullptr;
 }
 
+static std::unique_ptr<ColumnPredicate> tryConvertToNullColumnPredicate(const Expression& property,
+    const Expression& predicate) {
+    if (property != *predicate.getChild(0)) {
+        return nullptr;
+    }
+    return std::make_unique<ColumnNullPredicate>(predicate.expressionType);
+}
+
+static std::unique_ptr<ColumnPredicate> tryConvertToInListColumnPredicate(
+    const Expression& property, const Expression& predicate) {
+    if (predicate.constCast<ScalarFunctionExpression>().getFunctionName() !=
+        function::ListContainsFunction::name) {
+        return nullptr;
+    }
+    // `property IN [...]` is bound as LIST_CONTAINS(list, property).
+    auto& list = *predicate.getChild(0);
+    if (list.expressionType != ExpressionType::LITERAL || property != *predicate.getChild(1) ||
+        list.getDataType().getLogicalTypeID() != LogicalTypeID::LIST ||
+        ListType::getChildType(list.getDataType()) != property.getDataType()) {
+        return nullptr;
+    }
+    auto listValue = list.constCast<LiteralExpression>().getValue();
+    if (listValue.isNull()) {
+        return nullptr;
+    }
+    std::vector<Value> values;
+    for (auto i = 0u; i < NestedVal::getChildrenSize(&listValue); i++) {
+        values.push_back(*NestedVal::getChildVal(&listValue, i));
+    }
+    return std::make_unique<ColumnInListPredicate>(std::move(values));
+}
+
 std::unique_ptr<ColumnPredicate> ColumnPredicateUtil::tryConvert(const Expression& property,
     const Expression& predicate) {
     if (ExpressionTypeUtil::isComparison(predicate.expressionType)) {
         return tryConvertToConstColumnPredicate(property, predicate);
     }
-    return nullptr;
+    switch (predicate.expressionType) {
+    case ExpressionType::IS_NULL:
+    case ExpressionType::IS_NOT_NULL:
+        return tryConvertToNullColumnPredicate(property, predicate);
+    case ExpressionType::FUNCTION:
+        return tryConvertToInListColumnPredicate(property, predicate);
+    default:
+        return nullptr;
+    }
 }
 
 } // namespace storage
@@ -1,8 +1,10 @@
 #include "storage/predicate/constant_predicate.h"
 
+#include <cmath>
+
 #include "common/type_utils.h"
 #include "function/comparison/comparison_functions.h"
-#include "storage/compression/compression.h"
+#include "storage/store/zone_map.h"
 
 using namespace kuzu::common;
 using namespace kuzu::function;
@@ -18,11 +20,26 @@ bool inRange(T min, T max, T val) {
 }
 
 template<typename T>
-ZoneMapCheckResult checkZoneMapSwitch(const CompressionMetadata& metadata,
-    ExpressionType expressionType, const Value& value) {
-    auto max = metadata.max.get<T>();
-    auto min = metadata.min.get<T>();
+ZoneMapCheckResult checkZoneMapSwitch(const ZoneMap& zoneMap, ExpressionType expressionType,
+    const Value& value) {
+    auto max = zoneMap.max.get<T>();
+    auto min = zoneMap.min.get<T>();
     auto constant = value.getValue<T>();
+    if constexpr (std::floating_point<T>) {
+        // NaNs are not reflected in min/max, and LESS_THAN is evaluated as !GREATER_THAN_EQUALS,
+        // so a NaN may satisfy the predicates below even if min/max suggest nothing can.
+        if (std::isnan(min) || std::isnan(max) || std::isnan(constant)) {
+            return ZoneMapCheckResult::ALWAYS_SCAN;
+        }
+        switch (expressionType) {
+        case ExpressionType::NOT_EQUALS:
+        case ExpressionType::LESS_THAN:
+        case ExpressionType::LESS_THAN_EQUALS:
+            return ZoneMapCheckResult::ALWAYS_SCAN;
+        default:
+            break;
+        }
+    }
     switch (expressionType) {
     case ExpressionType::EQUALS: {
         if (!inRange<T>(min, max, constant)) {
@@ -60,13 +77,19 @@ ZoneMapCheckResult checkZoneMapSwitch(const CompressionMetadata& metadata,
     return ZoneMapCheckResult::ALWAYS_SCAN;
 }
 
-ZoneMapCheckResult ColumnConstantPredicate::checkZoneMap(
-    const CompressionMetadata& metadata) const {
+ZoneMapCheckResult ColumnConstantPredicate::checkZoneMap(const ZoneMap& zoneMap) const {
+    if (value.isNull()) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    // A comparison is never true for null values.
+    if (!zoneMap.hasNonNullValues) {
+        return ZoneMapCheckResult::SKIP_SCAN;
+    }
     auto physicalType = value.getDataType().getPhysicalType();
     return TypeUtils::visit(
         physicalType,
         [&]<StorageValueType T>(
-            T) { return checkZoneMapSwitch<T>(metadata, expressionType, value); },
+            T) { return checkZoneMapSwitch<T>(zoneMap, expressionType, value); },
         [&](auto) { return ZoneMapCheckResult::ALWAYS_SCAN; });
 }
 
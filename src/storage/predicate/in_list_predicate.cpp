@@ -0,0 +1,58 @@
+#include "storage/predicate/in_list_predicate.h"
+
+#include <cmath>
+
+#include "common/type_utils.h"
+#include "function/comparison/comparison_functions.h"
+#include "storage/store/zone_map.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function;
+
+namespace kuzu {
+namespace storage {
+
+template<typename T>
+static ZoneMapCheckResult checkInList(const ZoneMap& zoneMap, const std::vector<Value>& values) {
+    auto min = zoneMap.min.get<T>();
+    auto max = zoneMap.max.get<T>();
+    if constexpr (std::floating_point<T>) {
+        if (std::isnan(min) || std::isnan(max)) {
+            return ZoneMapCheckResult::ALWAYS_SCAN;
+        }
+    }
+    for (auto& value : values) {
+        if (value.isNull()) {
+            continue;
+        }
+        auto constant = value.getValue<T>();
+        if constexpr (std::floating_point<T>) {
+            if (std::isnan(constant)) {
+                return ZoneMapCheckResult::ALWAYS_SCAN;
+            }
+        }
+        if (GreaterThanEquals::operation<T>(constant, min) &&
+            LessThanEquals::operation<T>(constant, max)) {
+            return ZoneMapCheckResult::ALWAYS_SCAN;
+        }
+    }
+    return ZoneMapCheckResult::SKIP_SCAN;
+}
+
+ZoneMapCheckResult ColumnInListPredicate::checkZoneMap(const ZoneMap& zoneMap) const {
+    // Null values are never contained in a list.
+    if (!zoneMap.hasNonNullValues) {
+        return ZoneMapCheckResult::SKIP_SCAN;
+    }
+    if (values.empty()) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    auto physicalType = values[0].getDataType().getPhysicalType();
+    return TypeUtils::visit(
+        physicalType,
+        [&]<StorageValueType T>(T) { return checkInList<T>(zoneMap, values); },
+        [&](auto) { return ZoneMapCheckResult::ALWAYS_SCAN; });
+}
+
+} // namespace storage
+} // namespace kuzu
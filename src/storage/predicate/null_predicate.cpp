@@ -0,0 +1,17 @@
+#include "storage/predicate/null_predicate.h"
+
+#include "storage/store/zone_map.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+ZoneMapCheckResult ColumnNullPredicate::checkZoneMap(const ZoneMap& zoneMap) const {
+    const auto canSkip = expressionType == ExpressionType::IS_NULL ? !zoneMap.hasNulls :
+                                                                     !zoneMap.hasNonNullValues;
+    return canSkip ? ZoneMapCheckResult::SKIP_SCAN : ZoneMapCheckResult::ALWAYS_SCAN;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,139 @@
+#include "storage/stats/column_stats.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/type_utils.h"
+#include "function/hash/hash_functions.h"
+#include "storage/store/column_chunk_data.h"
+#include "storage/store/string_chunk_data.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+bool ColumnStats::hasDistinctCount(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::INTERNAL_ID:
+    case PhysicalTypeID::LIST:
+    case PhysicalTypeID::ARRAY:
+    case PhysicalTypeID::STRUCT:
+    case PhysicalTypeID::ANY:
+    case PhysicalTypeID::POINTER:
+        return false;
+    default:
+        return true;
+    }
+}
+
+bool ColumnStats::hasHistogram(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::BOOL:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ColumnStats::update(const ColumnChunkData& chunk, offset_t startOffset,
+    length_t numValuesToUpdate) {
+    const auto physicalType = chunk.getDataType().getPhysicalType();
+    numValues += numValuesToUpdate;
+    if (!hasDistinctCount(physicalType)) {
+        for (auto pos = startOffset; pos < startOffset + numValuesToUpdate; pos++) {
+            numNulls += chunk.isNull(pos);
+        }
+        return;
+    }
+    const auto sampleStep =
+        std::max<uint64_t>(1, numValuesToUpdate / NUM_SAMPLED_VALUES_PER_CHUNK);
+    std::vector<double> sample;
+    uint64_t numNonNullValues = 0;
+    TypeUtils::visit(
+        physicalType,
+        [&](ku_string_t) {
+            const auto& stringChunk = chunk.cast<StringChunkData>();
+            for (auto pos = startOffset; pos < startOffset + numValuesToUpdate; pos++) {
+                if (chunk.isNull(pos)) {
+                    numNulls++;
+                    continue;
+                }
+                hash_t hash = 0;
+                function::Hash::operation(stringChunk.getValue<std::string_view>(pos), hash);
+                hll.insertHash(hash);
+            }
+        },
+        [&]<typename T>(T) {
+            for (auto pos = startOffset; pos < startOffset + numValuesToUpdate; pos++) {
+                if (chunk.isNull(pos)) {
+                    numNulls++;
+                    continue;
+                }
+                const auto value = chunk.getValue<T>(pos);
+                hash_t hash = 0;
+                function::Hash::operation(value, hash);
+                hll.insertHash(hash);
+                if constexpr (std::is_arithmetic_v<T>) {
+                    if (numNonNullValues++ % sampleStep == 0 &&
+                        std::isfinite(static_cast<double>(value))) {
+                        sample.push_back(static_cast<double>(value));
+                    }
+                }
+            }
+        });
+    if (hasHistogram(physicalType)) {
+        histogram.merge(EquiDepthHistogram::build(std::move(sample), numNonNullValues));
+    }
+}
+
+void ColumnStats::merge(const ColumnStats& other) {
+    numValues += other.numValues;
+    numNulls += other.numNulls;
+    hll.merge(other.hll);
+    histogram.merge(other.histogram);
+}
+
+uint64_t ColumnStats::getNumDistinctValues() const {
+    const auto numNonNullValues = numValues - numNulls;
+    if (numNonNullValues == 0) {
+        return 0;
+    }
+    return std::clamp<uint64_t>(hll.count(), 1, numNonNullValues);
+}
+
+void ColumnStats::serialize(Serializer& serializer) const {
+    serializer.writeDebuggingInfo("num_values");
+    serializer.write<uint64_t>(numValues);
+    serializer.writeDebuggingInfo("num_nulls");
+    serializer.write<uint64_t>(numNulls);
+    hll.serialize(serializer);
+    histogram.serialize(serializer);
+}
+
+ColumnStats ColumnStats::deserialize(Deserializer& deserializer) {
+    std::string key;
+    ColumnStats result;
+    deserializer.validateDebuggingInfo(key, "num_values");
+    deserializer.deserializeValue<uint64_t>(result.numValues);
+    deserializer.validateDebuggingInfo(key, "num_nulls");
+    deserializer.deserializeValue<uint64_t>(result.numNulls);
+    result.hll = HyperLogLog::deserialize(deserializer);
+    result.histogram = EquiDepthHistogram::deserialize(deserializer);
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -0,0 +1,151 @@
+#include "storage/stats/equi_depth_histogram.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "common/assert.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+EquiDepthHistogram EquiDepthHistogram::build(std::vector<double> sample, uint64_t numValues) {
+    EquiDepthHistogram result;
+    if (sample.empty() || numValues == 0) {
+        return result;
+    }
+    std::sort(sample.begin(), sample.end());
+    const auto numBuckets = std::clamp<uint64_t>(sample.size() - 1, 1, MAX_NUM_BUCKETS);
+    result.numValues = numValues;
+    result.bounds.resize(numBuckets + 1);
+    for (auto i = 0u; i <= numBuckets; i++) {
+        result.bounds[i] = sample[i * (sample.size() - 1) / numBuckets];
+    }
+    return result;
+}
+
+void EquiDepthHistogram::merge(const EquiDepthHistogram& other) {
+    if (other.isEmpty()) {
+        return;
+    }
+    if (isEmpty()) {
+        *this = other;
+        return;
+    }
+    // The distribution of the merged values is the weighted sum of both distributions, which is
+    // linear between any two consecutive bounds of either histogram. The new bounds are its
+    // quantiles, interpolated between those points.
+    const auto totalNumValues = numValues + other.numValues;
+    const auto weight = static_cast<double>(numValues) / static_cast<double>(totalNumValues);
+    std::vector<double> points;
+    points.reserve(bounds.size() + other.bounds.size());
+    std::merge(bounds.begin(), bounds.end(), other.bounds.begin(), other.bounds.end(),
+        std::back_inserter(points));
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    std::vector<double> fractionsLessThan(points.size());
+    std::vector<double> fractionsLessThanOrEqual(points.size());
+    for (auto i = 0u; i < points.size(); i++) {
+        fractionsLessThan[i] = weight * getFractionLessThan(points[i]) +
+                               (1 - weight) * other.getFractionLessThan(points[i]);
+        fractionsLessThanOrEqual[i] = weight * getFractionLessThanOrEqual(points[i]) +
+                                      (1 - weight) * other.getFractionLessThanOrEqual(points[i]);
+    }
+    const auto numPoints = static_cast<uint64_t>(points.size());
+    const auto numBuckets = std::clamp<uint64_t>(
+        std::max({getNumBuckets(), other.getNumBuckets(), numPoints - 1}), 1, MAX_NUM_BUCKETS);
+    std::vector<double> newBounds(numBuckets + 1);
+    newBounds.front() = points.front();
+    newBounds.back() = points.back();
+    auto pointIdx = 0u;
+    for (auto i = 1u; i < numBuckets; i++) {
+        const auto quantile = static_cast<double>(i) / static_cast<double>(numBuckets);
+        while (pointIdx + 1 < points.size() && fractionsLessThanOrEqual[pointIdx] < quantile) {
+            pointIdx++;
+        }
+        if (pointIdx > 0 && fractionsLessThan[pointIdx] >= quantile) {
+            // The quantile falls strictly between two points.
+            const auto prevPoint = points[pointIdx - 1];
+            const auto prevFraction = fractionsLessThanOrEqual[pointIdx - 1];
+            newBounds[i] = prevPoint + (quantile - prevFraction) /
+                                           (fractionsLessThan[pointIdx] - prevFraction) *
+                                           (points[pointIdx] - prevPoint);
+        } else {
+            // The quantile falls on a point repeated by a zero-width bucket.
+            newBounds[i] = points[pointIdx];
+        }
+    }
+    numValues = totalNumValues;
+    bounds = std::move(newBounds);
+}
+
+double EquiDepthHistogram::getFractionLessThan(double value) const {
+    KU_ASSERT(!isEmpty());
+    const auto idx = std::lower_bound(bounds.begin(), bounds.end(), value) - bounds.begin();
+    if (idx == 0) {
+        return 0;
+    }
+    if (idx > static_cast<int64_t>(getNumBuckets())) {
+        return 1;
+    }
+    // bounds[idx - 1] < value <= bounds[idx].
+    const auto low = bounds[idx - 1], high = bounds[idx];
+    return (static_cast<double>(idx - 1) + (value - low) / (high - low)) /
+           static_cast<double>(getNumBuckets());
+}
+
+double EquiDepthHistogram::getFractionLessThanOrEqual(double value) const {
+    KU_ASSERT(!isEmpty());
+    const auto idx = std::upper_bound(bounds.begin(), bounds.end(), value) - bounds.begin();
+    if (idx == 0) {
+        return 0;
+    }
+    if (idx > static_cast<int64_t>(getNumBuckets())) {
+        return 1;
+    }
+    // bounds[idx - 1] <= value < bounds[idx].
+    const auto low = bounds[idx - 1], high = bounds[idx];
+    return (static_cast<double>(idx - 1) + (value - low) / (high - low)) /
+           static_cast<double>(getNumBuckets());
+}
+
+double EquiDepthHistogram::getMean() const {
+    KU_ASSERT(!isEmpty());
+    double sum = 0;
+    for (auto i = 0u; i < getNumBuckets(); i++) {
+        sum += (bounds[i] + bounds[i + 1]) / 2;
+    }
+    return sum / static_cast<double>(getNumBuckets());
+}
+
+double EquiDepthHistogram::getMeanOfSquares() const {
+    KU_ASSERT(!isEmpty());
+    double sum = 0;
+    for (auto i = 0u; i < getNumBuckets(); i++) {
+        const auto low = bounds[i], high = bounds[i + 1];
+        sum += (low * low + low * high + high * high) / 3;
+    }
+    return sum / static_cast<double>(getNumBuckets());
+}
+
+void EquiDepthHistogram::serialize(Serializer& serializer) const {
+    serializer.writeDebuggingInfo("num_values");
+    serializer.write<uint64_t>(numValues);
+    serializer.writeDebuggingInfo("bounds");
+    serializer.serializeVector(bounds);
+}
+
+EquiDepthHistogram EquiDepthHistogram::deserialize(Deserializer& deserializer) {
+    std::string key;
+    EquiDepthHistogram result;
+    deserializer.validateDebuggingInfo(key, "num_values");
+    deserializer.deserializeValue<uint64_t>(result.numValues);
+    deserializer.validateDebuggingInfo(key, "bounds");
+    deserializer.deserializeVector(result.bounds);
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
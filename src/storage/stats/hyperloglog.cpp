@@ -0,0 +1,64 @@
+#include "storage/stats/hyperloglog.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+void HyperLogLog::insertHash(hash_t hash) {
+    const auto registerIdx = hash >> (64 - PRECISION);
+    // Position of the leftmost 1-bit in the remaining bits. The sentinel bit caps the rank when
+    // all remaining bits are zero.
+    const auto remainingBits = (hash << PRECISION) | (1ull << (PRECISION - 1));
+    const auto rank = static_cast<uint8_t>(std::countl_zero(remainingBits) + 1);
+    if (rank > registers[registerIdx]) {
+        registers[registerIdx] = rank;
+    }
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+    for (auto i = 0u; i < NUM_REGISTERS; i++) {
+        registers[i] = std::max(registers[i], other.registers[i]);
+    }
+}
+
+uint64_t HyperLogLog::count() const {
+    constexpr double numRegisters = NUM_REGISTERS;
+    constexpr double alpha = 0.7213 / (1.0 + 1.079 / numRegisters);
+    double sum = 0;
+    auto numZeroRegisters = 0u;
+    for (const auto reg : registers) {
+        sum += std::ldexp(1.0, -reg);
+        numZeroRegisters += reg == 0;
+    }
+    const auto estimate = alpha * numRegisters * numRegisters / sum;
+    if (estimate <= 2.5 * numRegisters && numZeroRegisters > 0) {
+        // Linear counting is more accurate for small cardinalities.
+        return static_cast<uint64_t>(
+            std::round(numRegisters * std::log(numRegisters / numZeroRegisters)));
+    }
+    return static_cast<uint64_t>(std::round(estimate));
+}
+
+void HyperLogLog::serialize(Serializer& serializer) const {
+    serializer.writeDebuggingInfo("registers");
+    serializer.write(registers.data(), NUM_REGISTERS);
+}
+
+HyperLogLog HyperLogLog::deserialize(Deserializer& deserializer) {
+    std::string key;
+    HyperLogLog result;
+    deserializer.validateDebuggingInfo(key, "registers");
+    deserializer.read(result.registers.data(), NUM_REGISTERS);
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
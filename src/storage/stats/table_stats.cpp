@@ -0,0 +1,94 @@
+#include "storage/stats/table_stats.h"
+
+#include <algorithm>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "storage/store/chunked_node_group.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace storage {
+
+void TableStats::update(const std::vector<column_id_t>& columnIDs,
+    const ChunkedNodeGroup& chunkedGroup, row_idx_t startRow, row_idx_t numRows) {
+    KU_ASSERT(columnIDs.size() == chunkedGroup.getNumColumns());
+    for (auto i = 0u; i < columnIDs.size(); i++) {
+        const auto columnID = columnIDs[i];
+        if (columnID == INVALID_COLUMN_ID) {
+            continue;
+        }
+        if (columnID >= columnStats.size()) {
+            columnStats.resize(columnID + 1);
+        }
+        columnStats[columnID].update(chunkedGroup.getColumnChunk(i).getData(), startRow, numRows);
+    }
+}
+
+void TableStats::merge(const TableStats& other) {
+    if (other.columnStats.size() > columnStats.size()) {
+        columnStats.resize(other.columnStats.size());
+    }
+    for (auto i = 0u; i < other.columnStats.size(); i++) {
+        columnStats[i].merge(other.columnStats[i]);
+    }
+    for (auto i = 0u; i < degreeHistograms.size(); i++) {
+        degreeHistograms[i].merge(other.degreeHistograms[i]);
+    }
+}
+
+void TableStats::mergeColumnStats(column_id_t columnID, const ColumnStats& other) {
+    if (columnID >= columnStats.size()) {
+        columnStats.resize(columnID + 1);
+    }
+    columnStats[columnID].merge(other);
+}
+
+void TableStats::vacuumColumns(const std::vector<column_id_t>& columnIDs) {
+    std::vector<ColumnStats> vacuumedStats;
+    vacuumedStats.reserve(columnIDs.size());
+    for (const auto columnID : columnIDs) {
+        vacuumedStats.push_back(columnID < columnStats.size() ? columnStats[columnID] :
+                                                                ColumnStats{});
+    }
+    columnStats = std::move(vacuumedStats);
+}
+
+EquiDepthHistogram TableStats::computeDegreeHistogram(const ColumnChunkData& lengthChunk,
+    offset_t numNodes) {
+    const auto sampleStep =
+        std::max<uint64_t>(1, numNodes / ColumnStats::NUM_SAMPLED_VALUES_PER_CHUNK);
+    std::vector<double> sample;
+    uint64_t numNodesWithRels = 0;
+    for (auto offset = 0u; offset < numNodes; offset++) {
+        const auto length = lengthChunk.getValue<length_t>(offset);
+        if (length == 0) {
+            continue;
+        }
+        if (numNodesWithRels++ % sampleStep == 0) {
+            sample.push_back(length);
+        }
+    }
+    return EquiDepthHistogram::build(std::move(sample), numNodesWithRels);
+}
+
+void TableStats::serialize(Serializer& serializer) const {
+    serializer.writeDebuggingInfo("column_stats");
+    serializer.serializeVector(columnStats);
+    serializer.writeDebuggingInfo("degree_histograms");
+    serializer.serializeArray(degreeHistograms);
+}
+
+TableStats TableStats::deserialize(Deserializer& deserializer) {
+    std::string key;
+    TableStats result;
+    deserializer.validateDebuggingInfo(key, "column_stats");
+    deserializer.deserializeVector(result.columnStats);
+    deserializer.validateDebuggingInfo(key, "degree_histograms");
+    deserializer.deserializeArray(result.degreeHistograms);
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
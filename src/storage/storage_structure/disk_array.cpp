@@ -1,5 +1,7 @@
 #include "storage/storage_structure/disk_array.h"
 
+#include <algorithm>
+
 #include "common/constants.h"
 #include "common/exception/runtime.h"
 #include "common/string_format.h"
@@ -105,6 +107,63 @@ void DiskArrayInternal::get(uint64_t idx, const Transaction* transaction,
     }
 }
 
+void DiskArrayInternal::get(std::span<const uint64_t> idxs, const Transaction* transaction,
+    std::span<std::byte> vals) {
+    if (idxs.empty()) {
+        return;
+    }
+    KU_ASSERT(vals.size() % idxs.size() == 0);
+    const auto valSize = vals.size() / idxs.size();
+    std::shared_lock sLck{diskArraySharedMtx};
+    struct ElementToRead {
+        page_idx_t apPageIdx;
+        uint16_t elemPosInPage;
+        uint32_t posInVals;
+    };
+    std::vector<ElementToRead> elements;
+    elements.reserve(idxs.size());
+    for (auto i = 0u; i < idxs.size(); i++) {
+        KU_ASSERT(checkOutOfBoundAccess(transaction->getType(), idxs[i]));
+        const auto apCursor = getAPIdxAndOffsetInAP(storageInfo, idxs[i]);
+        elements.push_back(ElementToRead{
+            getAPPageIdxNoLock(apCursor.pageIdx, transaction->getType()),
+            static_cast<uint16_t>(apCursor.elemPosInPage), i});
+    }
+    std::sort(elements.begin(), elements.end(),
+        [](const auto& a, const auto& b) { return a.apPageIdx < b.apPageIdx; });
+    // Hand runs of consecutive pages to the buffer manager as read-ahead hints.
+    auto runStart = 0u;
+    for (auto i = 1u; i <= elements.size(); i++) {
+        if (i == elements.size() || elements[i].apPageIdx > elements[i - 1].apPageIdx + 1) {
+            fileHandle.prefetchPages(elements[runStart].apPageIdx,
+                elements[i - 1].apPageIdx - elements[runStart].apPageIdx + 1);
+            runStart = i;
+        }
+    }
+    auto groupStart = 0u;
+    while (groupStart < elements.size()) {
+        const auto apPageIdx = elements[groupStart].apPageIdx;
+        auto groupEnd = groupStart + 1;
+        while (groupEnd < elements.size() && elements[groupEnd].apPageIdx == apPageIdx) {
+            groupEnd++;
+        }
+        const auto readOp = [&](const uint8_t* frame) -> void {
+            for (auto i = groupStart; i < groupEnd; i++) {
+                memcpy(vals.data() + elements[i].posInVals * valSize,
+                    frame + elements[i].elemPosInPage, valSize);
+            }
+        };
+        if (transaction->getType() != TransactionType::CHECKPOINT || !hasTransactionalUpdates ||
+            apPageIdx > lastPageOnDisk ||
+            !shadowFile->hasShadowPage(fileHandle.getFileIndex(), apPageIdx)) {
+            fileHandle.optimisticReadPage(apPageIdx, readOp);
+        } else {
+            DBFileUtils::readShadowVersionOfPage(fileHandle, apPageIdx, *shadowFile, readOp);
+        }
+        groupStart = groupEnd;
+    }
+}
+
 void DiskArrayInternal::updatePage(uint64_t pageIdx, bool isNewPage,
     std::function<void(uint8_t*)> updateOp) {
     auto& bmFileHandle = fileHandle;
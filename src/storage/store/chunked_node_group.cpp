@@ -223,6 +223,36 @@ void ChunkedNodeGroup::scan(const Transaction* transaction, const TableScanState
     }
 }
 
+bool ChunkedNodeGroup::canSkipScan(const Transaction* transaction, const TableScanState& scanState,
+    offset_t rowIdxInGroup, length_t numRowsToScan) const {
+    if (residencyState != ResidencyState::ON_DISK || scanState.columnPredicateSets.empty()) {
+        return false;
+    }
+    const auto vectorIdx = rowIdxInGroup / DEFAULT_VECTOR_CAPACITY;
+    if ((rowIdxInGroup + numRowsToScan - 1) / DEFAULT_VECTOR_CAPACITY != vectorIdx) {
+        return false;
+    }
+    KU_ASSERT(scanState.columnPredicateSets.size() == scanState.columnIDs.size());
+    for (auto i = 0u; i < scanState.columnIDs.size(); i++) {
+        const auto columnID = scanState.columnIDs[i];
+        if (columnID == INVALID_COLUMN_ID || columnID == ROW_IDX_COLUMN_ID) {
+            continue;
+        }
+        KU_ASSERT(columnID < chunks.size());
+        const auto& chunk = *chunks[columnID];
+        // Zone maps only describe the values on disk.
+        if (chunk.hasUpdates(transaction, rowIdxInGroup, numRowsToScan)) {
+            continue;
+        }
+        const auto* zoneMap = chunk.getData().getVectorZoneMap(vectorIdx);
+        if (zoneMap && scanState.columnPredicateSets[i].checkZoneMap(*zoneMap) ==
+                           ZoneMapCheckResult::SKIP_SCAN) {
+            return true;
+        }
+    }
+    return false;
+}
+
 template<ResidencyState SCAN_RESIDENCY_STATE>
 void ChunkedNodeGroup::scanCommitted(Transaction* transaction, TableScanState& scanState,
     NodeGroupScanState& nodeGroupScanState, ChunkedNodeGroup& output) const {
@@ -303,13 +333,16 @@ bool ChunkedNodeGroup::delete_(const Transaction* transaction, row_idx_t rowIdxI
 }
 
 void ChunkedNodeGroup::addColumn(Transaction*, const TableAddColumnState& addColumnState,
-    bool enableCompression, BMFileHandle* dataFH) {
+    bool enableCompression, BMFileHandle* dataFH, ColumnStats* newColumnStats) {
     auto numRows = getNumRows();
     auto& dataType = addColumnState.propertyDefinition.getType();
     chunks.push_back(std::make_unique<ColumnChunk>(dataType, capacity, enableCompression,
         ResidencyState::IN_MEMORY));
     auto& chunkData = chunks.back()->getData();
     chunkData.populateWithDefaultVal(addColumnState.defaultEvaluator, numRows);
+    if (newColumnStats) {
+        newColumnStats->update(chunkData, 0 /* startOffset */, numRows);
+    }
     if (residencyState == ResidencyState::ON_DISK) {
         KU_ASSERT(dataFH);
         chunkData.flush(*dataFH);
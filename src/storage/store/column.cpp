@@ -199,8 +199,7 @@ void Column::scan(Transaction* transaction, const ChunkState& state, offset_t st
     }
     auto pageCursor = getPageCursorForOffsetInGroup(startOffsetInGroup, state);
     const auto numValuesToScan = endOffsetInGroup - startOffsetInGroup;
-    scanUnfiltered(transaction, pageCursor, numValuesToScan, resultVector, state.metadata,
-        offsetInVector);
+    scanUnfiltered(transaction, pageCursor, numValuesToScan, resultVector, state, offsetInVector);
 }
 
 void Column::scan(Transaction* transaction, const ChunkState& state, ColumnChunkData* columnChunk,
@@ -232,10 +231,13 @@ void Column::scan(Transaction* transaction, const ChunkState& state, ColumnChunk
         auto numValuesToReadInPage =
             std::min(numValuesPerPage - cursor.elemPosInPage, numValuesToScan - numValuesScanned);
         KU_ASSERT(isPageIdxValid(cursor.pageIdx, state.metadata));
-        readFromPage(transaction, cursor.pageIdx, [&](uint8_t* frame) -> void {
-            readToPageFunc(frame, cursor, columnChunk->getData(), numValuesScanned,
-                numValuesToReadInPage, state.metadata.compMeta);
-        });
+        readFromPage(
+            transaction, cursor.pageIdx,
+            [&](uint8_t* frame) -> void {
+                readToPageFunc(frame, cursor, columnChunk->getData(), numValuesScanned,
+                    numValuesToReadInPage, state.metadata.compMeta);
+            },
+            state.accessHint);
         numValuesScanned += numValuesToReadInPage;
         cursor.nextPage();
     }
@@ -252,30 +254,64 @@ void Column::scan(Transaction* transaction, const ChunkState& state, offset_t st
         uint64_t numValuesToScanInPage =
             std::min(static_cast<uint64_t>(state.numValuesPerPage) - cursor.elemPosInPage,
                 numValuesToScan - numValuesScanned);
-        readFromPage(transaction, cursor.pageIdx, [&](uint8_t* frame) -> void {
-            readToPageFunc(frame, cursor, result, numValuesScanned, numValuesToScanInPage,
-                state.metadata.compMeta);
-        });
+        readFromPage(
+            transaction, cursor.pageIdx,
+            [&](uint8_t* frame) -> void {
+                readToPageFunc(frame, cursor, result, numValuesScanned, numValuesToScanInPage,
+                    state.metadata.compMeta);
+            },
+            state.accessHint);
         numValuesScanned += numValuesToScanInPage;
         cursor.nextPage();
     }
 }
 
+void Column::prefetch(const ChunkState& state) const {
+    if (state.metadata.numPages > 0) {
+        dataFH->prefetchPages(state.metadata.pageIdx, state.metadata.numPages);
+    }
+    if (state.nullState) {
+        prefetch(*state.nullState);
+    }
+    for (const auto& childState : state.childrenStates) {
+        prefetch(childState);
+    }
+}
+
+void Column::prefetch(const ChunkState& state, offset_t startOffset, offset_t endOffset) const {
+    if (state.nullState) {
+        prefetch(*state.nullState, startOffset, endOffset);
+    }
+    const auto numValuesPerPage = state.numValuesPerPage;
+    if (state.metadata.numPages == 0 || numValuesPerPage == UINT64_MAX) {
+        return;
+    }
+    const auto startPageIdx = startOffset / numValuesPerPage;
+    const auto endPageIdx = std::min(static_cast<uint64_t>(state.metadata.numPages),
+        (endOffset + numValuesPerPage - 1) / numValuesPerPage);
+    // A single page is going to be read right away, so there is nothing to read ahead.
+    if (startPageIdx + 1 >= endPageIdx) {
+        return;
+    }
+    dataFH->prefetchPages(state.metadata.pageIdx + startPageIdx, endPageIdx - startPageIdx);
+}
+
 void Column::scanInternal(Transaction* transaction, const ChunkState& state,
     offset_t startOffsetInChunk, row_idx_t numValuesToScan, ValueVector* nodeIDVector,
     ValueVector* resultVector) {
     auto cursor = getPageCursorForOffsetInGroup(startOffsetInChunk, state);
     if (nodeIDVector->state->getSelVector().isUnfiltered()) {
-        scanUnfiltered(transaction, cursor, numValuesToScan, resultVector, state.metadata);
+        scanUnfiltered(transaction, cursor, numValuesToScan, resultVector, state);
     } else {
         scanFiltered(transaction, cursor, numValuesToScan, nodeIDVector->state->getSelVector(),
-            resultVector, state.metadata);
+            resultVector, state);
     }
 }
 
 void Column::scanUnfiltered(Transaction* transaction, PageCursor& pageCursor,
-    uint64_t numValuesToScan, ValueVector* resultVector, const ColumnChunkMetadata& chunkMeta,
+    uint64_t numValuesToScan, ValueVector* resultVector, const ChunkState& state,
     uint64_t startPosInVector) const {
+    const auto& chunkMeta = state.metadata;
     uint64_t numValuesScanned = 0;
     const auto numValuesPerPage =
         chunkMeta.compMeta.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
@@ -283,39 +319,74 @@ void Column::scanUnfiltered(Transaction* transaction, PageCursor& pageCursor,
         uint64_t numValuesToScanInPage = std::min(numValuesPerPage - pageCursor.elemPosInPage,
             numValuesToScan - numValuesScanned);
         KU_ASSERT(isPageIdxValid(pageCursor.pageIdx, chunkMeta));
-        readFromPage(transaction, pageCursor.pageIdx, [&](uint8_t* frame) -> void {
-            readToVectorFunc(frame, pageCursor, resultVector, numValuesScanned + startPosInVector,
-                numValuesToScanInPage, chunkMeta.compMeta);
-        });
+        readFromPage(
+            transaction, pageCursor.pageIdx,
+            [&](uint8_t* frame) -> void {
+                readToVectorFunc(frame, pageCursor, resultVector,
+                    numValuesScanned + startPosInVector, numValuesToScanInPage,
+                    chunkMeta.compMeta);
+            },
+            state.accessHint);
         numValuesScanned += numValuesToScanInPage;
         pageCursor.nextPage();
     }
 }
 
+// Delta encoded values can only be decoded along with all earlier values of their block, so
+// decoding the selected values one by one would redo most of the work for every value.
+static bool canDecodeSelectedValues(const CompressionMetadata& metadata) {
+    return metadata.compression != CompressionType::DELTA_BITPACKING;
+}
+
 void Column::scanFiltered(Transaction* transaction, PageCursor& pageCursor,
     uint64_t numValuesToScan, const SelectionVector& selVector, ValueVector* resultVector,
-    const ColumnChunkMetadata& chunkMeta) const {
-    auto numValuesScanned = 0u;
+    const ChunkState& state) const {
+    const auto& chunkMeta = state.metadata;
+    // Pages with fewer selected values than 1 in SPARSE_SELECTION_FACTOR only decode the selected
+    // values instead of every value in the page.
+    static constexpr uint64_t SPARSE_SELECTION_FACTOR = 16;
+    uint64_t numValuesScanned = 0;
     auto posInSelVector = 0u;
     const auto numValuesPerPage =
         chunkMeta.compMeta.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
     while (numValuesScanned < numValuesToScan) {
         uint64_t numValuesToScanInPage = std::min(numValuesPerPage - pageCursor.elemPosInPage,
             numValuesToScan - numValuesScanned);
-        if (isInRange(selVector[posInSelVector], numValuesScanned,
-                numValuesScanned + numValuesToScanInPage)) {
+        const auto pageEnd = numValuesScanned + numValuesToScanInPage;
+        auto selEndInPage = posInSelVector;
+        while (selEndInPage < selVector.getSelSize() && selVector[selEndInPage] < pageEnd) {
+            selEndInPage++;
+        }
+        const auto numSelectedInPage = selEndInPage - posInSelVector;
+        if (numSelectedInPage > 0) {
             KU_ASSERT(isPageIdxValid(pageCursor.pageIdx, chunkMeta));
-            readFromPage(transaction, pageCursor.pageIdx, [&](uint8_t* frame) -> void {
-                readToVectorFunc(frame, pageCursor, resultVector, numValuesScanned,
-                    numValuesToScanInPage, chunkMeta.compMeta);
-            });
+            readFromPage(
+                transaction, pageCursor.pageIdx,
+                [&](uint8_t* frame) -> void {
+                    if (numSelectedInPage * SPARSE_SELECTION_FACTOR >= numValuesToScanInPage ||
+                        !canDecodeSelectedValues(chunkMeta.compMeta)) {
+                        readToVectorFunc(frame, pageCursor, resultVector, numValuesScanned,
+                            numValuesToScanInPage, chunkMeta.compMeta);
+                        return;
+                    }
+                    // Consecutive selected positions are decoded together
+                    for (auto i = posInSelVector; i < selEndInPage;) {
+                        const auto runStart = selVector[i];
+                        auto runEnd = runStart + 1;
+                        for (i++; i < selEndInPage && selVector[i] == runEnd; i++) {
+                            runEnd++;
+                        }
+                        auto cursor = pageCursor;
+                        cursor.elemPosInPage += runStart - numValuesScanned;
+                        readToVectorFunc(frame, cursor, resultVector, runStart, runEnd - runStart,
+                            chunkMeta.compMeta);
+                    }
+                },
+                state.accessHint);
         }
-        numValuesScanned += numValuesToScanInPage;
+        posInSelVector = selEndInPage;
+        numValuesScanned = pageEnd;
         pageCursor.nextPage();
-        while (posInSelVector < selVector.getSelSize() &&
-               selVector[posInSelVector] < numValuesScanned) {
-            posInSelVector++;
-        }
     }
 }
 
@@ -343,7 +414,7 @@ void Column::lookupInternal(Transaction* transaction, const ChunkState& state, o
 }
 
 void Column::readFromPage(Transaction* transaction, page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& func) const {
+    const std::function<void(uint8_t*)>& func, PageAccessHint accessHint) const {
     // For constant compression, call read on a nullptr since there is no data on disk and
     // decompression only requires metadata
     if (pageIdx == INVALID_PAGE_IDX) {
@@ -351,7 +422,7 @@ void Column::readFromPage(Transaction* transaction, page_idx_t pageIdx,
     }
     auto [fileHandleToPin, pageIdxToPin] = DBFileUtils::getFileHandleAndPhysicalPageIdxToPin(
         *dataFH, pageIdx, *shadowFile, transaction->getType());
-    fileHandleToPin->optimisticReadPage(pageIdxToPin, func);
+    fileHandleToPin->optimisticReadPage(pageIdxToPin, func, accessHint);
 }
 
 static bool sanityCheckForWrites(const ColumnChunkMetadata& metadata, const LogicalType& dataType) {
@@ -376,11 +447,11 @@ void Column::updateStatistics(ColumnChunkMetadata& metadata, offset_t maxIndex,
     // Either both or neither should be provided
     KU_ASSERT((!min && !max) || (min && max));
     if (min && max) {
-        // FIXME(bmwinger): this is causing test failures
         // If new values are outside of the existing min/max, update them
         if (max->gt(metadata.compMeta.max, dataType.getPhysicalType())) {
             metadata.compMeta.max = *max;
-        } else if (metadata.compMeta.min.gt(*min, dataType.getPhysicalType())) {
+        }
+        if (metadata.compMeta.min.gt(*min, dataType.getPhysicalType())) {
             metadata.compMeta.min = *min;
         }
     }
@@ -400,6 +471,8 @@ void Column::write(ColumnChunkData& persistentChunk, ChunkState& state, offset_t
         dataType.getPhysicalType(), nullMaskPtr);
     updateStatistics(persistentChunk.getMetadata(), dstOffset + numValues - 1, minWritten,
         maxWritten);
+    persistentChunk.updateVectorZoneMaps(dstOffset, data->getData(), srcOffset, numValues,
+        nullMaskPtr);
 }
 
 void Column::writeValues(ColumnChunkData&, ChunkState& state, offset_t dstOffset,
@@ -433,6 +506,8 @@ offset_t Column::appendValues(ColumnChunkData& persistentChunk, ChunkState& stat
     auto [minWritten, maxWritten] = getMinMaxStorageValue(data, 0 /*offset*/, numValues,
         dataType.getPhysicalType(), nullChunkData);
     updateStatistics(metadata, startOffset + numValues - 1, minWritten, maxWritten);
+    persistentChunk.updateVectorZoneMaps(startOffset, data, 0 /*srcOffset*/, numValues,
+        nullChunkData);
     return startOffset;
 }
 
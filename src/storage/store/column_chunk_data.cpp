@@ -123,17 +123,30 @@ public:
 
     GetCompressionMetadata(const GetCompressionMetadata& other) = default;
 
-    ColumnChunkMetadata operator()(const uint8_t* /*buffer*/, uint64_t /*bufferSize*/,
+    ColumnChunkMetadata operator()(const uint8_t* buffer, uint64_t /*bufferSize*/,
         uint64_t capacity, uint64_t numValues, StorageValue min, StorageValue max) {
         // For supported types, min and max may be null if all values are null
         // Compression is supported in this case
         // Unsupported types always return a dummy value (where min != max)
         // so that we don't constant compress them
-        if (min == max) {
+        // Floating point values are never constant compressed, since the min and max don't
+        // distinguish between NaNs, -0.0 and 0.0
+        const auto isFloatingPoint = dataType.getPhysicalType() == PhysicalTypeID::DOUBLE ||
+                                     dataType.getPhysicalType() == PhysicalTypeID::FLOAT;
+        if (min == max && !isFloatingPoint) {
             return ColumnChunkMetadata(INVALID_PAGE_IDX, 0, numValues,
                 CompressionMetadata(min, max, CompressionType::CONSTANT));
         }
         auto compMeta = CompressionMetadata(min, max, alg->getCompressionType());
+        const auto getNumPages = [&](const CompressionMetadata& metadata,
+                                     uint64_t numValuesToStore) -> uint64_t {
+            const auto numValuesPerPage =
+                metadata.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
+            return numValuesPerPage == UINT64_MAX ?
+                       0 :
+                       numValuesToStore / numValuesPerPage +
+                           (numValuesToStore % numValuesPerPage == 0 ? 0 : 1);
+        };
         if (alg->getCompressionType() == CompressionType::INTEGER_BITPACKING) {
             TypeUtils::visit(
                 dataType.getPhysicalType(),
@@ -145,13 +158,41 @@ public:
                     }
                 },
                 [&](auto) {});
+            // Sorted data and data with long runs of the same value may need fewer pages with
+            // delta bitpacking or run-length encoding. Since those can't be updated in place,
+            // they are only used if they save pages for the values the chunk holds. Comparing
+            // against the capacity would favour them for chunks with only a few values.
+            const auto chooseEncoding = [&]<EncodedIntegerType T>(T) {
+                const auto values = std::span(reinterpret_cast<const T*>(buffer), numValues);
+                for (const auto& candidate : {DeltaBitpacking<T>::analyze(values, min, max),
+                         RunLengthEncoding<T>::analyze(values, min, max,
+                             BufferPoolConstants::PAGE_4KB_SIZE)}) {
+                    if (candidate && getNumPages(*candidate, numValues) <
+                                         getNumPages(compMeta, numValues)) {
+                        compMeta = *candidate;
+                    }
+                }
+            };
+            TypeUtils::visit(
+                dataType.getPhysicalType(), [&](internalID_t) { chooseEncoding(uint64_t()); },
+                [&]<EncodedIntegerType T>(T value) { chooseEncoding(value); }, [&](auto) {});
+        } else if (alg->getCompressionType() == CompressionType::ALP) {
+            // Values which don't compress well with ALP are stored uncompressed
+            compMeta = CompressionMetadata(min, max, CompressionType::UNCOMPRESSED);
+            TypeUtils::visit(
+                dataType.getPhysicalType(),
+                [&]<std::floating_point T>(T) {
+                    const auto candidate = FloatCompression<T>::analyze(
+                        std::span(reinterpret_cast<const T*>(buffer), numValues), min, max,
+                        BufferPoolConstants::PAGE_4KB_SIZE);
+                    if (candidate && getNumPages(*candidate, numValues) <
+                                         getNumPages(compMeta, numValues)) {
+                        compMeta = *candidate;
+                    }
+                },
+                [&](auto) {});
         }
-        const auto numValuesPerPage =
-            compMeta.numValues(BufferPoolConstants::PAGE_4KB_SIZE, dataType);
-        const auto numPages =
-            numValuesPerPage == UINT64_MAX ?
-                0 :
-                capacity / numValuesPerPage + (capacity % numValuesPerPage == 0 ? 0 : 1);
+        const auto numPages = getNumPages(compMeta, capacity);
         return ColumnChunkMetadata(INVALID_PAGE_IDX, numPages, numValues, compMeta);
     }
 };
@@ -190,6 +231,12 @@ static std::shared_ptr<CompressionAlg> getCompression(const LogicalType& dataTyp
     case PhysicalTypeID::UINT8: {
         return std::make_shared<IntegerBitpacking<uint8_t>>();
     }
+    case PhysicalTypeID::DOUBLE: {
+        return std::make_shared<FloatCompression<double>>();
+    }
+    case PhysicalTypeID::FLOAT: {
+        return std::make_shared<FloatCompression<float>>();
+    }
     default: {
         return std::make_shared<Uncompressed>(dataType);
     }
@@ -250,7 +297,9 @@ void ColumnChunkData::initializeFunction(bool enableCompression) {
     case PhysicalTypeID::UINT32:
     case PhysicalTypeID::UINT16:
     case PhysicalTypeID::UINT8:
-    case PhysicalTypeID::INT128: {
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT: {
         const auto compression = getCompression(dataType, enableCompression);
         flushBufferFunction = CompressedFlushBuffer(compression, dataType);
         getMetadataFunction = GetCompressionMetadata(compression, dataType);
@@ -321,6 +370,7 @@ void ColumnChunkData::flush(BMFileHandle& dataFH) {
     const auto preScanMetadata = getMetadataToFlush();
     const auto startPageIdx = dataFH.addNewPages(preScanMetadata.numPages);
     const auto metadata = flushBuffer(&dataFH, startPageIdx, preScanMetadata);
+    populateVectorZoneMaps();
     setToOnDisk(metadata);
     if (nullData) {
         nullData->flush(dataFH);
@@ -338,6 +388,60 @@ void ColumnChunkData::setToOnDisk(const ColumnChunkMetadata& metadata) {
     this->numValues = metadata.numValues;
 }
 
+void ColumnChunkData::populateVectorZoneMaps() {
+    vectorZoneMaps.clear();
+    // Chunks without null data are internal ones (e.g. offsets or IDs), which are never filtered.
+    if (!nullData || !ZoneMap::isSupported(dataType.getPhysicalType())) {
+        return;
+    }
+    const auto nullMask = nullData->getNullMask();
+    widenVectorZoneMaps(0 /*dstOffset*/, buffer.get(), 0 /*srcOffset*/, numValues, &nullMask);
+}
+
+void ColumnChunkData::updateVectorZoneMaps(offset_t dstOffset, const uint8_t* data,
+    offset_t srcOffset, length_t numValues, const NullMask* nullMask) {
+    KU_ASSERT(residencyState == ResidencyState::ON_DISK);
+    if (vectorZoneMaps.empty()) {
+        return;
+    }
+    widenVectorZoneMaps(dstOffset, data, srcOffset, numValues, nullMask);
+}
+
+static bool hasNullsInRange(const NullMask* nullMask, offset_t offset, length_t numValues) {
+    if (!nullMask || nullMask->hasNoNullsGuarantee()) {
+        return false;
+    }
+    for (auto i = 0u; i < numValues; i++) {
+        if (nullMask->isNull(offset + i)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ColumnChunkData::widenVectorZoneMaps(offset_t dstOffset, const uint8_t* data,
+    offset_t srcOffset, length_t numValues, const NullMask* nullMask) {
+    const auto physicalType = dataType.getPhysicalType();
+    const auto numVectors =
+        (dstOffset + numValues + DEFAULT_VECTOR_CAPACITY - 1) / DEFAULT_VECTOR_CAPACITY;
+    if (vectorZoneMaps.size() < numVectors) {
+        vectorZoneMaps.resize(numVectors);
+    }
+    offset_t numValuesDone = 0;
+    while (numValuesDone < numValues) {
+        const auto offsetInChunk = dstOffset + numValuesDone;
+        const auto vectorIdx = offsetInChunk / DEFAULT_VECTOR_CAPACITY;
+        const auto numValuesInVector = std::min(numValues - numValuesDone,
+            (vectorIdx + 1) * DEFAULT_VECTOR_CAPACITY - offsetInChunk);
+        const auto offsetInData = srcOffset + numValuesDone;
+        const auto [min, max] =
+            getMinMaxStorageValue(data, offsetInData, numValuesInVector, physicalType, nullMask);
+        vectorZoneMaps[vectorIdx].update(min, max,
+            hasNullsInRange(nullMask, offsetInData, numValuesInVector), physicalType);
+        numValuesDone += numValuesInVector;
+    }
+}
+
 ColumnChunkMetadata ColumnChunkData::flushBuffer(BMFileHandle* dataFH, page_idx_t startPageIdx,
     const ColumnChunkMetadata& metadata) const {
     if (!metadata.compMeta.isConstant() && bufferSize != 0) {
@@ -489,6 +593,7 @@ void ColumnChunkData::setToInMemory() {
     KU_ASSERT(capacity == 0 && bufferSize == 0);
     residencyState = ResidencyState::IN_MEMORY;
     numValues = 0;
+    vectorZoneMaps.clear();
     if (nullData) {
         nullData->setToInMemory();
     }
@@ -588,6 +693,8 @@ void ColumnChunkData::serialize(Serializer& serializer) const {
     dataType.serialize(serializer);
     serializer.writeDebuggingInfo("metadata");
     serializer.write<ColumnChunkMetadata>(metadata);
+    serializer.writeDebuggingInfo("vector_zone_maps");
+    serializer.serializeVector(vectorZoneMaps);
     serializer.writeDebuggingInfo("enable_compression");
     serializer.write<bool>(enableCompression);
     serializer.writeDebuggingInfo("has_null");
@@ -607,12 +714,16 @@ std::unique_ptr<ColumnChunkData> ColumnChunkData::deserialize(Deserializer& deSe
     const auto dataType = LogicalType::deserialize(deSer);
     deSer.validateDebuggingInfo(key, "metadata");
     deSer.deserializeValue<ColumnChunkMetadata>(metadata);
+    deSer.validateDebuggingInfo(key, "vector_zone_maps");
+    std::vector<ZoneMap> vectorZoneMaps;
+    deSer.deserializeVector(vectorZoneMaps);
     deSer.validateDebuggingInfo(key, "enable_compression");
     deSer.deserializeValue<bool>(enableCompression);
     deSer.validateDebuggingInfo(key, "has_null");
     deSer.deserializeValue<bool>(hasNull);
     auto chunkData = ColumnChunkFactory::createColumnChunkData(dataType.copy(), enableCompression,
         metadata, hasNull);
+    chunkData->vectorZoneMaps = std::move(vectorZoneMaps);
     if (hasNull) {
         deSer.validateDebuggingInfo(key, "null_data");
         chunkData->nullData = NullChunkData::deserialize(deSer);
@@ -1,5 +1,6 @@
 #include "storage/store/csr_node_group.h"
 
+#include "storage/stats/table_stats.h"
 #include "storage/storage_utils.h"
 #include "storage/store/rel_table.h"
 #include "transaction/transaction.h"
@@ -33,6 +34,7 @@ void CSRNodeGroup::initializeScanState(Transaction* transaction, TableScanState&
             nodeGroupScanState.csrHeader->getStartCSROffset(offsetInGroup);
         nodeGroupScanState.persistentCSRList.length =
             nodeGroupScanState.csrHeader->getCSRLength(offsetInGroup);
+        prefetchPersistentCSRList(relScanState, nodeGroupScanState);
     }
     if (csrIndex) {
         nodeGroupScanState.inMemCSRList = csrIndex->indices[offsetInGroup];
@@ -78,6 +80,22 @@ void CSRNodeGroup::initializePersistentCSRHeader(Transaction* transaction,
     }
 }
 
+void CSRNodeGroup::prefetchPersistentCSRList(const RelTableScanState& relScanState,
+    const CSRNodeGroupScanState& nodeGroupScanState) {
+    const auto& csrList = nodeGroupScanState.persistentCSRList;
+    if (csrList.length == 0) {
+        return;
+    }
+    for (auto i = 0u; i < relScanState.columnIDs.size(); i++) {
+        if (relScanState.columnIDs[i] == INVALID_COLUMN_ID ||
+            relScanState.columnIDs[i] == ROW_IDX_COLUMN_ID) {
+            continue;
+        }
+        relScanState.columns[i]->prefetch(nodeGroupScanState.chunkStates[i], csrList.startRow,
+            csrList.startRow + csrList.length);
+    }
+}
+
 NodeGroupScanResult CSRNodeGroup::scan(Transaction* transaction, TableScanState& state) {
     const auto& relScanState = state.cast<RelTableScanState>();
     auto& nodeGroupScanState = relScanState.nodeGroupScanState->cast<CSRNodeGroupScanState>();
@@ -294,11 +312,12 @@ bool CSRNodeGroup::delete_(const Transaction* transaction, CSRNodeGroupScanSourc
 }
 
 void CSRNodeGroup::addColumn(Transaction* transaction, TableAddColumnState& addColumnState,
-    BMFileHandle* dataFH) {
+    BMFileHandle* dataFH, ColumnStats* newColumnStats) {
     if (persistentChunkGroup) {
-        persistentChunkGroup->addColumn(transaction, addColumnState, enableCompression, dataFH);
+        persistentChunkGroup->addColumn(transaction, addColumnState, enableCompression, dataFH,
+            newColumnStats);
     }
-    NodeGroup::addColumn(transaction, addColumnState, dataFH);
+    NodeGroup::addColumn(transaction, addColumnState, dataFH, newColumnStats);
 }
 
 void CSRNodeGroup::serialize(Serializer& serializer) {
@@ -338,6 +357,8 @@ void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheck
     csrState.newHeader->setNumValues(StorageConstants::NODE_GROUP_SIZE);
     csrState.newHeader->copyFrom(*csrState.oldHeader);
     auto leafRegions = collectLeafRegionsAndCSRLength(lock, csrState);
+    csrState.degreeHistogram.merge(TableStats::computeDegreeHistogram(
+        csrState.newHeader->length->getData(), StorageConstants::NODE_GROUP_SIZE));
     KU_ASSERT(std::is_sorted(leafRegions.begin(), leafRegions.end(),
         [](const auto& a, const auto& b) { return a.regionIdx < b.regionIdx; }));
     const auto regionsToCheckpoint = mergeRegionsToCheckpoint(csrState, leafRegions);
@@ -621,6 +642,8 @@ void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpoint
     const auto numNodes = csrIndex->getMaxOffsetWithRels() + 1;
     csrState.newHeader->setNumValues(numNodes);
     populateCSRLengthInMemOnly(lock, numNodes, csrState);
+    csrState.degreeHistogram.merge(
+        TableStats::computeDegreeHistogram(csrState.newHeader->length->getData(), numNodes));
     const auto rightCSROffsetsOfRegions =
         csrState.newHeader->populateStartCSROffsetsFromLength(true /* leaveGap */);
     csrState.newHeader->populateEndCSROffsetFromStartAndLength();
@@ -115,6 +115,16 @@ void NodeGroup::initializeScanState(Transaction*, const UniqLock& lock, TableSca
             chunk.initializeScanState(nodeGroupScanState.chunkStates[i]);
             // TODO: Not a good way to initialize column for chunkState here.
             nodeGroupScanState.chunkStates[i].column = state.columns[i];
+            if (!state.semiMask || !state.semiMask->isEnabled()) {
+                nodeGroupScanState.chunkStates[i].setAccessHint(state.accessHint);
+                // Without a semi mask, a read scan goes through the whole chunk sequentially, so
+                // we read it ahead while the first vectors are being processed.
+                if (state.readAhead) {
+                    state.columns[i]->prefetch(nodeGroupScanState.chunkStates[i]);
+                }
+            } else {
+                nodeGroupScanState.chunkStates[i].setAccessHint(PageAccessHint::DEFAULT);
+            }
         }
     }
 }
@@ -150,6 +160,11 @@ NodeGroupScanResult NodeGroup::scan(Transaction* transaction, TableScanState& st
             return NodeGroupScanResult{nodeGroupScanState.nextRowToScan, 0};
         }
     }
+    if (chunkedGroupToScan.canSkipScan(transaction, state, rowIdxInChunkToScan, numRowsToScan)) {
+        state.IDVector->state->getSelVectorUnsafe().setSelSize(0);
+        nodeGroupScanState.nextRowToScan += numRowsToScan;
+        return NodeGroupScanResult{nodeGroupScanState.nextRowToScan, 0};
+    }
     chunkedGroupToScan.scan(transaction, state, nodeGroupScanState, rowIdxInChunkToScan,
         numRowsToScan);
     const auto startRow = nodeGroupScanState.nextRowToScan;
@@ -211,11 +226,12 @@ row_idx_t NodeGroup::getNumDeletedRows(const Transaction* transaction) {
 }
 
 void NodeGroup::addColumn(Transaction* transaction, TableAddColumnState& addColumnState,
-    BMFileHandle* dataFH) {
+    BMFileHandle* dataFH, ColumnStats* newColumnStats) {
     dataTypes.push_back(addColumnState.propertyDefinition.getType().copy());
     const auto lock = chunkedGroups.lock();
     for (auto& chunkedGroup : chunkedGroups.getAllGroups(lock)) {
-        chunkedGroup->addColumn(transaction, addColumnState, enableCompression, dataFH);
+        chunkedGroup->addColumn(transaction, addColumnState, enableCompression, dataFH,
+            newColumnStats);
     }
 }
 
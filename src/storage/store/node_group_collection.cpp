@@ -165,10 +165,11 @@ NodeGroup* NodeGroupCollection::getOrCreateNodeGroup(node_group_idx_t groupIdx,
     return nodeGroup;
 }
 
-void NodeGroupCollection::addColumn(Transaction* transaction, TableAddColumnState& addColumnState) {
+void NodeGroupCollection::addColumn(Transaction* transaction, TableAddColumnState& addColumnState,
+    ColumnStats* newColumnStats) {
     const auto lock = nodeGroups.lock();
     for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
-        nodeGroup->addColumn(transaction, addColumnState, dataFH);
+        nodeGroup->addColumn(transaction, addColumnState, dataFH, newColumnStats);
     }
     types.push_back(addColumnState.propertyDefinition.getType().copy());
 }
@@ -1,5 +1,7 @@
 #include "storage/store/node_table.h"
 
+#include <numeric>
+
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "common/cast.h"
 #include "common/exception/message.h"
@@ -269,14 +271,20 @@ void NodeTable::addColumn(Transaction* transaction, TableAddColumnState& addColu
     if (localTable) {
         localTable->addColumn(transaction, addColumnState);
     }
-    nodeGroups->addColumn(transaction, addColumnState);
+    // Existing rows take the default value, which is accounted for in the new column's stats.
+    ColumnStats newColumnStats;
+    nodeGroups->addColumn(transaction, addColumnState, &newColumnStats);
+    mergeColumnStats(transaction, columns.size() - 1, newColumnStats);
     hasChanges = true;
 }
 
 std::pair<offset_t, offset_t> NodeTable::appendToLastNodeGroup(Transaction* transaction,
     ChunkedNodeGroup& chunkedGroup) {
     hasChanges = true;
-    return nodeGroups->appendToLastNodeGroupAndFlushWhenFull(transaction, chunkedGroup);
+    const auto [startOffset, numRowsAppended] =
+        nodeGroups->appendToLastNodeGroupAndFlushWhenFull(transaction, chunkedGroup);
+    updateStats(transaction, getStatsColumnIDs(), chunkedGroup, 0 /* startRow */, numRowsAppended);
+    return {startOffset, numRowsAppended};
 }
 
 void NodeTable::commit(Transaction* transaction, LocalTable* localTable) {
@@ -288,6 +296,16 @@ void NodeTable::commit(Transaction* transaction, LocalTable* localTable) {
     // connected local rels. Directly removing them will cause shift of committed node offset,
     // leading to inconsistent result with connected rels.
     nodeGroups->append(transaction, localNodeTable.getNodeGroups());
+    const auto statsColumnIDs = getStatsColumnIDs();
+    for (auto localNodeGroupIdx = 0u; localNodeGroupIdx < localNodeTable.getNumNodeGroups();
+         localNodeGroupIdx++) {
+        const auto localNodeGroup = localNodeTable.getNodeGroup(localNodeGroupIdx);
+        for (auto i = 0u; i < localNodeGroup->getNumChunkedGroups(); i++) {
+            const auto chunkedGroup = localNodeGroup->getChunkedNodeGroup(i);
+            updateStats(transaction, statsColumnIDs, *chunkedGroup, 0 /* startRow */,
+                chunkedGroup->getNumRows());
+        }
+    }
     // 2. Set deleted flag for tuples that are deleted in local storage.
     row_idx_t numLocalRows = 0u;
     for (auto localNodeGroupIdx = 0u; localNodeGroupIdx < localNodeTable.getNumNodeGroups();
@@ -380,11 +398,18 @@ void NodeTable::checkpoint(Serializer& ser, TableCatalogEntry* tableEntry) {
         pkIndex->checkpoint();
         hasChanges = false;
         columns = std::move(state.columns);
+        checkpointStats(columnIDs, tableEntry);
         tableEntry->vacuumColumnIDs();
     }
     serialize(ser);
 }
 
+std::vector<column_id_t> NodeTable::getStatsColumnIDs() const {
+    std::vector<column_id_t> columnIDs(columns.size());
+    std::iota(columnIDs.begin(), columnIDs.end(), 0);
+    return columnIDs;
+}
+
 void NodeTable::serialize(Serializer& serializer) const {
     Table::serialize(serializer);
     nodeGroups->serialize(serializer);
@@ -401,8 +426,8 @@ bool NodeTable::lookupPK(const Transaction* transaction, ValueVector* keyVector,
     if (transaction->getLocalStorage()) {
         const auto localTable = transaction->getLocalStorage()->getLocalTable(tableID,
             LocalStorage::NotExistAction::RETURN_NULL);
-        if (localTable &&
-            localTable->cast<LocalNodeTable>().lookupPK(transaction, keyVector, result)) {
+        if (localTable && localTable->cast<LocalNodeTable>().lookupPK(transaction, keyVector,
+                              vectorPos, result)) {
             return true;
         }
     }
@@ -410,5 +435,28 @@ bool NodeTable::lookupPK(const Transaction* transaction, ValueVector* keyVector,
         [&](offset_t offset) { return isVisible(transaction, offset); });
 }
 
+void NodeTable::lookupPKs(const Transaction* transaction, const ValueVector& keyVector,
+    offset_t* offsets) const {
+    pkIndex->lookup(transaction, keyVector, offsets,
+        [&](offset_t offset) { return isVisible(transaction, offset); });
+    if (!transaction->getLocalStorage()) {
+        return;
+    }
+    const auto localTable = transaction->getLocalStorage()->getLocalTable(tableID,
+        LocalStorage::NotExistAction::RETURN_NULL);
+    if (!localTable) {
+        return;
+    }
+    // Nodes inserted by the transaction are only indexed in its local table.
+    auto& localNodeTable = localTable->cast<LocalNodeTable>();
+    const auto& selVector = keyVector.state->getSelVector();
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        offset_t localOffset = INVALID_OFFSET;
+        if (localNodeTable.lookupPK(transaction, &keyVector, selVector[i], localOffset)) {
+            offsets[i] = localOffset;
+        }
+    }
+}
+
 } // namespace storage
 } // namespace kuzu
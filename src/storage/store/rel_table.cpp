@@ -285,8 +285,12 @@ void RelTable::addColumn(Transaction* transaction, TableAddColumnState& addColum
     if (localTable) {
         localTable->addColumn(transaction, addColumnState);
     }
-    fwdRelTableData->addColumn(transaction, addColumnState);
-    bwdRelTableData->addColumn(transaction, addColumnState);
+    // Existing rels take the default value, which is accounted for in the new column's stats.
+    // Both directions hold the same rels, so the stats are only collected from the forward one.
+    ColumnStats newColumnStats;
+    fwdRelTableData->addColumn(transaction, addColumnState, &newColumnStats);
+    bwdRelTableData->addColumn(transaction, addColumnState, nullptr /* newColumnStats */);
+    mergeColumnStats(transaction, fwdRelTableData->getNumColumns() - 1, newColumnStats);
     hasChanges = true;
 }
 
@@ -313,6 +317,17 @@ void RelTable::commit(Transaction* transaction, LocalTable* localTable) {
     for (auto i = 0u; i < localRelTable.getNumColumns(); i++) {
         columnIDsToScan.push_back(i);
     }
+    // Collect stats of the committed properties. Local property columns follow the bound node,
+    // nbr node and rel ID columns.
+    std::vector<column_id_t> statsColumnIDs;
+    for (auto i = 0u; i < localRelTable.getNumColumns(); i++) {
+        statsColumnIDs.push_back(i > LOCAL_REL_ID_COLUMN_ID ? i - 1 : INVALID_COLUMN_ID);
+    }
+    for (auto i = 0u; i < localNodeGroup.getNumChunkedGroups(); i++) {
+        const auto chunkedGroup = localNodeGroup.getChunkedNodeGroup(i);
+        updateStats(transaction, statsColumnIDs, *chunkedGroup, 0 /* startRow */,
+            chunkedGroup->getNumRows());
+    }
     auto& fwdIndex = localRelTable.getFWDIndex();
     for (auto& [boundNodeOffset, rowIndices] : fwdIndex) {
         auto [nodeGroupIdx, boundOffsetInGroup] =
@@ -431,8 +446,9 @@ void RelTable::checkpoint(Serializer& ser, TableCatalogEntry* tableEntry) {
         for (auto& property : tableEntry->getProperties()) {
             columnIDs.push_back(tableEntry->getColumnID(property.getName()));
         }
-        fwdRelTableData->checkpoint(columnIDs);
-        bwdRelTableData->checkpoint(columnIDs);
+        setDegreeHistogram(RelDataDirection::FWD, fwdRelTableData->checkpoint(columnIDs));
+        setDegreeHistogram(RelDataDirection::BWD, bwdRelTableData->checkpoint(columnIDs));
+        checkpointStats(columnIDs, tableEntry);
         tableEntry->vacuumColumnIDs();
         hasChanges = false;
     }
@@ -103,11 +103,12 @@ bool RelTableData::delete_(Transaction* transaction, ValueVector& boundNodeIDVec
     return csrNodeGroup.delete_(transaction, source, rowIdx);
 }
 
-void RelTableData::addColumn(Transaction* transaction, TableAddColumnState& addColumnState) {
+void RelTableData::addColumn(Transaction* transaction, TableAddColumnState& addColumnState,
+    ColumnStats* newColumnStats) {
     auto& definition = addColumnState.propertyDefinition;
     columns.push_back(ColumnFactory::createColumn(definition.getName(), definition.getType().copy(),
         dataFH, bufferManager, shadowFile, enableCompression));
-    nodeGroups->addColumn(transaction, addColumnState);
+    nodeGroups->addColumn(transaction, addColumnState, newColumnStats);
 }
 
 std::pair<CSRNodeGroupScanSource, row_idx_t> RelTableData::findMatchingRow(Transaction* transaction,
@@ -194,7 +195,7 @@ void RelTableData::checkIfNodeHasRels(Transaction* transaction,
     }
 }
 
-void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs) {
+EquiDepthHistogram RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs) {
     std::vector<std::unique_ptr<Column>> checkpointColumns;
     for (auto i = 0u; i < columnIDs.size(); i++) {
         const auto columnID = columnIDs[i];
@@ -204,6 +205,7 @@ void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs) {
         csrHeaderColumns.offset.get(), csrHeaderColumns.length.get()};
     nodeGroups->checkpoint(state);
     columns = std::move(state.columns);
+    return std::move(state.degreeHistogram);
 }
 
 void RelTableData::serialize(Serializer& serializer) const {
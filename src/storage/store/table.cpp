@@ -5,6 +5,7 @@
 #include "storage/storage_manager.h"
 #include "storage/store/node_table.h"
 #include "storage/store/rel_table.h"
+#include "transaction/transaction.h"
 
 using namespace kuzu::common;
 
@@ -17,7 +18,8 @@ Table::Table(const catalog::TableCatalogEntry* tableEntry, StorageManager* stora
       tableName{tableEntry->getName()}, enableCompression{storageManager->compressionEnabled()},
       dataFH{storageManager->getDataFH()}, memoryManager{memoryManager},
       bufferManager{memoryManager->getBufferManager()},
-      shadowFile{&storageManager->getShadowFile()}, hasChanges{false} {}
+      shadowFile{&storageManager->getShadowFile()}, hasChanges{false},
+      stats{tableEntry->getStats()} {}
 
 std::unique_ptr<Table> Table::loadTable(Deserializer& deSer, const catalog::Catalog& catalog,
     StorageManager* storageManager, MemoryManager* memoryManager, VirtualFileSystem* vfs,
@@ -49,6 +51,71 @@ void Table::serialize(Serializer& serializer) const {
     serializer.write<table_id_t>(tableID);
 }
 
+ColumnStats Table::getColumnStats(column_id_t columnID) const {
+    std::unique_lock lck{statsMtx};
+    const auto columnStats = stats.getColumnStats(columnID);
+    return columnStats ? *columnStats : ColumnStats{};
+}
+
+EquiDepthHistogram Table::getDegreeHistogram(RelDataDirection direction) const {
+    std::unique_lock lck{statsMtx};
+    return stats.getDegreeHistogram(direction);
+}
+
+void Table::updateStats(transaction::Transaction* transaction,
+    const std::vector<column_id_t>& columnIDs, const ChunkedNodeGroup& chunkedGroup,
+    row_idx_t startRow, row_idx_t numRows) {
+    // Collect the stats of the chunks outside the lock, as concurrent COPY threads append here.
+    TableStats chunkStats;
+    chunkStats.update(columnIDs, chunkedGroup, startRow, numRows);
+    mergeStats(transaction, chunkStats);
+}
+
+void Table::mergeStats(transaction::Transaction* transaction, const TableStats& other) {
+    std::unique_lock lck{statsMtx};
+    if (!transaction->shouldAppendToUndoBuffer()) {
+        stats.merge(other);
+        return;
+    }
+    auto [it, isFirstUpdate] = uncommittedStats.try_emplace(transaction->getID());
+    if (isFirstUpdate) {
+        transaction->pushTableStats(*this);
+    }
+    it->second.merge(other);
+}
+
+void Table::mergeColumnStats(transaction::Transaction* transaction, column_id_t columnID,
+    const ColumnStats& other) {
+    TableStats columnStats;
+    columnStats.mergeColumnStats(columnID, other);
+    mergeStats(transaction, columnStats);
+}
+
+void Table::commitStats(transaction_t transactionID) {
+    std::unique_lock lck{statsMtx};
+    const auto it = uncommittedStats.find(transactionID);
+    KU_ASSERT(it != uncommittedStats.end());
+    stats.merge(it->second);
+    uncommittedStats.erase(it);
+}
+
+void Table::rollbackStats(transaction_t transactionID) {
+    std::unique_lock lck{statsMtx};
+    uncommittedStats.erase(transactionID);
+}
+
+void Table::setDegreeHistogram(RelDataDirection direction, EquiDepthHistogram histogram) {
+    std::unique_lock lck{statsMtx};
+    stats.setDegreeHistogram(direction, std::move(histogram));
+}
+
+void Table::checkpointStats(const std::vector<column_id_t>& columnIDs,
+    catalog::TableCatalogEntry* tableEntry) {
+    std::unique_lock lck{statsMtx};
+    stats.vacuumColumns(columnIDs);
+    tableEntry->setStats(stats);
+}
+
 std::unique_ptr<DataChunk> Table::constructDataChunk(const std::vector<LogicalType>& types) {
     auto dataChunk = std::make_unique<DataChunk>(types.size());
     for (auto i = 0u; i < types.size(); i++) {
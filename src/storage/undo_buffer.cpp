@@ -4,8 +4,10 @@
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "catalog/catalog_set.h"
+#include "storage/store/table.h"
 #include "storage/store/update_info.h"
 #include "storage/store/version_info.h"
+#include "transaction/transaction.h"
 
 using namespace kuzu::catalog;
 using namespace kuzu::common;
@@ -49,6 +51,10 @@ struct VectorUpdateRecord {
     VectorUpdateInfo* vectorUpdateInfo;
 };
 
+struct TableStatsRecord {
+    Table* table;
+};
+
 template<typename F>
 void UndoBufferIterator::iterate(F&& callback) {
     idx_t bufferIdx = 0;
@@ -143,6 +149,15 @@ void UndoBuffer::createVectorUpdateInfo(UpdateInfo* updateInfo, const idx_t vect
     *reinterpret_cast<VectorUpdateRecord*>(buffer) = vectorUpdateRecord;
 }
 
+void UndoBuffer::createTableStats(Table* table) {
+    auto buffer = createUndoRecord(sizeof(UndoRecordHeader) + sizeof(TableStatsRecord));
+    const UndoRecordHeader recordHeader{UndoRecordType::TABLE_STATS, sizeof(TableStatsRecord)};
+    *reinterpret_cast<UndoRecordHeader*>(buffer) = recordHeader;
+    buffer += sizeof(UndoRecordHeader);
+    const TableStatsRecord tableStatsRecord{table};
+    *reinterpret_cast<TableStatsRecord*>(buffer) = tableStatsRecord;
+}
+
 uint8_t* UndoBuffer::createUndoRecord(const uint64_t size) {
     std::unique_lock xLck{mtx};
     if (memoryBuffers.empty() || !memoryBuffers.back().canFit(size)) {
@@ -196,6 +211,9 @@ void UndoBuffer::commitRecord(UndoRecordType recordType, const uint8_t* record,
     case UndoRecordType::UPDATE_INFO: {
         commitVectorUpdateInfo(record, commitTS);
     } break;
+    case UndoRecordType::TABLE_STATS: {
+        commitTableStats(record);
+    } break;
     default:
         KU_UNREACHABLE;
     }
@@ -203,10 +221,11 @@ void UndoBuffer::commitRecord(UndoRecordType recordType, const uint8_t* record,
 
 void UndoBuffer::commitCatalogEntryRecord(const uint8_t* record,
     const transaction_t commitTS) const {
-    const auto& [_, catalogEntry] = *reinterpret_cast<CatalogEntryRecord const*>(record);
+    const auto& [catalogSet, catalogEntry] = *reinterpret_cast<CatalogEntryRecord const*>(record);
     const auto newCatalogEntry = catalogEntry->getNext();
     KU_ASSERT(newCatalogEntry);
     newCatalogEntry->setTimestamp(commitTS);
+    catalogSet->incrementVersion();
 }
 
 void UndoBuffer::commitVectorVersionInfo(UndoRecordType recordType, const uint8_t* record,
@@ -257,6 +276,9 @@ void UndoBuffer::rollbackRecord(const UndoRecordType recordType, const uint8_t*
     case UndoRecordType::UPDATE_INFO: {
         rollbackVectorUpdateInfo(record);
     } break;
+    case UndoRecordType::TABLE_STATS: {
+        rollbackTableStats(record);
+    } break;
     default: {
         KU_UNREACHABLE;
     }
@@ -287,6 +309,7 @@ void UndoBuffer::rollbackCatalogEntryRecord(const uint8_t* record) {
             catalogSet->emplaceNoLock(std::move(olderEntry));
         }
     }
+    catalogSet->incrementVersion();
 }
 
 void UndoBuffer::commitSequenceEntry(const uint8_t*, transaction_t) const {
@@ -341,5 +364,15 @@ void UndoBuffer::rollbackVectorUpdateInfo(const uint8_t* record) const {
     }
 }
 
+void UndoBuffer::commitTableStats(const uint8_t* record) const {
+    const auto& undoRecord = *reinterpret_cast<TableStatsRecord const*>(record);
+    undoRecord.table->commitStats(transaction->getID());
+}
+
+void UndoBuffer::rollbackTableStats(const uint8_t* record) const {
+    const auto& undoRecord = *reinterpret_cast<TableStatsRecord const*>(record);
+    undoRecord.table->rollbackStats(transaction->getID());
+}
+
 } // namespace storage
 } // namespace kuzu
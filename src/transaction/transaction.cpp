@@ -171,5 +171,9 @@ void Transaction::pushVectorUpdateInfo(storage::UpdateInfo& updateInfo,
     undoBuffer->createVectorUpdateInfo(&updateInfo, vectorIdx, &vectorUpdateInfo);
 }
 
+void Transaction::pushTableStats(storage::Table& table) const {
+    undoBuffer->createTableStats(&table);
+}
+
 } // namespace transaction
 } // namespace kuzu
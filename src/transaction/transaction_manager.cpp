@@ -13,6 +13,10 @@ using namespace kuzu::storage;
 namespace kuzu {
 namespace transaction {
 
+TransactionManager::~TransactionManager() {
+    stopBackgroundCheckpointer();
+}
+
 std::unique_ptr<Transaction> TransactionManager::beginTransaction(
     main::ClientContext& clientContext, TransactionType type) {
     // We obtain the lock for starting new transactions. In case this cannot be obtained this
@@ -62,8 +66,10 @@ void TransactionManager::commit(main::ClientContext& clientContext) {
         transaction->commitTS = lastTimestamp;
         transaction->commit(&wal);
         activeWriteTransactions.erase(transaction->getID());
-        if (transaction->shouldForceCheckpoint() || canAutoCheckpoint(clientContext)) {
+        if (transaction->shouldForceCheckpoint()) {
             checkpointNoLock(clientContext);
+        } else if (canAutoCheckpoint(clientContext)) {
+            autoCheckpointNoLock(clientContext);
         }
     } break;
     default: {
@@ -102,14 +108,138 @@ void TransactionManager::checkpoint(main::ClientContext& clientContext) {
     checkpointNoLock(clientContext);
 }
 
+void TransactionManager::autoCheckpointNoLock(main::ClientContext& clientContext) {
+    std::string lastBackgroundCheckpointError;
+    {
+        std::unique_lock<std::mutex> lck{mtxForBackgroundCheckpointer};
+        lastBackgroundCheckpointError = std::move(backgroundCheckpointError);
+        backgroundCheckpointError.clear();
+    }
+    // A threshold of 0 asks for a checkpoint after every commit, which then happens before the
+    // commit returns.
+    if (clientContext.getDBConfig()->checkpointThreshold > 0 &&
+        lastBackgroundCheckpointError.empty()) {
+        requestBackgroundCheckpoint(clientContext.getDatabase());
+        return;
+    }
+    try {
+        checkpointNoLock(clientContext);
+    } catch (std::exception& e) {
+        if (lastBackgroundCheckpointError.empty()) {
+            throw;
+        }
+        throw TransactionManagerException(std::string(e.what()) +
+                                          " The last automatic checkpoint failed as well: " +
+                                          lastBackgroundCheckpointError);
+    }
+}
+
+void TransactionManager::stopBackgroundCheckpointer() {
+    {
+        std::unique_lock<std::mutex> lck{mtxForBackgroundCheckpointer};
+        stopBackgroundCheckpointerRequested = true;
+        cvForBackgroundCheckpointer.notify_all();
+    }
+    if (backgroundCheckpointer.joinable()) {
+        backgroundCheckpointer.join();
+    }
+}
+
+void TransactionManager::requestBackgroundCheckpoint(main::Database* database) {
+    std::unique_lock<std::mutex> lck{mtxForBackgroundCheckpointer};
+    if (stopBackgroundCheckpointerRequested) {
+        return;
+    }
+    if (!backgroundCheckpointer.joinable()) {
+        backgroundCheckpointer =
+            std::thread([this, database]() { runBackgroundCheckpointer(database); });
+    }
+    backgroundCheckpointRequested = true;
+    cvForBackgroundCheckpointer.notify_all();
+}
+
+void TransactionManager::runBackgroundCheckpointer(main::Database* database) {
+    main::ClientContext clientContext(database);
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lck{mtxForBackgroundCheckpointer};
+            cvForBackgroundCheckpointer.wait(lck, [&] {
+                return backgroundCheckpointRequested || stopBackgroundCheckpointerRequested;
+            });
+            if (stopBackgroundCheckpointerRequested) {
+                return;
+            }
+            backgroundCheckpointRequested = false;
+        }
+        try {
+            checkpointWhenNoTransactionIsActive(clientContext);
+        } catch (std::exception& e) {
+            // The WAL is kept. The next commit crossing the checkpoint threshold checkpoints
+            // synchronously, which reports the error to its client if it persists.
+            std::unique_lock<std::mutex> lck{mtxForBackgroundCheckpointer};
+            backgroundCheckpointError = e.what();
+        }
+    }
+}
+
+void TransactionManager::checkpointWhenNoTransactionIsActive(main::ClientContext& clientContext) {
+    // Unlike checkpointNoLock(), we first do not stop new transactions while waiting for the
+    // active ones to leave. Transactions keep starting, committing and rolling back until there is
+    // a moment no transaction is active.
+    if (checkpointOnceNoTransactionIsActive(clientContext)) {
+        return;
+    }
+    // Under steady load, there may be no such moment. We then stop new transactions, but unlike
+    // checkpointNoLock(), still let the active ones commit or roll back.
+    std::unique_lock<std::mutex> newTransactionLck{mtxForStartingNewTransactions};
+    if (!checkpointOnceNoTransactionIsActive(clientContext)) {
+        throw TransactionManagerException(
+            "Timeout waiting for active transactions to leave the system before checkpointing.");
+    }
+}
+
+bool TransactionManager::checkpointOnceNoTransactionIsActive(main::ClientContext& clientContext) {
+    uint64_t numTimesWaited = 0;
+    while (true) {
+        {
+            // Holding the lock for public functions keeps new transactions from starting until
+            // the checkpoint is done.
+            std::unique_lock<std::mutex> lck{mtxForSerializingPublicFunctionCalls};
+            if (canCheckpointNoLock()) {
+                checkpointWaiting = false;
+                checkpointStorageNoLock(clientContext);
+                return true;
+            }
+        }
+        {
+            std::unique_lock<std::mutex> lck{mtxForBackgroundCheckpointer};
+            if (stopBackgroundCheckpointerRequested) {
+                checkpointWaiting = false;
+                return true;
+            }
+        }
+        checkpointWaiting = true;
+        numTimesWaited++;
+        if (numTimesWaited * THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS >
+            checkpointWaitTimeoutInMicros) {
+            checkpointWaiting = false;
+            return false;
+        }
+        std::this_thread::sleep_for(
+            std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
+    }
+}
+
 void TransactionManager::stopNewTransactionsAndWaitUntilAllTransactionsLeave() {
     mtxForStartingNewTransactions.lock();
     uint64_t numTimesWaited = 0;
     while (true) {
         if (!canCheckpointNoLock()) {
+            checkpointWaiting = true;
             numTimesWaited++;
             if (numTimesWaited * THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS >
                 checkpointWaitTimeoutInMicros) {
+                checkpointWaiting = false;
                 mtxForStartingNewTransactions.unlock();
                 throw TransactionManagerException(
                     "Timeout waiting for active transactions to leave the system before "
@@ -119,6 +249,7 @@ void TransactionManager::stopNewTransactionsAndWaitUntilAllTransactionsLeave() {
             std::this_thread::sleep_for(
                 std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
         } else {
+            checkpointWaiting = false;
             break;
         }
     }
@@ -156,6 +287,12 @@ void TransactionManager::checkpointNoLock(main::ClientContext& clientContext) {
     // query stop working on the tasks of the query and these tasks are removed from the
     // query.
     stopNewTransactionsAndWaitUntilAllTransactionsLeave();
+    checkpointStorageNoLock(clientContext);
+    // Resume receiving new transactions.
+    allowReceivingNewTransactions();
+}
+
+void TransactionManager::checkpointStorageNoLock(main::ClientContext& clientContext) {
     // Checkpoint node/relTables, which writes the updated/newly-inserted pages and metadata to
     // disk.
     clientContext.getStorageManager()->checkpoint(clientContext);
@@ -178,8 +315,8 @@ void TransactionManager::checkpointNoLock(main::ClientContext& clientContext) {
     clientContext.getStorageManager()->getShadowFile().clearAll(clientContext);
     StorageUtils::removeWALVersionFiles(clientContext.getDatabasePath(),
         clientContext.getVFSUnsafe());
-    // Resume receiving new transactions.
-    allowReceivingNewTransactions();
+    std::unique_lock<std::mutex> lck{mtxForBackgroundCheckpointer};
+    backgroundCheckpointError.clear();
 }
 
 } // namespace transaction
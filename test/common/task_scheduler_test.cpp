@@ -0,0 +1,189 @@
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "common/exception/runtime.h"
+#include "common/task_system/parallel_for.h"
+#include "common/task_system/task_scheduler.h"
+#include "graph_test/graph_test.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace testing {
+
+// Records the threads and the order in which the tasks of a test run, and how many of them run at
+// the same time.
+struct TaskLog {
+    std::mutex mtx;
+    std::condition_variable cv;
+    uint64_t numRunning = 0;
+    uint64_t maxNumRunning = 0;
+    std::vector<std::string> finishedTasks;
+    std::set<std::thread::id> threadIDs;
+};
+
+class LoggingTask final : public Task {
+public:
+    LoggingTask(std::string name, TaskLog& log, uint64_t numTasksToWaitFor = 1,
+        bool throwException = false)
+        : Task{1 /* maxNumThreads */}, name{std::move(name)}, log{log},
+          numTasksToWaitFor{numTasksToWaitFor}, throwException{throwException} {}
+
+    void run() override {
+        std::unique_lock lck{log.mtx};
+        log.threadIDs.insert(std::this_thread::get_id());
+        log.numRunning++;
+        log.maxNumRunning = std::max(log.maxNumRunning, log.numRunning);
+        log.cv.notify_all();
+        // Give the other tasks a chance to run at the same time.
+        log.cv.wait_for(lck, std::chrono::milliseconds(500),
+            [&] { return log.numRunning >= numTasksToWaitFor; });
+        log.numRunning--;
+        log.finishedTasks.push_back(name);
+        log.cv.notify_all();
+        if (throwException) {
+            throw RuntimeException(name + " failed.");
+        }
+    }
+
+private:
+    std::string name;
+    TaskLog& log;
+    uint64_t numTasksToWaitFor;
+    bool throwException;
+};
+
+class TaskSchedulerTest : public DBTest {
+public:
+    std::string getInputDir() override { return "empty"; }
+
+    void SetUp() override {
+        DBTest::SetUp();
+        taskScheduler = std::make_unique<TaskScheduler>(2 /* numWorkerThreads */);
+        executionContext =
+            std::make_unique<ExecutionContext>(nullptr, getClientContext(*conn), 0 /* queryID */);
+    }
+
+    void TearDown() override {
+        taskScheduler.reset();
+        DBTest::TearDown();
+    }
+
+protected:
+    std::unique_ptr<TaskScheduler> taskScheduler;
+    std::unique_ptr<ExecutionContext> executionContext;
+};
+
+TEST_F(TaskSchedulerTest, ScheduleChildrenConcurrently) {
+    TaskLog log;
+    auto root = std::make_shared<LoggingTask>("root", log);
+    root->setMaxNumConcurrentChildren(2);
+    auto child0 = std::make_unique<LoggingTask>("child0", log, 2 /* numTasksToWaitFor */);
+    auto child1 = std::make_unique<LoggingTask>("child1", log, 2 /* numTasksToWaitFor */);
+    child1->setMaxNumConcurrentChildren(2);
+    child1->addChildTask(std::make_unique<LoggingTask>("grandChild", log));
+    root->addChildTask(std::move(child0));
+    root->addChildTask(std::move(child1));
+    taskScheduler->scheduleTaskAndWaitOrError(root, executionContext.get());
+    ASSERT_EQ(log.maxNumRunning, 2);
+    ASSERT_EQ(log.finishedTasks.size(), 4);
+    // A task only runs once its children have finished.
+    auto position = [&](const std::string& name) {
+        return std::find(log.finishedTasks.begin(), log.finishedTasks.end(), name) -
+               log.finishedTasks.begin();
+    };
+    ASSERT_LT(position("grandChild"), position("child1"));
+    ASSERT_EQ(position("root"), 3);
+    // The children are run by the workers, not by threads started to wait for them.
+    ASSERT_EQ(log.threadIDs.size(), 2);
+    ASSERT_FALSE(log.threadIDs.contains(std::this_thread::get_id()));
+}
+
+TEST_F(TaskSchedulerTest, ScheduleChildrenSequentially) {
+    TaskLog log;
+    auto root = std::make_shared<LoggingTask>("root", log);
+    for (auto i = 0u; i < 3; i++) {
+        root->addChildTask(std::make_unique<LoggingTask>("child" + std::to_string(i), log,
+            2 /* numTasksToWaitFor */));
+    }
+    taskScheduler->scheduleTaskAndWaitOrError(root, executionContext.get());
+    ASSERT_EQ(log.maxNumRunning, 1);
+    ASSERT_EQ(log.finishedTasks,
+        (std::vector<std::string>{"child0", "child1", "child2", "root"}));
+}
+
+TEST_F(TaskSchedulerTest, ScheduleChildrenConcurrentlyWithError) {
+    TaskLog log;
+    auto root = std::make_shared<LoggingTask>("root", log);
+    root->setMaxNumConcurrentChildren(2);
+    root->addChildTask(std::make_unique<LoggingTask>("child0", log, 1 /* numTasksToWaitFor */,
+        true /* throwException */));
+    for (auto i = 1u; i < 4; i++) {
+        root->addChildTask(std::make_unique<LoggingTask>("child" + std::to_string(i), log));
+    }
+    ASSERT_THROW(taskScheduler->scheduleTaskAndWaitOrError(root, executionContext.get()),
+        RuntimeException);
+    // The root and the children that were not scheduled yet are skipped.
+    ASSERT_TRUE(std::find(log.finishedTasks.begin(), log.finishedTasks.end(), "root") ==
+                log.finishedTasks.end());
+    ASSERT_LT(log.finishedTasks.size(), 5);
+}
+
+TEST_F(TaskSchedulerTest, ParallelFor) {
+    constexpr uint64_t numItems = 1000;
+    std::vector<uint64_t> itemCounts(numItems, 0);
+    std::mutex mtx;
+    std::set<uint64_t> threadIdxes;
+    parallelFor(*taskScheduler, 4 /* numThreads */, numItems,
+        [&](uint64_t threadIdx, uint64_t itemIdx) {
+            itemCounts[itemIdx]++;
+            std::unique_lock lck{mtx};
+            threadIdxes.insert(threadIdx);
+        });
+    ASSERT_EQ(std::count(itemCounts.begin(), itemCounts.end(), 1), numItems);
+    // The calling thread and up to the two workers of the scheduler.
+    ASSERT_LE(threadIdxes.size(), 3);
+    ASSERT_TRUE(threadIdxes.contains(0));
+    ASSERT_THROW(parallelFor(*taskScheduler, 4 /* numThreads */, numItems,
+                     [&](uint64_t, uint64_t itemIdx) {
+                         if (itemIdx == 10) {
+                             throw RuntimeException("Item failed.");
+                         }
+                     }),
+        RuntimeException);
+}
+
+// parallelFor() must complete even if it is called by a worker while all other workers are busy,
+// e.g. when a task finalizes.
+TEST_F(TaskSchedulerTest, ParallelForInFinalize) {
+    class FinalizingTask final : public Task {
+    public:
+        FinalizingTask(TaskScheduler& taskScheduler, std::atomic<uint64_t>& numItemsProcessed)
+            : Task{1 /* maxNumThreads */}, taskScheduler{taskScheduler},
+              numItemsProcessed{numItemsProcessed} {}
+
+        void run() override {}
+        void finalizeIfNecessary() override {
+            parallelFor(taskScheduler, 4 /* numThreads */, 100 /* numItems */,
+                [&](uint64_t, uint64_t) { numItemsProcessed++; });
+        }
+
+    private:
+        TaskScheduler& taskScheduler;
+        std::atomic<uint64_t>& numItemsProcessed;
+    };
+    std::atomic<uint64_t> numItemsProcessed{0};
+    auto root = std::make_shared<FinalizingTask>(*taskScheduler, numItemsProcessed);
+    root->setMaxNumConcurrentChildren(2);
+    root->addChildTask(std::make_unique<FinalizingTask>(*taskScheduler, numItemsProcessed));
+    root->addChildTask(std::make_unique<FinalizingTask>(*taskScheduler, numItemsProcessed));
+    taskScheduler->scheduleTaskAndWaitOrError(root, executionContext.get());
+    ASSERT_EQ(numItemsProcessed.load(), 300);
+}
+
+} // namespace testing
+} // namespace kuzu
@@ -1,7 +1,17 @@
+#include "catalog/catalog.h"
+#include "function/gds/gds_frontier.h"
+#include "function/gds/gds_node_values.h"
+#include "function/gds/gds_utils.h"
+#include "graph/graph_entry.h"
+#include "graph/in_mem_graph.h"
+#include "graph/on_disk_graph.h"
 #include "graph_test/graph_test.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
 #include "test_runner/test_runner.h"
 
 using namespace kuzu::testing;
+using namespace kuzu::function;
 
 class GDSUtilsTest : public BaseGraphTest {
 public:
@@ -32,3 +42,194 @@ public:
 //                             "RETURN *;")
 //                     ->isSuccess());
 // }
+
+// BFS levels of the nodes of a graph, kept in GDSNodeValues. Like the shortest paths frontier, it
+// represents both the current and the next frontier: at iteration i, the nodes at level i are in
+// the current frontier, and setting a node active puts it at level i + 1.
+class BFSLevels final : public GDSFrontier {
+public:
+    static constexpr uint8_t UNVISITED = 255;
+
+    explicit BFSLevels(kuzu::graph::Graph& graph) : levels{graph, UNVISITED} {}
+
+    bool isActive(nodeID_t nodeID) override { return levels.getValue(nodeID) == curIter; }
+    void setActive(nodeID_t nodeID) override {
+        if (levels.getValue(nodeID) == UNVISITED) {
+            levels.setValue(nodeID, curIter + 1);
+        }
+    }
+    bool isVisited(nodeID_t nodeID) const { return levels.getValue(nodeID) != UNVISITED; }
+    uint8_t getLevel(nodeID_t nodeID) const { return levels.getValue(nodeID); }
+
+    void incrementCurIter() { curIter++; }
+
+private:
+    uint8_t curIter = UNVISITED;
+    GDSNodeValues<uint8_t> levels;
+};
+
+// Frontiers of a BFS over a single node table, which records the direction of each iteration.
+class BFSFrontiers final : public Frontiers {
+    static constexpr uint64_t FRONTIER_MORSEL_SIZE = 16;
+
+public:
+    BFSFrontiers(BFSLevels& levels, uint64_t numNodes)
+        : Frontiers{&levels, &levels, 1 /* initialActiveNodes */}, levels{levels},
+          numNodes{numNodes} {}
+
+    bool getNextFrontierMorsel(RangeFrontierMorsel& frontierMorsel) override {
+        const auto beginOffset = nextOffset.fetch_add(FRONTIER_MORSEL_SIZE);
+        if (beginOffset >= numNodes) {
+            return false;
+        }
+        frontierMorsel.initMorsel(tableID, beginOffset,
+            std::min(beginOffset + FRONTIER_MORSEL_SIZE, numNodes));
+        return true;
+    }
+
+    void beginFrontierComputeBetweenTables(table_id_t curFrontierTableID,
+        table_id_t nextFrontierTableID) override {
+        KU_ASSERT(curFrontierTableID == nextFrontierTableID);
+        tableID = curFrontierTableID;
+        nextOffset.store(0);
+    }
+
+    void beginNewIterationInternalNoLock() override {
+        levels.incrementCurIter();
+        directions.push_back(direction);
+    }
+
+    std::vector<FrontierDirection> directions;
+
+private:
+    BFSLevels& levels;
+    uint64_t numNodes;
+    table_id_t tableID = INVALID_TABLE_ID;
+    std::atomic<offset_t> nextOffset;
+};
+
+class BFSCompute final : public FrontierCompute {
+public:
+    explicit BFSCompute(BFSLevels& levels) : levels{levels} {}
+
+    bool edgeCompute(nodeID_t, nodeID_t nbrID) override { return !levels.isVisited(nbrID); }
+    bool canPull() const override { return true; }
+    bool isPullCandidate(nodeID_t nodeID) override { return !levels.isVisited(nodeID); }
+
+private:
+    BFSLevels& levels;
+};
+
+class GDSFrontiersTest : public DBTest {
+public:
+    std::string getInputDir() override { return "empty"; }
+
+    void SetUp() override {
+        DBTest::SetUp();
+        // Node 0 reaches nodes 1 to NUM_LEAVES, which all reach node NUM_LEAVES + 1, which reaches
+        // node NUM_LEAVES + 2. So the frontier is large in the second iteration only.
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE N(id INT64, PRIMARY KEY(id))")->isSuccess());
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE M(id INT64, PRIMARY KEY(id))")->isSuccess());
+        ASSERT_TRUE(conn->query("CREATE REL TABLE E(FROM N TO N)")->isSuccess());
+        ASSERT_TRUE(conn->query("UNWIND range(0, " + std::to_string(NUM_LEAVES + 2) +
+                                ") AS i CREATE (:N {id: i})")
+                        ->isSuccess());
+        ASSERT_TRUE(conn->query("UNWIND range(0, 9) AS i CREATE (:M {id: i})")->isSuccess());
+        ASSERT_TRUE(conn->query("MATCH (a:N), (b:N) WHERE a.id = 0 AND b.id >= 1 AND b.id <= " +
+                                std::to_string(NUM_LEAVES) + " CREATE (a)-[:E]->(b)")
+                        ->isSuccess());
+        ASSERT_TRUE(conn->query("MATCH (a:N), (b:N) WHERE a.id >= 1 AND a.id <= " +
+                                std::to_string(NUM_LEAVES) + " AND b.id = " +
+                                std::to_string(NUM_LEAVES + 1) + " CREATE (a)-[:E]->(b)")
+                        ->isSuccess());
+        ASSERT_TRUE(conn->query("MATCH (a:N), (b:N) WHERE a.id = " +
+                                std::to_string(NUM_LEAVES + 1) + " AND b.id = " +
+                                std::to_string(NUM_LEAVES + 2) + " CREATE (a)-[:E]->(b)")
+                        ->isSuccess());
+        conn->query("BEGIN TRANSACTION");
+        context = getClientContext(*conn);
+        auto catalog = context->getCatalog();
+        nodeTableID = catalog->getTableID(context->getTx(), "N");
+        entry = std::make_unique<kuzu::graph::GraphEntry>(
+            std::vector<table_id_t>{nodeTableID},
+            std::vector<table_id_t>{catalog->getTableID(context->getTx(), "E")});
+        graph = std::make_unique<kuzu::graph::OnDiskGraph>(context, *entry);
+        executionContext =
+            std::make_unique<kuzu::processor::ExecutionContext>(nullptr, context, 0 /* queryID */);
+    }
+
+    void TearDown() override {
+        graph.reset();
+        conn->query("COMMIT");
+        DBTest::TearDown();
+    }
+
+    // Runs a BFS from node 0 and checks the levels of all nodes.
+    std::vector<FrontierDirection> runBFS(kuzu::graph::Graph& bfsGraph) {
+        BFSLevels levels{bfsGraph};
+        levels.setActive(nodeID_t{0, nodeTableID});
+        BFSFrontiers frontiers{levels, bfsGraph.getNumNodes(nodeTableID)};
+        BFSCompute compute{levels};
+        GDSUtils::runFrontiersUntilConvergence(executionContext.get(), frontiers, &bfsGraph,
+            compute, 10 /* maxIters */);
+        EXPECT_EQ(levels.getLevel(nodeID_t{0, nodeTableID}), 0);
+        for (auto i = 1u; i <= NUM_LEAVES; i++) {
+            EXPECT_EQ(levels.getLevel(nodeID_t{i, nodeTableID}), 1);
+        }
+        EXPECT_EQ(levels.getLevel(nodeID_t{NUM_LEAVES + 1, nodeTableID}), 2);
+        EXPECT_EQ(levels.getLevel(nodeID_t{NUM_LEAVES + 2, nodeTableID}), 3);
+        return frontiers.directions;
+    }
+
+protected:
+    static constexpr uint64_t NUM_LEAVES = 99;
+
+    kuzu::main::ClientContext* context;
+    table_id_t nodeTableID;
+    std::unique_ptr<kuzu::graph::GraphEntry> entry;
+    std::unique_ptr<kuzu::graph::OnDiskGraph> graph;
+    std::unique_ptr<kuzu::processor::ExecutionContext> executionContext;
+};
+
+TEST_F(GDSFrontiersTest, NodeValues) {
+    auto catalog = context->getCatalog();
+    auto otherTableID = catalog->getTableID(context->getTx(), "M");
+    kuzu::graph::GraphEntry twoTableEntry{std::vector<table_id_t>{nodeTableID, otherTableID},
+        std::vector<table_id_t>{}};
+    kuzu::graph::OnDiskGraph twoTableGraph{context, twoTableEntry};
+    GDSNodeValues<uint64_t> values{twoTableGraph, 7};
+    for (auto tableID : {nodeTableID, otherTableID}) {
+        for (auto offset = 0u; offset < twoTableGraph.getNumNodes(tableID); offset++) {
+            ASSERT_EQ(values.getValue(nodeID_t{offset, tableID}), 7);
+        }
+    }
+    // Values are indexed by offset within each node table.
+    values.setValue(nodeID_t{3, nodeTableID}, 1);
+    values.setValue(nodeID_t{3, otherTableID}, 2);
+    values.setValue(nodeID_t{NUM_LEAVES + 2, nodeTableID}, 3);
+    ASSERT_EQ(values.getValue(nodeID_t{3, nodeTableID}), 1);
+    ASSERT_EQ(values.getValue(nodeID_t{3, otherTableID}), 2);
+    ASSERT_EQ(values.getValue(nodeID_t{NUM_LEAVES + 2, nodeTableID}), 3);
+    ASSERT_EQ(values.getValue(nodeID_t{2, nodeTableID}), 7);
+    ASSERT_EQ(values.getTableValues(otherTableID)[3].load(), 2);
+    ASSERT_EQ(values.getTableValues(nodeTableID)[NUM_LEAVES + 2].load(), 3);
+}
+
+// The frontier of the second iteration holds almost all nodes, so it pulls. The frontiers before
+// and after it hold a single node, so they push.
+TEST_F(GDSFrontiersTest, SwitchBetweenPushAndPull) {
+    auto directions = runBFS(*graph);
+    ASSERT_EQ(directions, (std::vector<FrontierDirection>{FrontierDirection::PUSH,
+                              FrontierDirection::PULL, FrontierDirection::PUSH,
+                              FrontierDirection::PUSH}));
+}
+
+// An in-memory graph projects its backward adjLists only once a frontier pulls.
+TEST_F(GDSFrontiersTest, ProjectBwdAdjListsOnPull) {
+    auto inMemGraph = kuzu::graph::InMemGraph::project(context, *graph,
+        std::nullopt /* edgePropertyName */, false /* projectBwd */);
+    ASSERT_FALSE(inMemGraph->hasBwdCSRs());
+    auto directions = runBFS(*inMemGraph);
+    ASSERT_EQ(directions[1], FrontierDirection::PULL);
+    ASSERT_TRUE(inMemGraph->hasBwdCSRs());
+}
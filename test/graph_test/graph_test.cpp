@@ -29,6 +29,11 @@ void DBTest::createDB(uint64_t checkpointWaitTimeout) {
     spdlog::set_level(spdlog::level::info);
 }
 
+void DBTest::setCheckpointWaitTimeout(uint64_t waitTimeInMicros) {
+    getTransactionManager(*database)->setCheckPointWaitTimeoutForTransactionsToLeaveInMicros(
+        waitTimeInMicros);
+}
+
 void DBTest::createNewDB() {
     database.reset();
     conn.reset();
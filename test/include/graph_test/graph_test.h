@@ -76,6 +76,9 @@ public:
         uint64_t checkpointWaitTimeout = common::DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS,
         std::set<std::string> connNames = std::set<std::string>());
 
+protected:
+    void setCheckpointWaitTimeout(uint64_t waitTimeInMicros);
+
 protected:
     bool isConcurrent = false;
     bool connectionsPaused = false;
@@ -18,6 +18,44 @@ TEST_F(ArrowTest, getArrowResult) {
     arrowArray->release(arrowArray.get());
 }
 
+TEST_F(ArrowTest, getArrowResultColumnar) {
+    // Chunks of 3 tuples end in the middle of the unflat b.age column of some a.
+    auto query = "MATCH (a:person)-[:knows]->(b:person) RETURN a.ID, b.age";
+    auto result = conn->query(query);
+    std::vector<int64_t> expected;
+    while (result->hasNext()) {
+        auto tuple = result->getNext();
+        expected.push_back(tuple->getValue(0)->getValue<int64_t>());
+        expected.push_back(tuple->getValue(1)->getValue<int64_t>());
+    }
+    result = conn->query(query);
+    std::vector<int64_t> actual;
+    while (true) {
+        auto arrowArray = result->getNextArrowChunk(3);
+        if (arrowArray->length == 0) {
+            arrowArray->release(arrowArray.get());
+            break;
+        }
+        ASSERT_LE(arrowArray->length, 3);
+        auto ids = static_cast<const int64_t*>(arrowArray->children[0]->buffers[1]);
+        auto ages = static_cast<const int64_t*>(arrowArray->children[1]->buffers[1]);
+        for (auto i = 0; i < arrowArray->length; i++) {
+            actual.push_back(ids[i]);
+            actual.push_back(ages[i]);
+        }
+        arrowArray->release(arrowArray.get());
+    }
+    ASSERT_EQ(actual, expected);
+
+    result = conn->query("UNWIND [1, null, 3] AS x RETURN x");
+    auto arrowArray = result->getNextArrowChunk(3);
+    ASSERT_EQ(arrowArray->length, 3);
+    ASSERT_EQ(arrowArray->children[0]->null_count, 1);
+    auto validity = static_cast<const uint8_t*>(arrowArray->children[0]->buffers[0]);
+    ASSERT_EQ(validity[0] & 0b111, 0b101);
+    arrowArray->release(arrowArray.get());
+}
+
 TEST_F(ArrowTest, getArrowSchema) {
     auto query = "MATCH (a:person) RETURN a.fName as NAME";
     auto result = conn->query(query);
@@ -1,6 +1,7 @@
 #include <memory>
 #include <thread>
 
+#include "common/exception/runtime.h"
 #include "main/connection.h"
 #include "main/database.h"
 
@@ -98,6 +99,55 @@ TEST_F(ApiTest, TimeOut) {
     ASSERT_EQ(result->getErrorMessage(), "Interrupted.");
 }
 
+TEST_F(ApiTest, StreamResult) {
+    ASSERT_TRUE(conn->query("CALL enable_result_streaming=true")->isSuccess());
+    auto result = conn->query("UNWIND range(1, 100000) AS x RETURN x;");
+    ASSERT_TRUE(result->isSuccess());
+    auto expected = 1;
+    while (result->hasNext()) {
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), expected++);
+    }
+    ASSERT_EQ(expected, 100001);
+    result = conn->query("UNWIND range(1, 100000) AS x RETURN x;");
+    ASSERT_EQ(result->getNumTuples(), 100000);
+    // Running another statement on the connection stops the streamed query.
+    result = conn->query("UNWIND range(1, 100000) AS x RETURN x;");
+    ApiTest::assertMatchPersonCountStar(conn.get());
+    auto readResult = [&]() {
+        while (result->hasNext()) {
+            result->getNext();
+        }
+    };
+    ASSERT_THROW(readResult(), RuntimeException);
+}
+
+// Streamed results that are not read must not hold up the queries of other connections.
+TEST_F(ApiTest, StreamResultWhileOtherConnectionsRun) {
+    std::vector<std::unique_ptr<Connection>> streamingConns;
+    std::vector<std::unique_ptr<QueryResult>> results;
+    // More streamed queries than worker threads.
+    for (auto i = 0u; i < 4; i++) {
+        auto streamingConn = std::make_unique<Connection>(database.get());
+        ASSERT_TRUE(streamingConn->query("CALL enable_result_streaming=true")->isSuccess());
+        results.push_back(streamingConn->query(
+            "MATCH (a:person) UNWIND range(1, 100000) AS x RETURN a.ID, x;"));
+        ASSERT_TRUE(results.back()->isSuccess());
+        streamingConns.push_back(std::move(streamingConn));
+    }
+    ApiTest::assertMatchPersonCountStar(conn.get());
+    auto result = conn->query("MATCH (a:person)-[:knows]->(b:person) RETURN COUNT(*)");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 14);
+    for (auto& streamedResult : results) {
+        auto numTuples = 0u;
+        while (streamedResult->hasNext()) {
+            streamedResult->getNext();
+            numTuples++;
+        }
+        ASSERT_EQ(numTuples, 800000);
+    }
+}
+
 TEST_F(ApiTest, MultipleQueryExplain) {
     auto result = conn->query("EXPLAIN MATCH (a:person)-[:knows]->(b:person), "
                               "(b)-[:knows]->(a) RETURN a.fName, b.fName ORDER BY a.ID; MATCH "
@@ -254,3 +254,58 @@ TEST_F(ApiTest, ParameterWith) {
     auto groupTruth = std::vector<std::string>{"abc"};
     ASSERT_EQ(groupTruth, TestHelper::convertResultToString(*result));
 }
+
+TEST_F(ApiTest, ReusePlanOfPreparedStatement) {
+    auto preparedStatement = conn->prepare("MATCH (a:person) WHERE a.ID = $id RETURN a.fName");
+    // The type of the parameter is only known once it is bound, so the first execution plans the
+    // statement. Later executions reuse the plan and spend no time compiling it.
+    auto result = conn->execute(preparedStatement.get(), std::make_pair(std::string("id"), 0));
+    ASSERT_EQ(std::vector<std::string>{"Alice"}, TestHelper::convertResultToString(*result));
+    ASSERT_GT(result->getQuerySummary()->getCompilingTime(), 0);
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("id"), 2));
+    ASSERT_EQ(std::vector<std::string>{"Bob"}, TestHelper::convertResultToString(*result));
+    ASSERT_EQ(result->getQuerySummary()->getCompilingTime(), 0);
+    // The parameter has a different type, so the statement is bound again.
+    result =
+        conn->execute(preparedStatement.get(), std::make_pair(std::string("id"), (int64_t)3));
+    ASSERT_EQ(std::vector<std::string>{"Carol"}, TestHelper::convertResultToString(*result));
+    ASSERT_GT(result->getQuerySummary()->getCompilingTime(), 0);
+    // The new plan is kept for later executions with the same parameter type.
+    result =
+        conn->execute(preparedStatement.get(), std::make_pair(std::string("id"), (int64_t)0));
+    ASSERT_EQ(std::vector<std::string>{"Alice"}, TestHelper::convertResultToString(*result));
+    ASSERT_EQ(result->getQuerySummary()->getCompilingTime(), 0);
+}
+
+TEST_F(ApiTest, ReplanPreparedStatementAfterDDL) {
+    auto preparedStatement = conn->prepare("MATCH (a:person) WHERE a.ID = $id RETURN a.gender");
+    auto result = conn->execute(preparedStatement.get(), std::make_pair(std::string("id"), 0));
+    ASSERT_EQ(std::vector<std::string>{"1"}, TestHelper::convertResultToString(*result));
+    ASSERT_TRUE(conn->query("ALTER TABLE person DROP gender")->isSuccess());
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("id"), 0));
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_TRUE(conn->query("ALTER TABLE person ADD gender INT64 DEFAULT 7")->isSuccess());
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("id"), 0));
+    ASSERT_EQ(std::vector<std::string>{"7"}, TestHelper::convertResultToString(*result));
+}
+
+TEST_F(ApiTest, QueryCache) {
+    ASSERT_TRUE(conn->query("CALL query_cache_size=2")->isSuccess());
+    auto query = "MATCH (a:person) WHERE a.ID = 0 RETURN a.gender";
+    auto result = conn->query(query);
+    ASSERT_EQ(std::vector<std::string>{"1"}, TestHelper::convertResultToString(*result));
+    ASSERT_GT(result->getQuerySummary()->getCompilingTime(), 0);
+    // Cache hits skip compiling the query.
+    result = conn->query(query);
+    ASSERT_EQ(std::vector<std::string>{"1"}, TestHelper::convertResultToString(*result));
+    ASSERT_EQ(result->getQuerySummary()->getCompilingTime(), 0);
+    ASSERT_TRUE(conn->query("ALTER TABLE person DROP gender")->isSuccess());
+    ASSERT_FALSE(conn->query(query)->isSuccess());
+    ASSERT_TRUE(conn->query("ALTER TABLE person ADD gender INT64 DEFAULT 7")->isSuccess());
+    result = conn->query(query);
+    ASSERT_EQ(std::vector<std::string>{"7"}, TestHelper::convertResultToString(*result));
+    ASSERT_GT(result->getQuerySummary()->getCompilingTime(), 0);
+    result = conn->query(query);
+    ASSERT_EQ(std::vector<std::string>{"7"}, TestHelper::convertResultToString(*result));
+    ASSERT_EQ(result->getQuerySummary()->getCompilingTime(), 0);
+}
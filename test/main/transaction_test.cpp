@@ -1,4 +1,10 @@
+#include <atomic>
+#include <thread>
+
 #include "main_test_helper/private_main_test_helper.h"
+#include "storage/storage_manager.h"
+#include "storage/wal/wal.h"
+#include "transaction/transaction_manager.h"
 
 using namespace kuzu::common;
 using namespace kuzu::testing;
@@ -60,3 +66,124 @@ TEST_F(PrivateApiTest, CommitRollbackRemoveActiveTransaction) {
     conn->query("COMMIT;");
     ASSERT_FALSE(hasActiveTransaction(*conn));
 }
+
+// A background checkpoint waiting for the transactions of streamed results that nobody reads lets
+// these queries finish, so that the checkpoint can run.
+TEST_F(PrivateApiTest, CheckpointWithUnreadStreamedResult) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    setCheckpointWaitTimeout(60000000 /* 60s */);
+    auto streamingConn = std::make_unique<kuzu::main::Connection>(database.get());
+    ASSERT_TRUE(streamingConn->query("CALL enable_result_streaming=true")->isSuccess());
+    auto streamedResult =
+        streamingConn->query("MATCH (a:person) UNWIND range(1, 100000) AS x RETURN a.ID, x;");
+    ASSERT_TRUE(streamedResult->isSuccess());
+    ASSERT_TRUE(conn->query("CALL checkpoint_threshold=1")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 100})")->isSuccess());
+    auto& wal = getClientContext(*conn)->getStorageManager()->getWAL();
+    for (auto i = 0u; i < 6000 && wal.getFileSize() > 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(wal.getFileSize(), 0);
+    auto numTuples = 0u;
+    while (streamedResult->hasNext()) {
+        streamedResult->getNext();
+        numTuples++;
+    }
+    ASSERT_EQ(numTuples, 800000);
+}
+
+static void waitUntilWALIsEmpty(const kuzu::storage::WAL& wal) {
+    for (auto i = 0u; i < 6000 && wal.getFileSize() > 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+TEST_F(PrivateApiTest, AutoCheckpointInBackground) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    setCheckpointWaitTimeout(60000000 /* 60s */);
+    auto& wal = getClientContext(*conn)->getStorageManager()->getWAL();
+    auto readConn = std::make_unique<kuzu::main::Connection>(database.get());
+    ASSERT_TRUE(readConn->query("BEGIN TRANSACTION READ ONLY")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL checkpoint_threshold=1")->isSuccess());
+    // The commit does not wait for the read transaction to leave.
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 100})")->isSuccess());
+    ASSERT_GT(wal.getFileSize(), 0);
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 101})")->isSuccess());
+    PrivateApiTest::assertMatchPersonCountStar(readConn.get());
+    ASSERT_TRUE(readConn->query("COMMIT")->isSuccess());
+    waitUntilWALIsEmpty(wal);
+    ASSERT_EQ(wal.getFileSize(), 0);
+    auto result = conn->query("MATCH (a:person) RETURN COUNT(*)");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 10);
+}
+
+// Auto checkpoints still run if there is never a moment without an active transaction.
+TEST_F(PrivateApiTest, AutoCheckpointUnderSteadyLoad) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    setCheckpointWaitTimeout(200000 /* 200ms */);
+    auto& wal = getClientContext(*conn)->getStorageManager()->getWAL();
+    std::atomic<bool> stopReading{false};
+    std::vector<std::thread> readers;
+    for (auto i = 0u; i < 2; i++) {
+        readers.emplace_back([&, i]() {
+            kuzu::main::Connection readConn(database.get());
+            std::this_thread::sleep_for(std::chrono::milliseconds(5 * i));
+            while (!stopReading) {
+                readConn.query("BEGIN TRANSACTION READ ONLY");
+                readConn.query("MATCH (a:person) RETURN COUNT(*)");
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                readConn.query("COMMIT");
+            }
+        });
+    }
+    ASSERT_TRUE(conn->query("CALL checkpoint_threshold=1")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 100})")->isSuccess());
+    waitUntilWALIsEmpty(wal);
+    stopReading = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    ASSERT_EQ(wal.getFileSize(), 0);
+}
+
+// A background checkpoint that fails is reported by the next commit crossing the threshold, which
+// checkpoints synchronously.
+TEST_F(PrivateApiTest, FailedAutoCheckpointIsReported) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    setCheckpointWaitTimeout(100000 /* 100ms */);
+    auto& wal = getClientContext(*conn)->getStorageManager()->getWAL();
+    auto readConn = std::make_unique<kuzu::main::Connection>(database.get());
+    ASSERT_TRUE(readConn->query("BEGIN TRANSACTION READ ONLY")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL checkpoint_threshold=1")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 100})")->isSuccess());
+    // Give the background checkpoint time to run into the timeout.
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    ASSERT_TRUE(conn->query("BEGIN TRANSACTION")->isSuccess());
+    auto result = conn->query("COMMIT");
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_NE(result->getErrorMessage().find("The last automatic checkpoint failed as well"),
+        std::string::npos);
+    ASSERT_TRUE(readConn->query("COMMIT")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 102})")->isSuccess());
+    waitUntilWALIsEmpty(wal);
+    ASSERT_EQ(wal.getFileSize(), 0);
+}
+
+// A checkpoint threshold of 0 checkpoints before the commit returns.
+TEST_F(PrivateApiTest, AutoCheckpointWithZeroThreshold) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    auto& wal = getClientContext(*conn)->getStorageManager()->getWAL();
+    ASSERT_TRUE(conn->query("CALL checkpoint_threshold=0")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 100})")->isSuccess());
+    ASSERT_EQ(wal.getFileSize(), 0);
+}
@@ -1,8 +1,12 @@
+#include "catalog/catalog.h"
 #include "graph_test/graph_test.h"
+#include "optimizer/logical_operator_collector.h"
 #include "planner/operator/extend/logical_recursive_extend.h"
 #include "planner/operator/logical_filter.h"
 #include "planner/operator/logical_plan_util.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
+#include "storage/storage_manager.h"
+#include "storage/store/table.h"
 #include "test_runner/test_runner.h"
 
 namespace kuzu {
@@ -115,5 +119,131 @@ TEST_F(OptimizerTest, RecursiveJoinTest) {
     ASSERT_STREQ(getEncodedPlan(q2).c_str(), "RE_NO_TRACK(b)S(a)");
 }
 
+TEST_F(OptimizerTest, BidirectionalRecursiveJoinTest) {
+    auto getBwdRecursiveChild = [&](const std::string& query) {
+        auto plan = getRoot(query);
+        auto collector = optimizer::LogicalRecursiveExtendCollector();
+        collector.collect(plan->getLastOperator().get());
+        EXPECT_EQ(collector.getOperators().size(), 1u);
+        return collector.getOperators()[0]
+            ->constPtrCast<planner::LogicalRecursiveExtend>()
+            ->getBwdRecursiveChild();
+    };
+    // Only shortest paths that are not tracked can be searched from both ends.
+    auto q1 = "MATCH (a:person)-[e:knows* SHORTEST 1..5]->(b:person) "
+              "WHERE a.ID = 0 AND b.ID = 7 "
+              "RETURN length(e);";
+    ASSERT_NE(getBwdRecursiveChild(q1), nullptr);
+    auto q2 = "MATCH (a:person)-[e:knows* ALL SHORTEST 1..5]->(b:person) "
+              "WHERE a.ID = 0 AND b.ID = 7 "
+              "RETURN count(*);";
+    ASSERT_NE(getBwdRecursiveChild(q2), nullptr);
+    auto q3 = "MATCH (a:person)-[e:knows* SHORTEST 1..5]->(b:person) "
+              "WHERE a.ID = 0 AND b.ID = 7 "
+              "RETURN e;";
+    ASSERT_EQ(getBwdRecursiveChild(q3), nullptr);
+    auto q4 = "MATCH (a:person)-[e:knows*1..5]->(b:person) "
+              "WHERE a.ID = 0 AND b.ID = 7 "
+              "RETURN count(*);";
+    ASSERT_EQ(getBwdRecursiveChild(q4), nullptr);
+    auto q5 = "MATCH (a:person)-[e:knows* SHORTEST 1..5 (r, n | WHERE n.age > 10)]->(b:person) "
+              "WHERE a.ID = 0 AND b.ID = 7 "
+              "RETURN length(e);";
+    ASSERT_EQ(getBwdRecursiveChild(q5), nullptr);
+}
+
+TEST_F(OptimizerTest, FilterCardinalityTest) {
+    // All persons are aged between 20 and 83, and there are only 2 genders.
+    auto q1 = "MATCH (a:person) WHERE a.age > 100 RETURN a.fName;";
+    ASSERT_EQ(getRoot(q1)->getCardinality(), 1);
+    auto q2 = "MATCH (a:person) WHERE a.age < 100 RETURN a.fName;";
+    ASSERT_EQ(getRoot(q2)->getCardinality(), 9);
+    auto q3 = "MATCH (a:person) WHERE a.gender = 1 RETURN a.fName;";
+    ASSERT_GT(getRoot(q3)->getCardinality(), 1);
+}
+
+class CardinalityEstimationTest : public OptimizerTest {
+public:
+    std::string getInputDir() override { return "empty"; }
+};
+
+TEST_F(CardinalityEstimationTest, DegreeHistogramTest) {
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE N(id INT64, PRIMARY KEY(id))")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE REL TABLE Uniform(FROM N TO N)")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE REL TABLE Skewed(FROM N TO N)")->isSuccess());
+    ASSERT_TRUE(conn->query("COPY N FROM (UNWIND range(0, 999) AS i RETURN i)")->isSuccess());
+    // Both rel tables have 2000 rels. Every node has 2 of Uniform, while only 10 hubs have
+    // Skewed, 200 each.
+    ASSERT_TRUE(conn->query("COPY Uniform FROM (UNWIND range(0, 999) AS i UNWIND [1, 2] AS j "
+                            "RETURN i, (i + j) % 1000)")
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("COPY Skewed FROM (UNWIND range(0, 9) AS i UNWIND range(1, 200) AS j "
+                            "RETURN i * 100, (i * 100 + j) % 1000)")
+                    ->isSuccess());
+    auto context = getClientContext(*conn);
+    auto catalog = context->getCatalog();
+    auto storageManager = context->getStorageManager();
+    ASSERT_TRUE(conn->query("BEGIN TRANSACTION READ ONLY")->isSuccess());
+    auto uniformDegrees =
+        storageManager->getTable(catalog->getTableID(context->getTx(), "Uniform"))
+            ->getDegreeHistogram(common::RelDataDirection::FWD);
+    auto skewedDegrees = storageManager->getTable(catalog->getTableID(context->getTx(), "Skewed"))
+                             ->getDegreeHistogram(common::RelDataDirection::FWD);
+    ASSERT_TRUE(conn->query("COMMIT")->isSuccess());
+    ASSERT_EQ(uniformDegrees.getNumValues(), 1000);
+    ASSERT_DOUBLE_EQ(uniformDegrees.getMean(), 2);
+    ASSERT_EQ(skewedDegrees.getNumValues(), 10);
+    ASSERT_DOUBLE_EQ(skewedDegrees.getMean(), 200);
+    // Both tables have the same average degree, but each hop over Skewed reaches hubs of degree
+    // 200, so the estimated number of paths, and the cost of the recursive extend, grows much
+    // faster.
+    auto uniformCost =
+        getRoot("MATCH (a:N)-[e:Uniform*1..3]->(b:N) HINT (a JOIN e) JOIN b RETURN COUNT(*);")
+            ->getCost();
+    auto skewedCost =
+        getRoot("MATCH (a:N)-[e:Skewed*1..3]->(b:N) HINT (a JOIN e) JOIN b RETURN COUNT(*);")
+            ->getCost();
+    ASSERT_GT(skewedCost, 50 * uniformCost);
+}
+
+TEST_F(CardinalityEstimationTest, RolledBackStatsTest) {
+    ASSERT_TRUE(
+        conn->query("CREATE NODE TABLE T(id INT64, v INT64, PRIMARY KEY(id))")->isSuccess());
+    ASSERT_TRUE(
+        conn->query("COPY T FROM (UNWIND range(0, 999) AS i RETURN i, 2 * i)")->isSuccess());
+    auto query = "MATCH (t:T) WHERE t.v > 2000 RETURN t.id;";
+    ASSERT_EQ(getRoot(query)->getCardinality(), 1);
+    ASSERT_TRUE(conn->query("BEGIN TRANSACTION")->isSuccess());
+    ASSERT_TRUE(conn->query("UNWIND range(1000, 1999) AS i CREATE (:T {id: i, v: i + 5000})")
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("ROLLBACK")->isSuccess());
+    ASSERT_EQ(getRoot(query)->getCardinality(), 1);
+    // The COPY fails on the duplicated key at its end, after appending the other rows.
+    ASSERT_FALSE(conn->query("COPY T FROM (UNWIND range(1000, 300000) AS i "
+                             "RETURN CASE WHEN i = 300000 THEN 0 ELSE i END, i + 5000)")
+                     ->isSuccess());
+    ASSERT_EQ(getRoot(query)->getCardinality(), 1);
+    ASSERT_TRUE(
+        conn->query("UNWIND range(1000, 1999) AS i CREATE (:T {id: i, v: i + 5000})")->isSuccess());
+    ASSERT_GT(getRoot(query)->getCardinality(), 100);
+}
+
+TEST_F(CardinalityEstimationTest, AddColumnStatsTest) {
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE T(id INT64, PRIMARY KEY(id))")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE REL TABLE R(FROM T TO T)")->isSuccess());
+    ASSERT_TRUE(conn->query("COPY T FROM (UNWIND range(0, 999) AS i RETURN i)")->isSuccess());
+    ASSERT_TRUE(
+        conn->query("COPY R FROM (UNWIND range(0, 999) AS i RETURN i, (i + 1) % 1000)")
+            ->isSuccess());
+    ASSERT_TRUE(conn->query("ALTER TABLE T ADD w INT64 DEFAULT 5")->isSuccess());
+    ASSERT_TRUE(conn->query("ALTER TABLE R ADD p INT64 DEFAULT 3")->isSuccess());
+    // All existing rows take the default value.
+    ASSERT_EQ(getRoot("MATCH (t:T) WHERE t.w = 5 RETURN t.id;")->getCardinality(),
+        getRoot("MATCH (t:T) RETURN t.id;")->getCardinality());
+    ASSERT_EQ(getRoot("MATCH (t:T) WHERE t.w > 5 RETURN t.id;")->getCardinality(), 1);
+    ASSERT_EQ(getRoot("MATCH (a:T)-[e:R]->(b:T) WHERE e.p <> 3 RETURN e.p;")->getCardinality(),
+        1);
+}
+
 } // namespace testing
 } // namespace kuzu
@@ -0,0 +1,103 @@
+#include "common/string_format.h"
+#include "graph_test/graph_test.h"
+#include "gtest/gtest.h"
+#include "processor/operator/recursive_extend/dense_node_map.h"
+#include "storage/buffer_manager/buffer_manager.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace testing {
+
+class DenseNodeMapTest : public DBTest {
+public:
+    std::string getInputDir() override { return "empty"; }
+
+    DenseNodeMapInfo getInfo(offset_t numNodes) {
+        DenseNodeMapInfo info;
+        info.memoryManager = getClientContext(*conn)->getMemoryManager();
+        info.numNodesPerTable.insert({TABLE_ID, numNodes});
+        return info;
+    }
+
+protected:
+    static constexpr table_id_t TABLE_ID = 0;
+    static constexpr table_id_t OTHER_TABLE_ID = 1;
+};
+
+TEST_F(DenseNodeMapTest, AllocateArrayOnceDense) {
+    constexpr offset_t numNodes = 1 << 20;
+    auto bm = getBufferManager(*database);
+    DenseNodeMap<uint64_t> map{getInfo(numNodes)};
+    const auto usedMemory = bm->getUsedMemory();
+    // Values of a small frontier, which is reset after each source, stay in the hash map.
+    for (auto source = 0u; source < 100; source++) {
+        for (offset_t offset = 0; offset < 1000; offset++) {
+            map.getOrInsert(nodeID_t{offset * 7, TABLE_ID}) = offset + 1;
+        }
+        ASSERT_EQ(map.get(nodeID_t{7 * 999, TABLE_ID}), 1000u);
+        for (offset_t offset = 0; offset < 1000; offset++) {
+            map.erase(nodeID_t{offset * 7, TABLE_ID});
+        }
+    }
+    ASSERT_EQ(bm->getUsedMemory(), usedMemory);
+    // Nodes of tables of unknown size are always kept in the hash map.
+    map.getOrInsert(nodeID_t{5, OTHER_TABLE_ID}) = 42;
+    // Once the frontier holds a large part of the table, its values are moved into an array.
+    for (offset_t offset = 0; offset < numNodes; offset += 2) {
+        map.getOrInsert(nodeID_t{offset, TABLE_ID}) = offset + 1;
+    }
+    ASSERT_GE(bm->getUsedMemory(), usedMemory + numNodes * sizeof(uint64_t));
+    for (offset_t offset = 0; offset < numNodes; offset++) {
+        ASSERT_EQ(map.get(nodeID_t{offset, TABLE_ID}), offset % 2 == 0 ? offset + 1 : 0);
+    }
+    map.erase(nodeID_t{0, TABLE_ID});
+    ASSERT_EQ(map.get(nodeID_t{0, TABLE_ID}), 0);
+    ASSERT_EQ(map.get(nodeID_t{5, OTHER_TABLE_ID}), 42);
+}
+
+TEST_F(DenseNodeMapTest, KeepSmallTablesInHashMap) {
+    auto bm = getBufferManager(*database);
+    DenseNodeMap<uint8_t> map{getInfo(1000)};
+    const auto usedMemory = bm->getUsedMemory();
+    for (offset_t offset = 0; offset < 1000; offset++) {
+        map.getOrInsert(nodeID_t{offset, TABLE_ID}) = 1;
+    }
+    // An array would take up a whole 256KB page of the memory manager.
+    ASSERT_EQ(bm->getUsedMemory(), usedMemory);
+    ASSERT_EQ(map.get(nodeID_t{999, TABLE_ID}), 1);
+}
+
+// Shortest paths in a complete binary tree that is large enough for the BFS states to move into
+// arrays.
+TEST_F(DenseNodeMapTest, ShortestPaths) {
+    constexpr uint64_t depth = 15;
+    constexpr uint64_t numNodes = (1 << (depth + 1)) - 1;
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE N(id INT64, PRIMARY KEY(id))")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE REL TABLE E(FROM N TO N)")->isSuccess());
+    auto result = conn->query(
+        stringFormat("COPY N FROM (UNWIND range(0, {}) AS i RETURN i)", numNodes - 1));
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    result = conn->query(stringFormat(
+        "COPY E FROM (UNWIND range(1, {}) AS i RETURN (i - 1) / 2, i)", numNodes - 1));
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    // Sum of the depths of all nodes but the root.
+    constexpr uint64_t sumOfDepths = (depth - 1) * (1 << (depth + 1)) + 2;
+    result = conn->query("MATCH (a:N)-[e:E* SHORTEST 1..30]->(b:N) WHERE a.id = 0 RETURN count(*), "
+                         "sum(length(e))");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    auto tuple = result->getNext();
+    ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), numNodes - 1);
+    ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), sumOfDepths);
+    // The states are reused across sources. The subtrees of nodes 1 and 2 hold half of the other
+    // nodes each.
+    result = conn->query(
+        "MATCH (a:N)-[e:E* ALL SHORTEST 1..30]->(b:N) WHERE a.id < 3 RETURN count(*)");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(),
+        numNodes - 1 + 2 * ((numNodes - 1) / 2 - 1));
+}
+
+} // namespace testing
+} // namespace kuzu
@@ -0,0 +1,141 @@
+#include "graph_test/graph_test.h"
+#include "gtest/gtest.h"
+#include "processor/operator/hash_join/join_hash_table.h"
+#include "processor/operator/hash_join/runtime_join_filter.h"
+
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+namespace kuzu {
+namespace testing {
+
+class RuntimeJoinFilterTest : public DBTest {
+public:
+    std::string getInputDir() override { return "empty"; }
+
+    void SetUp() override {
+        DBTest::SetUp();
+        memoryManager = getClientContext(*conn)->getMemoryManager();
+        // The build side holds the even keys in [0, 2 * NUM_BUILD_KEYS).
+        auto tableSchema = FactorizedTableSchema();
+        tableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, 0 /* dataChunkPos */,
+            LogicalTypeUtils::getRowLayoutSize(LogicalType::INT64())));
+        tableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, INVALID_DATA_CHUNK_POS,
+            LogicalTypeUtils::getRowLayoutSize(LogicalType::HASH())));
+        tableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, INVALID_DATA_CHUNK_POS,
+            LogicalTypeUtils::getRowLayoutSize(LogicalType::INT64())));
+        std::vector<LogicalType> keyTypes;
+        keyTypes.push_back(LogicalType::INT64());
+        hashTable = std::make_unique<JoinHashTable>(*memoryManager, std::move(keyTypes),
+            std::move(tableSchema));
+        auto buildChunk = std::make_shared<DataChunk>(1);
+        auto buildKeyVector = std::make_shared<ValueVector>(LogicalType::INT64(), memoryManager);
+        buildChunk->insert(0, buildKeyVector);
+        for (auto start = 0u; start < NUM_BUILD_KEYS; start += DEFAULT_VECTOR_CAPACITY) {
+            const auto numKeys =
+                std::min<uint64_t>(DEFAULT_VECTOR_CAPACITY, NUM_BUILD_KEYS - start);
+            for (auto i = 0u; i < numKeys; i++) {
+                buildKeyVector->setValue<int64_t>(i, 2 * (start + i));
+            }
+            buildChunk->state->initOriginalAndSelectedSize(numKeys);
+            hashTable->appendVectors({buildKeyVector.get()}, {} /* payloadVectors */,
+                buildChunk->state.get());
+        }
+        filter = std::make_shared<RuntimeJoinFilter>(LogicalType::INT64());
+        filter->build(*hashTable);
+        probeChunk = std::make_shared<DataChunk>(1);
+        probeKeyVector = std::make_shared<ValueVector>(LogicalType::INT64(), memoryManager);
+        probeChunk->insert(0, probeKeyVector);
+        probeResultSet = std::make_unique<ResultSet>(1);
+        probeResultSet->insert(0, probeChunk);
+    }
+
+    // The hash table and vectors hold memory buffers of the database, so they must go before it.
+    void TearDown() override {
+        probeResultSet.reset();
+        probeKeyVector.reset();
+        probeChunk.reset();
+        filter.reset();
+        hashTable.reset();
+        DBTest::TearDown();
+    }
+
+    // Applies the filter to a vector of the keys start, start + step, ... and returns the number
+    // of keys that pass it. Even keys below 2 * NUM_BUILD_KEYS must always pass.
+    sel_t probe(RuntimeJoinFilterApplier& applier, int64_t start, int64_t step) {
+        for (auto i = 0u; i < DEFAULT_VECTOR_CAPACITY; i++) {
+            probeKeyVector->setValue<int64_t>(i, start + i * step);
+        }
+        // The filter leaves the selection filtered, so reset it for every probe.
+        probeChunk->state->getSelVectorUnsafe().setToUnfiltered(DEFAULT_VECTOR_CAPACITY);
+        const auto numSelected = applier.apply();
+        auto& selVector = probeChunk->state->getSelVector();
+        EXPECT_EQ(selVector.getSelSize(), numSelected);
+        uint64_t numMatches = 0;
+        for (auto i = 0u; i < numSelected; i++) {
+            const auto key = probeKeyVector->getValue<int64_t>(selVector[i]);
+            if (key % 2 == 0 && key < 2 * (int64_t)NUM_BUILD_KEYS) {
+                numMatches++;
+            }
+        }
+        uint64_t numExpectedMatches = 0;
+        for (auto i = 0u; i < DEFAULT_VECTOR_CAPACITY; i++) {
+            const auto key = start + i * step;
+            if (key % 2 == 0 && key < 2 * (int64_t)NUM_BUILD_KEYS) {
+                numExpectedMatches++;
+            }
+        }
+        EXPECT_EQ(numMatches, numExpectedMatches);
+        return numSelected;
+    }
+
+protected:
+    static constexpr uint64_t NUM_BUILD_KEYS = 20000;
+    storage::MemoryManager* memoryManager = nullptr;
+    std::unique_ptr<JoinHashTable> hashTable;
+    std::shared_ptr<RuntimeJoinFilter> filter;
+    std::shared_ptr<DataChunk> probeChunk;
+    std::shared_ptr<ValueVector> probeKeyVector;
+    std::unique_ptr<ResultSet> probeResultSet;
+};
+
+// Half of the probed keys have a match. The filter drops most of the others and stays enabled.
+TEST_F(RuntimeJoinFilterTest, PartiallySelective) {
+    RuntimeJoinFilterApplier applier{DataPos{0, 0}, filter};
+    applier.init(*probeResultSet, memoryManager);
+    uint64_t numSelected = 0;
+    uint64_t numProbed = 0;
+    for (auto start = 0u; start < 2 * NUM_BUILD_KEYS; start += DEFAULT_VECTOR_CAPACITY) {
+        numSelected += probe(applier, start, 1 /* step */);
+        numProbed += DEFAULT_VECTOR_CAPACITY;
+    }
+    ASSERT_LT((double)numSelected, 0.6 * (double)numProbed);
+    ASSERT_TRUE(applier.isEnabled());
+    // Keys above the max key are out of range.
+    ASSERT_EQ(probe(applier, 2 * NUM_BUILD_KEYS, 2 /* step */), 0);
+    ASSERT_TRUE(applier.isEnabled());
+}
+
+// All probed keys have a match, so the filter is turned off once enough keys are sampled.
+TEST_F(RuntimeJoinFilterTest, DisableNonSelective) {
+    RuntimeJoinFilterApplier applier{DataPos{0, 0}, filter};
+    applier.init(*probeResultSet, memoryManager);
+    auto start = 0u;
+    while (applier.isEnabled()) {
+        ASSERT_LT(start, 2 * NUM_BUILD_KEYS);
+        ASSERT_EQ(probe(applier, start, 2 /* step */), DEFAULT_VECTOR_CAPACITY);
+        start += 2 * DEFAULT_VECTOR_CAPACITY;
+    }
+    // At least 4 vectors are sampled before the filter is turned off.
+    ASSERT_GE(start, 4 * 2 * DEFAULT_VECTOR_CAPACITY);
+    // Once turned off, keys without a match pass as well.
+    ASSERT_EQ(probe(applier, 1, 2 /* step */), DEFAULT_VECTOR_CAPACITY);
+    // Other clones of the scan sample the filter on their own.
+    auto otherApplier = applier.copy();
+    otherApplier.init(*probeResultSet, memoryManager);
+    ASSERT_TRUE(otherApplier.isEnabled());
+    ASSERT_LT(probe(otherApplier, 1, 2 /* step */), DEFAULT_VECTOR_CAPACITY / 4);
+}
+
+} // namespace testing
+} // namespace kuzu
@@ -1,8 +1,12 @@
+#include <algorithm>
+
+#include "common/string_format.h"
 #include "graph_test/graph_test.h"
 #include "gtest/gtest.h"
 #include "spdlog/common.h"
 #include "spdlog/spdlog.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/storage_manager.h"
 
 using namespace kuzu::common;
 using namespace kuzu::storage;
@@ -32,5 +36,134 @@ TEST_F(BufferManagerTest, TestBMUsageForIdenticalQueries) {
     spdlog::info("Memory used after transactions: {}", memoryUsed);
 }
 
+class TwoQueueBufferManagerTest : public DBTest {
+public:
+    std::string getInputDir() override { return "empty"; }
+
+    void SetUp() override {
+        BaseGraphTest::SetUp();
+        systemConfig->evictionPolicy = EvictionPolicy::TWO_QUEUE;
+        createDBAndConn();
+        initGraph();
+    }
+
+    std::vector<page_idx_t> getDataPagesInState(uint64_t state) const {
+        auto dataFH = getClientContext(*conn)->getStorageManager()->getDataFH();
+        std::vector<page_idx_t> pageIdxes;
+        for (auto pageIdx = 0u; pageIdx < dataFH->getNumPages(); pageIdx++) {
+            if (dataFH->getPageState(pageIdx)->getState() == state) {
+                pageIdxes.push_back(pageIdx);
+            }
+        }
+        return pageIdxes;
+    }
+};
+
+// Full scans of a table that doesn't fit in the buffer pool must not evict the pages of a small
+// table that is read over and over again.
+TEST_F(TwoQueueBufferManagerTest, TestScansAndLookups) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    constexpr uint64_t numBigRows = 1000000;
+    ASSERT_TRUE(
+        conn->query("CREATE NODE TABLE Hot(id INT64, v INT64, PRIMARY KEY(id))")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE Big(id INT64, v1 INT64, v2 INT64, v3 INT64, "
+                            "v4 INT64, PRIMARY KEY(id))")
+                    ->isSuccess());
+    auto result = conn->query("COPY Hot FROM (UNWIND range(0, 9999) AS i RETURN i, 2 * i)");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    // The values span the whole INT64 range, so that they can't be compressed.
+    result = conn->query(stringFormat("COPY Big FROM (UNWIND range(0, {}) AS i WITH i, "
+                                      "(i * 2654435761) % 4294967291 * 2147483647 AS v "
+                                      "RETURN i, v, v - 1, v - 2, v - 3)",
+        numBigRows - 1));
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    // Reopen the database with a buffer pool that is smaller than the big table.
+    constexpr uint64_t bufferPoolSize = 32ull << 20; // (32MB)
+    ASSERT_GT(numBigRows * 5 * sizeof(int64_t), bufferPoolSize);
+    systemConfig->bufferPoolSize = bufferPoolSize;
+    // Results hold memory buffers of the database, so they must go before it.
+    result.reset();
+    conn.reset();
+    createDBAndConn();
+    auto bm = getBufferManager(*database);
+    ASSERT_EQ(bm->getEvictionPolicy(), EvictionPolicy::TWO_QUEUE);
+    auto queryHotTable = [&]() {
+        auto hotResult = conn->query("MATCH (h:Hot) RETURN sum(h.v)");
+        ASSERT_TRUE(hotResult->isSuccess()) << hotResult->toString();
+        ASSERT_EQ(hotResult->getNext()->getValue(0)->getValue<int64_t>(), 9999 * 10000);
+        hotResult = conn->query("MATCH (h:Hot) WHERE h.id = 4242 RETURN h.v");
+        ASSERT_TRUE(hotResult->isSuccess()) << hotResult->toString();
+        ASSERT_EQ(hotResult->getNext()->getValue(0)->getValue<int64_t>(), 8484);
+    };
+    // The pages of the small table are read more than once, so they are referenced.
+    for (auto i = 0u; i < 2; i++) {
+        queryHotTable();
+    }
+    const auto hotPages = getDataPagesInState(PageState::UNLOCKED);
+    ASSERT_FALSE(hotPages.empty());
+    for (auto i = 0u; i < 3; i++) {
+        result = conn->query("MATCH (b:Big) RETURN count(*), min(b.v1), min(b.v2), min(b.v3), "
+                             "min(b.v4)");
+        ASSERT_TRUE(result->isSuccess()) << result->toString();
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), numBigRows);
+    }
+    ASSERT_LE(bm->getUsedMemory(), bufferPoolSize);
+    const auto evictedPages = getDataPagesInState(PageState::EVICTED);
+    ASSERT_FALSE(evictedPages.empty());
+    for (const auto pageIdx : hotPages) {
+        ASSERT_FALSE(std::binary_search(evictedPages.begin(), evictedPages.end(), pageIdx))
+            << "Page " << pageIdx << " of the small table was evicted by the scans.";
+    }
+    queryHotTable();
+}
+
+class PrefetchTest : public DBTest {
+public:
+    std::string getInputDir() override { return "empty"; }
+};
+
+// Only scans that read whole column chunks read their pages ahead.
+TEST_F(PrefetchTest, TestScansAndLookups) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    constexpr uint64_t numRows = 300000;
+    ASSERT_TRUE(
+        conn->query("CREATE NODE TABLE T(id INT64, v INT64, PRIMARY KEY(id))")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE REL TABLE R(FROM T TO T)")->isSuccess());
+    // The values span the whole INT64 range, so that they can't be compressed.
+    auto result = conn->query(stringFormat("COPY T FROM (UNWIND range(0, {}) AS i "
+                                           "RETURN i, (i * 2654435761) % 4294967291 * 2147483647)",
+        numRows - 1));
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    result = conn->query(stringFormat(
+        "COPY R FROM (UNWIND range(0, {}) AS i RETURN i, (i + 1) % {})", numRows - 1, numRows));
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    // Reopen the database, so that no page is cached.
+    result.reset();
+    conn.reset();
+    createDBAndConn();
+    auto bm = getBufferManager(*database);
+    auto numPrefetchedPages = bm->getNumPrefetchedPages();
+    result = conn->query("MATCH (t:T) WHERE t.id = 4242 RETURN t.v");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(),
+        4242 * 2654435761 % 4294967291 * 2147483647);
+    result = conn->query("MATCH (a:T)-[:R]->(b:T) WHERE a.id = 4242 RETURN count(*)");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1);
+    // Lookups read single pages of the column chunks, the CSR header and the index.
+    ASSERT_LT(bm->getNumPrefetchedPages() - numPrefetchedPages, 16u);
+    numPrefetchedPages = bm->getNumPrefetchedPages();
+    result = conn->query("MATCH (t:T) RETURN count(*), min(t.v)");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), numRows);
+    // The chunks of the v column take up 8 bytes per value.
+    ASSERT_GT(bm->getNumPrefetchedPages() - numPrefetchedPages,
+        numRows * sizeof(int64_t) / BufferPoolConstants::PAGE_4KB_SIZE / 2);
+}
+
 } // namespace testing
 } // namespace kuzu
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cmath>
 #include <numeric>
 
 #include "gmock/gmock-matchers.h"
@@ -447,3 +448,242 @@ TEST(CompressionTests, OffsetIntegerPackingMultiPageSigned64) {
 
     integerPackingMultiPage(src);
 }
+
+template<typename T, typename Alg>
+void encodedIntegerMultiPage(const std::vector<T>& src, const CompressionMetadata& metadata) {
+    auto alg = Alg();
+    auto pageSize = 4096;
+    auto numValuesPerPage = metadata.numValues(pageSize, LogicalType(LogicalTypeID::INT64));
+    int64_t numValuesRemaining = src.size();
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    auto pages = src.size() / numValuesPerPage + 1;
+    std::vector<std::vector<uint8_t>> dest(pages, std::vector<uint8_t>(pageSize));
+    size_t pageNum = 0;
+    while (numValuesRemaining > 0) {
+        ASSERT_LT(pageNum, pages);
+        auto compressedSize = alg.compressNextPage(srcCursor, numValuesRemaining,
+            dest[pageNum++].data(), pageSize, metadata);
+        ASSERT_LE(compressedSize, pageSize);
+        numValuesRemaining -= numValuesPerPage;
+    }
+    ASSERT_EQ(srcCursor, (uint8_t*)(src.data() + src.size()));
+    for (auto i = 0u; i < src.size(); i++) {
+        auto page = i / numValuesPerPage;
+        auto indexInPage = i % numValuesPerPage;
+        T value;
+        alg.decompressFromPage(dest[page].data(), indexInPage, (uint8_t*)&value, 0, 1 /*numValues*/,
+            metadata);
+        EXPECT_EQ(src[i], value);
+    }
+    std::vector<T> decompressed(src.size());
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        auto page = i / numValuesPerPage;
+        alg.decompressFromPage(dest[page].data(), 0, (uint8_t*)decompressed.data(), i,
+            std::min(numValuesPerPage, (uint64_t)src.size() - i), metadata);
+    }
+    ASSERT_EQ(decompressed, src);
+
+    // Decompress part of a page
+    auto numValues = std::min<uint64_t>(numValuesPerPage, src.size()) / 2;
+    auto srcOffset = numValues / 3;
+    decompressed.clear();
+    decompressed.resize(numValues);
+    alg.decompressFromPage(dest[0].data(), srcOffset, (uint8_t*)decompressed.data(), 0, numValues,
+        metadata);
+    EXPECT_EQ(decompressed,
+        std::vector(src.begin() + srcOffset, src.begin() + srcOffset + numValues));
+}
+
+template<typename T>
+void deltaBitpackingMultiPage(const std::vector<T>& src) {
+    const auto& [min, max] = std::minmax_element(src.begin(), src.end());
+    auto metadata = DeltaBitpacking<T>::analyze(src, StorageValue(*min), StorageValue(*max));
+    ASSERT_TRUE(metadata.has_value());
+    ASSERT_EQ(metadata->compression, CompressionType::DELTA_BITPACKING);
+    encodedIntegerMultiPage<T, DeltaBitpacking<T>>(src, *metadata);
+}
+
+template<typename T>
+void runLengthEncodingMultiPage(const std::vector<T>& src) {
+    const auto& [min, max] = std::minmax_element(src.begin(), src.end());
+    auto metadata =
+        RunLengthEncoding<T>::analyze(src, StorageValue(*min), StorageValue(*max), 4096);
+    ASSERT_TRUE(metadata.has_value());
+    ASSERT_EQ(metadata->compression, CompressionType::RUN_LENGTH_ENCODING);
+    encodedIntegerMultiPage<T, RunLengthEncoding<T>>(src, *metadata);
+}
+
+TEST(CompressionTests, DeltaBitpackingMultiPageSequential64) {
+    int64_t numValues = 100000;
+    std::vector<int64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = 1000000000000 + i;
+    }
+    deltaBitpackingMultiPage(src);
+    // One bit per delta uses fewer pages than bitpacking the (large) values
+    auto metadata = *DeltaBitpacking<int64_t>::analyze(src, StorageValue(src.front()),
+        StorageValue(src.back()));
+    auto bitpackingMetadata = CompressionMetadata(StorageValue(src.front()),
+        StorageValue(src.back()), CompressionType::INTEGER_BITPACKING);
+    EXPECT_EQ(metadata.param, 1);
+    EXPECT_GT(metadata.numValues(4096, LogicalType::INT64()),
+        bitpackingMetadata.numValues(4096, LogicalType::INT64()));
+}
+
+TEST(CompressionTests, DeltaBitpackingMultiPageNegative32) {
+    int64_t numValues = 10000;
+    std::vector<int32_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = -100000 + i * 7 + i % 3;
+    }
+    deltaBitpackingMultiPage(src);
+}
+
+TEST(CompressionTests, DeltaBitpackingMultiPageUnsigned16) {
+    int64_t numValues = 1000;
+    std::vector<uint16_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = i * 60;
+    }
+    deltaBitpackingMultiPage(src);
+}
+
+TEST(CompressionTests, DeltaBitpackingMultiPage8) {
+    std::vector<int8_t> src(255);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = static_cast<int8_t>(static_cast<int>(i) - 127);
+    }
+    deltaBitpackingMultiPage(src);
+}
+
+TEST(CompressionTests, DeltaBitpackingUnsortedTest) {
+    std::vector<int64_t> src{1, 2, 3, 2};
+    EXPECT_FALSE(DeltaBitpacking<int64_t>::analyze(src, StorageValue(1), StorageValue(3)));
+}
+
+TEST(CompressionTests, RunLengthEncodingMultiPage64) {
+    int64_t numValues = 100000;
+    std::vector<int64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (i / 100) % 13 - 6;
+    }
+    runLengthEncodingMultiPage(src);
+}
+
+TEST(CompressionTests, RunLengthEncodingMultiPageUnsigned8) {
+    int64_t numValues = 100000;
+    std::vector<uint8_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (i / 7) % 3;
+    }
+    runLengthEncodingMultiPage(src);
+}
+
+TEST(CompressionTests, RunLengthEncodingShortRunsTest) {
+    std::vector<int32_t> src(10000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = i % 2;
+    }
+    EXPECT_FALSE(
+        RunLengthEncoding<int32_t>::analyze(src, StorageValue(0), StorageValue(1), 4096));
+}
+
+TEST(CompressionTests, EncodedIntegerCanUpdateInPlace) {
+    std::vector<int64_t> values{5, 6};
+    for (auto compression :
+        {CompressionType::DELTA_BITPACKING, CompressionType::RUN_LENGTH_ENCODING}) {
+        auto metadata = CompressionMetadata(StorageValue(0), StorageValue(10), compression, 1);
+        EXPECT_FALSE(metadata.canAlwaysUpdateInPlace());
+        EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)values.data(), 0, values.size(),
+            PhysicalTypeID::INT64));
+        std::optional<NullMask> nullMask{std::in_place, values.size()};
+        nullMask->setNull(0, true);
+        EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)values.data(), 0, values.size(),
+            PhysicalTypeID::INT64, nullMask));
+        nullMask->setNull(1, true);
+        EXPECT_TRUE(metadata.canUpdateInPlace((uint8_t*)values.data(), 0, values.size(),
+            PhysicalTypeID::INT64, nullMask));
+    }
+}
+
+template<std::floating_point T>
+void floatCompressionMultiPage(const std::vector<T>& src) {
+    auto pageSize = 4096;
+    auto metadata = FloatCompression<T>::analyze(src, StorageValue(0), StorageValue(0), pageSize);
+    ASSERT_TRUE(metadata.has_value());
+    ASSERT_EQ(metadata->compression, CompressionType::ALP);
+    auto alg = FloatCompression<T>();
+    auto numValuesPerPage = FloatCompression<T>::numValues(pageSize, *metadata);
+    ASSERT_GT(numValuesPerPage, pageSize / sizeof(T));
+    auto pages = (src.size() + numValuesPerPage - 1) / numValuesPerPage;
+    std::vector<std::vector<uint8_t>> dest(pages, std::vector<uint8_t>(pageSize));
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    for (auto& page : dest) {
+        auto numValuesRemaining = src.size() - ((const T*)srcCursor - src.data());
+        auto compressedSize =
+            alg.compressNextPage(srcCursor, numValuesRemaining, page.data(), pageSize, *metadata);
+        ASSERT_LE(compressedSize, pageSize);
+    }
+    ASSERT_EQ(srcCursor, (uint8_t*)(src.data() + src.size()));
+    // NaNs don't compare equal, so the bit patterns are compared
+    std::vector<T> decompressed(src.size());
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        alg.decompressFromPage(dest[i / numValuesPerPage].data(), 0, (uint8_t*)decompressed.data(),
+            i, std::min<uint64_t>(numValuesPerPage, src.size() - i), *metadata);
+    }
+    EXPECT_EQ(memcmp(decompressed.data(), src.data(), src.size() * sizeof(T)), 0);
+    for (auto i = 0u; i < src.size(); i += 37) {
+        T value;
+        alg.decompressFromPage(dest[i / numValuesPerPage].data(), i % numValuesPerPage,
+            (uint8_t*)&value, 0, 1 /*numValues*/, *metadata);
+        EXPECT_EQ(memcmp(&value, &src[i], sizeof(T)), 0);
+    }
+}
+
+TEST(CompressionTests, FloatCompressionMultiPageDouble) {
+    std::vector<double> src(20000);
+    for (auto i = 0u; i < src.size(); i++) {
+        // Parsed decimals, i.e. the closest doubles to values with two decimal digits
+        src[i] = (1250 + i % 1000) / 100.0;
+    }
+    // Exceptions
+    src[3] = std::numeric_limits<double>::quiet_NaN();
+    src[100] = -0.0;
+    src[101] = std::numeric_limits<double>::infinity();
+    src[5000] = 1.0 / 3;
+    src[19999] = 1e300;
+    floatCompressionMultiPage(src);
+}
+
+TEST(CompressionTests, FloatCompressionMultiPageFloat) {
+    std::vector<float> src(10000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = static_cast<float>(i % 500) * 0.5f - 100;
+    }
+    src[1234] = std::numeric_limits<float>::quiet_NaN();
+    src[4321] = 1.0f / 3;
+    floatCompressionMultiPage(src);
+}
+
+TEST(CompressionTests, FloatCompressionRandomTest) {
+    // Values with as many digits as fit in a double can't be encoded as integers
+    std::vector<double> src(2000);
+    for (auto i = 0u; i < src.size(); i++) {
+        src[i] = std::sqrt(static_cast<double>(i) + 2);
+    }
+    EXPECT_FALSE(FloatCompression<double>::analyze(src, StorageValue(0), StorageValue(0), 4096));
+}
+
+TEST(CompressionTests, FloatCompressionCanUpdateInPlace) {
+    std::vector<double> values{5.5, 6.5};
+    auto metadata =
+        CompressionMetadata(StorageValue(0), StorageValue(10), CompressionType::ALP, 10 /*param*/);
+    EXPECT_FALSE(metadata.canAlwaysUpdateInPlace());
+    EXPECT_FALSE(metadata.canUpdateInPlace((uint8_t*)values.data(), 0, values.size(),
+        PhysicalTypeID::DOUBLE));
+    std::optional<NullMask> nullMask{std::in_place, values.size()};
+    nullMask->setNull(0, true);
+    nullMask->setNull(1, true);
+    EXPECT_TRUE(metadata.canUpdateInPlace((uint8_t*)values.data(), 0, values.size(),
+        PhysicalTypeID::DOUBLE, nullMask));
+}
@@ -0,0 +1,128 @@
+#include <set>
+
+#include "catalog/catalog.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+#include "graph_test/graph_test.h"
+#include "gtest/gtest.h"
+#include "storage/index/hash_index_slot.h"
+#include "storage/index/hash_index_utils.h"
+#include "storage/storage_manager.h"
+#include "storage/store/node_table.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::testing;
+
+class PKIndexLookupTest : public DBTest {
+public:
+    std::string getInputDir() override { return "empty"; }
+
+    // Looks up `keys` in one batch from a filtered key vector, and checks every offset against the
+    // single-key lookup.
+    std::vector<offset_t> lookupPKs(const std::string& tableName,
+        const std::vector<int64_t>& keys) const {
+        auto context = getClientContext(*conn);
+        auto transaction = context->getTx();
+        auto tableID = context->getCatalog()->getTableID(transaction, tableName);
+        auto& nodeTable = context->getStorageManager()->getTable(tableID)->cast<NodeTable>();
+        ValueVector keyVector(LogicalTypeID::INT64, context->getMemoryManager());
+        keyVector.setState(std::make_shared<DataChunkState>());
+        auto& selVector = keyVector.state->getSelVectorUnsafe();
+        selVector.setToFiltered(keys.size());
+        // Only every other position is selected, with a non-existent key in between.
+        for (auto i = 0u; i < keys.size(); i++) {
+            selVector.getMultableBuffer()[i] = 2 * i + 1;
+            keyVector.setValue<int64_t>(2 * i, -1);
+            keyVector.setValue<int64_t>(2 * i + 1, keys[i]);
+        }
+        std::vector<offset_t> offsets(keys.size());
+        nodeTable.lookupPKs(transaction, keyVector, offsets.data());
+        for (auto i = 0u; i < keys.size(); i++) {
+            offset_t offset = INVALID_OFFSET;
+            nodeTable.lookupPK(transaction, &keyVector, selVector[i], offset);
+            EXPECT_EQ(offsets[i], offset) << "key " << keys[i];
+        }
+        return offsets;
+    }
+};
+
+// Keys that fall into the same hash index and share the low 12 bits of their hash, so they all
+// land in the same primary slot of small indexes and spill into a chain of overflow slots.
+static std::vector<int64_t> getCollidingKeys(uint64_t numKeys) {
+    constexpr hash_t mask = 0xFF00000000000FFF;
+    const auto targetHash = HashIndexUtils::hash(int64_t{0}) & mask;
+    std::vector<int64_t> keys;
+    for (int64_t key = 0; keys.size() < numKeys; key++) {
+        if ((HashIndexUtils::hash(key) & mask) == targetHash) {
+            keys.push_back(key);
+        }
+    }
+    return keys;
+}
+
+TEST_F(PKIndexLookupTest, LookupLocalInsertionsInWriteTransaction) {
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE T(id INT64, PRIMARY KEY(id))")->isSuccess());
+    ASSERT_TRUE(conn->query("COPY T FROM (UNWIND range(0, 999) AS i RETURN i)")->isSuccess());
+    ASSERT_TRUE(conn->query("BEGIN TRANSACTION")->isSuccess());
+    ASSERT_TRUE(conn->query("UNWIND range(1000, 1009) AS i CREATE (:T {id: i})")->isSuccess());
+    ASSERT_TRUE(conn->query("MATCH (t:T) WHERE t.id = 5 OR t.id = 7 DELETE t")->isSuccess());
+    // Key 7 is deleted from the persistent index and inserted again into the local one.
+    ASSERT_TRUE(conn->query("CREATE (:T {id: 7})")->isSuccess());
+    const std::vector<int64_t> keys{3, 1002, 999, 5, 5000, 1009, 7, 0, 1000};
+    auto offsets = lookupPKs("T", keys);
+    std::set<offset_t> foundOffsets;
+    for (auto i = 0u; i < keys.size(); i++) {
+        if (keys[i] == 5 || keys[i] == 5000) {
+            EXPECT_EQ(offsets[i], INVALID_OFFSET) << "key " << keys[i];
+        } else {
+            EXPECT_NE(offsets[i], INVALID_OFFSET) << "key " << keys[i];
+            foundOffsets.insert(offsets[i]);
+        }
+    }
+    EXPECT_EQ(foundOffsets.size(), 7);
+    ASSERT_TRUE(conn->query("ROLLBACK")->isSuccess());
+}
+
+TEST_F(PKIndexLookupTest, LookupInOverflowSlotChains) {
+    const auto numKeys = 4 * getSlotCapacity<int64_t>() + 1;
+    // The last colliding key is never inserted, so its lookups walk the whole chain.
+    auto keys = getCollidingKeys(numKeys + 1);
+    const auto missingKey = keys.back();
+    keys.pop_back();
+    std::vector<std::string> keyStrs, edgeStrs;
+    for (auto i = 0u; i < keys.size(); i++) {
+        keyStrs.push_back(std::to_string(keys[i]));
+        edgeStrs.push_back(stringFormat("[{}, {}]", keys[i], keys[(i + 1) % keys.size()]));
+    }
+    ASSERT_TRUE(conn->query("CREATE NODE TABLE T(id INT64, PRIMARY KEY(id))")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE REL TABLE R(FROM T TO T)")->isSuccess());
+    ASSERT_TRUE(conn->query(stringFormat("COPY T FROM (UNWIND [{}] AS i RETURN i)",
+                                StringUtils::join(keyStrs, ", ")))
+                    ->isSuccess());
+    // Rel COPY looks up the keys of each vector of edges in one batch.
+    auto result = conn->query(stringFormat("COPY R FROM (UNWIND [{}] AS e RETURN e[1], e[2])",
+        StringUtils::join(edgeStrs, ", ")));
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    result = conn->query("MATCH (a:T)-[:R]->(b:T) RETURN a.id, b.id");
+    std::set<std::pair<int64_t, int64_t>> edges;
+    while (result->hasNext()) {
+        auto tuple = result->getNext();
+        edges.emplace(tuple->getValue(0)->getValue<int64_t>(),
+            tuple->getValue(1)->getValue<int64_t>());
+    }
+    ASSERT_EQ(edges.size(), keys.size());
+    for (auto i = 0u; i < keys.size(); i++) {
+        EXPECT_TRUE(edges.contains({keys[i], keys[(i + 1) % keys.size()]}));
+    }
+
+    ASSERT_TRUE(conn->query("BEGIN TRANSACTION READ ONLY")->isSuccess());
+    auto lookupKeys = keys;
+    lookupKeys.push_back(missingKey);
+    auto offsets = lookupPKs("T", lookupKeys);
+    EXPECT_EQ(offsets.back(), INVALID_OFFSET);
+    offsets.pop_back();
+    EXPECT_EQ(std::set<offset_t>(offsets.begin(), offsets.end()).size(), keys.size());
+    EXPECT_FALSE(std::set<offset_t>(offsets.begin(), offsets.end()).contains(INVALID_OFFSET));
+    ASSERT_TRUE(conn->query("COMMIT")->isSuccess());
+}
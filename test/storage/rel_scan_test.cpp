@@ -2,11 +2,13 @@
 
 #include "catalog/catalog.h"
 #include "graph/graph_entry.h"
+#include "graph/in_mem_graph.h"
 #include "graph/on_disk_graph.h"
 #include "graph_test/base_graph_test.h"
 // #include "gtest/gtest.h"
 #include "main/client_context.h"
 #include "main_test_helper/private_main_test_helper.h"
+#include "storage/buffer_manager/buffer_manager.h"
 // #include "transaction/transaction.h"
 
 using kuzu::common::nodeID_t;
@@ -39,6 +41,64 @@ class RelScanTestAmazon : public RelScanTest {
     }
 };
 
+// (nbr table, nbr offset, edge property is null, edge property) of all edges of a node.
+using edge_list_t = std::vector<std::tuple<common::table_id_t, common::offset_t, bool, int64_t>>;
+
+static edge_list_t scanEdges(graph::Graph& graph, graph::GraphScanState& scanState, nodeID_t nodeID,
+    bool isFwd) {
+    edge_list_t edges;
+    auto collect = [&](const graph::NbrChunk& chunk) {
+        chunk.forEach([&](nodeID_t nbrNodeID, common::sel_t idx) {
+            const auto isNull = chunk.isEdgePropertyNull(idx);
+            edges.emplace_back(nbrNodeID.tableID, nbrNodeID.offset, isNull,
+                isNull ? 0 : chunk.getEdgeProperty<int64_t>(idx));
+        });
+    };
+    if (isFwd) {
+        graph.scanFwd(nodeID, scanState, collect);
+    } else {
+        graph.scanBwd(nodeID, scanState, collect);
+    }
+    std::sort(edges.begin(), edges.end());
+    return edges;
+}
+
+TEST_F(RelScanTest, InMemGraphMatchesOnDiskGraph) {
+    context->getClientConfigUnsafe()->numThreads = 4;
+    auto bm = context->getMemoryManager()->getBufferManager();
+    const auto usedMemoryBeforeProjection = bm->getUsedMemory();
+    // Only meets has the property, so the edges of the other rel tables have null values.
+    const std::string edgePropertyName = "times";
+    auto inMemGraph = graph::InMemGraph::project(context, *graph, edgePropertyName,
+        true /* projectBwd */);
+    // Each CSR takes at least one page from the memory manager.
+    ASSERT_GE(bm->getUsedMemory(), usedMemoryBeforeProjection +
+                                       graph->getRelTableIDInfos().size() *
+                                           common::BufferPoolConstants::PAGE_256KB_SIZE);
+    auto nodeTableIDs = graph->getNodeTableIDs();
+    auto onDiskFwdState = graph->prepareMultiTableScanFwd(nodeTableIDs, edgePropertyName);
+    auto onDiskBwdState = graph->prepareMultiTableScanBwd(nodeTableIDs, edgePropertyName);
+    auto inMemFwdState = inMemGraph->prepareMultiTableScanFwd(nodeTableIDs, edgePropertyName);
+    auto inMemBwdState = inMemGraph->prepareMultiTableScanBwd(nodeTableIDs, edgePropertyName);
+    uint64_t numEdges = 0, numEdgesWithProperty = 0;
+    for (auto tableID : nodeTableIDs) {
+        ASSERT_EQ(inMemGraph->getNumNodes(tableID), graph->getNumNodes(tableID));
+        for (auto offset = 0u; offset < graph->getNumNodes(tableID); offset++) {
+            const auto nodeID = nodeID_t{offset, tableID};
+            auto fwdEdges = scanEdges(*graph, *onDiskFwdState, nodeID, true /* isFwd */);
+            ASSERT_EQ(scanEdges(*inMemGraph, *inMemFwdState, nodeID, true /* isFwd */), fwdEdges);
+            ASSERT_EQ(scanEdges(*inMemGraph, *inMemBwdState, nodeID, false /* isFwd */),
+                scanEdges(*graph, *onDiskBwdState, nodeID, false /* isFwd */));
+            numEdges += fwdEdges.size();
+            for (auto& edge : fwdEdges) {
+                numEdgesWithProperty += !std::get<2>(edge);
+            }
+        }
+    }
+    ASSERT_GT(numEdges, numEdgesWithProperty);
+    ASSERT_GT(numEdgesWithProperty, 0);
+}
+
 // Test correctness of a random access scan
 // TEST_F(RelScanTest, RandomAccessScan) {
 //     auto tableID = catalog->getTableID(context->getTx(), "person");
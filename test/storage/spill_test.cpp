@@ -0,0 +1,72 @@
+#include <filesystem>
+
+#include "common/string_format.h"
+#include "graph_test/graph_test.h"
+#include "gtest/gtest.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace testing {
+
+// Runs queries whose hash tables don't fit in a small buffer pool, so that they have to spill.
+class SpillTest : public DBTest {
+public:
+    std::string getInputDir() override { return "empty"; }
+
+    void SetUp() override {
+        BaseGraphTest::SetUp();
+        systemConfig->bufferPoolSize = 32ull << 20; // (32MB)
+        createDBAndConn();
+        initGraph();
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE T(id INT64, s STRING, PRIMARY KEY(id))")
+                        ->isSuccess());
+        auto result = conn->query(stringFormat("COPY T FROM (UNWIND range(0, {}) AS i RETURN i, "
+                                               "concat(cast(i + 1000000 AS STRING), '{}'))",
+            NUM_TUPLES - 1, PADDING));
+        ASSERT_TRUE(result->isSuccess()) << result->toString();
+    }
+
+    uint64_t getSpillFileSize() const {
+        auto spillFilePath =
+            std::filesystem::path(databasePath) / StorageConstants::SPILL_FILE_NAME;
+        return std::filesystem::exists(spillFilePath) ? std::filesystem::file_size(spillFilePath) :
+                                                        0;
+    }
+
+protected:
+    static constexpr uint64_t NUM_TUPLES = 300000;
+    static constexpr char PADDING[] = "-padded-so-that-it-is-not-inlined";
+};
+
+TEST_F(SpillTest, HashJoin) {
+    const auto query = stringFormat(
+        "MATCH (a:T), (b:T) WHERE a.id = b.id RETURN count(*), sum(b.id), "
+        "sum(CASE WHEN b.s = concat(cast(a.id + 1000000 AS STRING), '{}') THEN 1 ELSE 0 END)",
+        PADDING);
+    ASSERT_TRUE(conn->query("CALL enable_spilling=true")->isSuccess());
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    auto tuple = result->getNext();
+    ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), NUM_TUPLES);
+    ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), NUM_TUPLES * (NUM_TUPLES - 1) / 2);
+    ASSERT_EQ(tuple->getValue(2)->getValue<int64_t>(), NUM_TUPLES);
+    // The build and probe sides don't fit in the buffer pool, so some of their partitions must
+    // have been written out.
+    ASSERT_GT(getSpillFileSize(), 0);
+}
+
+TEST_F(SpillTest, HashAggregate) {
+    ASSERT_TRUE(conn->query("CALL enable_spilling=true")->isSuccess());
+    // Aggregates can't be aggregated again, so count the groups whose aggregates are as expected.
+    auto result = conn->query("MATCH (a:T) WITH concat(a.s, a.s) AS s, count(*) AS c, "
+                              "sum(a.id) AS total WHERE c = 1 AND "
+                              "starts_with(s, cast(total + 1000000 AS STRING)) RETURN count(*)");
+    ASSERT_TRUE(result->isSuccess()) << result->toString();
+    auto tuple = result->getNext();
+    ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), NUM_TUPLES);
+    ASSERT_GT(getSpillFileSize(), 0);
+}
+
+} // namespace testing
+} // namespace kuzu
@@ -29,7 +29,11 @@ void Benchmark::loadBenchmark(const std::string& benchmarkPath) {
 }
 
 std::unique_ptr<QueryResult> Benchmark::run() const {
-    return conn->query(query, encodedJoin);
+    return run(*conn);
+}
+
+std::unique_ptr<QueryResult> Benchmark::run(Connection& connection) const {
+    return connection.query(query, encodedJoin);
 }
 
 std::unique_ptr<QueryResult> Benchmark::runWithProfile() const {
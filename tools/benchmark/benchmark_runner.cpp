@@ -1,7 +1,10 @@
 #include "benchmark_runner.h"
 
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <thread>
 
 #include "spdlog/spdlog.h"
 
@@ -61,6 +64,10 @@ double BenchmarkRunner::computeAverageOfLastRuns(const double* runTimes, const i
 }
 
 void BenchmarkRunner::runBenchmark(Benchmark* benchmark) const {
+    if (config->numConnections > 1) {
+        runConcurrentBenchmark(benchmark);
+        return;
+    }
     spdlog::info(
         "Running benchmark {} with {} thread", // NOLINT(clang-analyzer-optin.cplusplus.UninitializedObject):
                                                // spdlog has an unitialized object.
@@ -81,6 +88,44 @@ void BenchmarkRunner::runBenchmark(Benchmark* benchmark) const {
             config->numRuns /* numRunsToAverage */));
 }
 
+void BenchmarkRunner::runConcurrentBenchmark(Benchmark* benchmark) const {
+    spdlog::info("Running benchmark {} with {} connections and {} thread per query",
+        benchmark->name, config->numConnections, config->numThreads);
+    std::vector<std::unique_ptr<Connection>> connections;
+    for (auto i = 0u; i < config->numConnections; ++i) {
+        auto connection = std::make_unique<Connection>(database.get());
+        connection->setMaxNumThreadForExec(config->numThreads);
+        for (auto j = 0u; j < config->numWarmups; ++j) {
+            benchmark->run(*connection);
+        }
+        connections.push_back(std::move(connection));
+    }
+    std::atomic<uint64_t> numFailedQueries = 0;
+    std::vector<std::thread> threads;
+    const auto start = std::chrono::steady_clock::now();
+    for (auto& connection : connections) {
+        threads.emplace_back([&, conn = connection.get()] {
+            for (auto i = 0u; i < config->numRuns; ++i) {
+                if (!benchmark->run(*conn)->isSuccess()) {
+                    numFailedQueries++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto elapsedMs = std::chrono::duration<double, std::milli>(elapsed).count();
+    const auto numQueries = static_cast<double>(config->numConnections) * config->numRuns;
+    if (numFailedQueries > 0) {
+        spdlog::error("{} of {} queries failed.", numFailedQueries.load(), numQueries);
+    }
+    spdlog::info("Total time (ms): {}", elapsedMs);
+    spdlog::info("Throughput (queries/s): {}", numQueries * 1000 / elapsedMs);
+    spdlog::info("Average latency (ms): {}", elapsedMs / config->numRuns);
+}
+
 void BenchmarkRunner::profileQueryIfEnabled(Benchmark* benchmark) const {
     if (config->enableProfile && !config->outputPath.empty()) {
         auto profileInfo = benchmark->runWithProfile();
@@ -17,6 +17,9 @@ struct BenchmarkConfig {
     uint32_t numRuns = 5;
     // number of threads to execute benchmark
     uint32_t numThreads = 1;
+    // number of connections issuing the benchmark query concurrently. If larger than 1, each
+    // connection runs the query numRuns times and the query throughput is reported.
+    uint32_t numConnections = 1;
     // output benchmark log to file
     std::string outputPath;
     uint64_t bufferPoolSize = 1 << 23;
@@ -21,6 +21,9 @@ private:
     void registerBenchmark(const std::string& path);
 
     void runBenchmark(Benchmark* benchmark) const;
+    // Runs the benchmark query from multiple connections at the same time and reports the
+    // throughput, e.g., to measure scheduling overhead of many concurrent small queries.
+    void runConcurrentBenchmark(Benchmark* benchmark) const;
 
     void profileQueryIfEnabled(Benchmark* benchmark) const;
 
@@ -30,6 +30,8 @@ int main(int argc, char** argv) {
             config->numRuns = stoul(getArgumentValue(arg));
         } else if (arg.starts_with("--thread")) {
             config->numThreads = stoul(getArgumentValue(arg));
+        } else if (arg.starts_with("--connections")) {
+            config->numConnections = stoul(getArgumentValue(arg));
         } else if (arg.starts_with("--out")) { // save benchmark result to file
             config->outputPath = getArgumentValue(arg);
         } else if (arg.starts_with("--profile")) {